@@ -3,6 +3,8 @@ use super::mesh::*;
 use std::ops::*;
 use crate::mat44::*;
 use crate::geo::{HitResult, Ray};
+use crate::load;
+use std::io;
 use serde::{Serialize, Deserialize};
 
 #[derive(Serialize, Deserialize)]
@@ -44,7 +46,7 @@ impl BezierCurve {
     BezierCurve::value_impl(&mut self.der_ps.clone(), t).to_f32_vec3()
   }
 
-  pub fn rotate_bezier(mut self, sample_t: usize, sample_theta: usize, shift: Vec3, scale: f32) -> RotateBezier {
+  fn transform(&mut self, shift: Vec3, scale: f32) {
     for p in self.ps.as_mut() {
       *p *= scale;
       p.1 += shift.1 as f64;
@@ -52,9 +54,25 @@ impl BezierCurve {
     for p in self.der_ps.as_mut() {
       *p *= scale;
     }
+  }
+
+  pub fn rotate_bezier(mut self, sample_t: usize, sample_theta: usize, shift: Vec3, scale: f32) -> RotateBezier {
+    self.transform(shift, scale);
     let mesh = self.to_mesh(sample_t, sample_theta, Mat44::shift(shift.0, 0.0, shift.2));
     RotateBezier { curve: self, shift_x: shift.0, shift_z: shift.2, mesh: Box::new(mesh) }
   }
+
+  // like rotate_bezier, but the proxy mesh is the obj generated by tool/tessellate.cpp (with the same shift & scale)
+  // which is only fine where the curve bends or is close to the camera
+  pub fn rotate_bezier_obj(mut self, path: &str, shift: Vec3, scale: f32) -> io::Result<RotateBezier> {
+    self.transform(shift, scale);
+    let mut mesh = load::mesh(path, Mat44::identity())?;
+    // vt is the parameter (u, v), not an image coordinate, undo the flip of load::mesh
+    for uv in mesh.uv.iter_mut() {
+      uv.1 = -uv.1;
+    }
+    Ok(RotateBezier { curve: self, shift_x: shift.0, shift_z: shift.2, mesh: Box::new(mesh) })
+  }
 }
 
 impl Curve for BezierCurve {
@@ -10,8 +10,6 @@ use crate::byteorder::*;
 use std::fs::{File, remove_file};
 use std::process::Command;
 use crate::bezier::RotateBezier;
-use crate::f128::f128;
-use num_traits::cast::ToPrimitive;
 
 fn cpp_vec3(v: Vec3) -> String {
   format!("Vec3{{{}, {}, {}}}", v.0, v.1, v.2)
@@ -22,12 +20,38 @@ pub trait BaseFn<Ch: BaseFn<Ch>> {
 
   fn gen_main(this: &mut CodegenBase<Ch>, world: &World);
 
+  // backends that call gen_nee before gen_trace_loop, only they support Texture::Emissive
+  const NEE: bool = false;
+
+  // backends whose trace() takes the ray cone of the camera ray as the last argument, from gen_cpp_pixel_loop
+  const CONE: bool = false;
+
+  // the rest of trace(), after `fac` is declared
+  // `cone` is the ray cone of the camera ray, a parameter of trace()
+  // with World::env_map or emissive objects, gen_nee should have been called before, radiance from them is
+  // accumulated in `rad`, bsdf_pdf is the pdf of the last diffuse bounce for mis, 0 for the camera & specular bounces
   fn gen_trace_loop(this: &mut CodegenBase<Ch>, world: &World) {
+    let (env, emissive) = (world.env_map.is_some(), has_emissive(world));
+    let nee = env || emissive;
+    let ret = if nee { "rad + " } else { "" };
+    if nee {
+      this.wln("Vec3 rad{};");
+      this.wln("f32 bsdf_pdf = 0.0f;");
+    }
     this.wln("for (u32 _ = 0; _ < 16; ++_) {").inc();
-    this.wln("if (fac.len2() <= 1e-4) { return Vec3{}; }");
+    this.wln(&format!("if (fac.len2() <= 1e-4) {{ return {}; }}", if nee { "rad" } else { "Vec3{}" }));
+    this.wln("TRACE_STAT(path, 1);");
     this.wln("HitRes res{1e10};");
-    for obj in &world.objs {
-      Self::gen_geo(this, obj);
+    if nee {
+      // gen_nee has generated scene_hit() for shadow rays, the geometry is only generated once
+      this.wln("scene_hit(ray, res, rng, cone);");
+    } else {
+      this.wln("{").inc();
+      this.wln("TelemetryHit telemetry_hit;");
+      for obj in &world.objs {
+        Self::gen_geo(this, obj);
+      }
+      this.dec().wln("}");
     }
     this.wln("{").inc();
     match &world.light.geo {
@@ -37,13 +61,14 @@ pub trait BaseFn<Ch: BaseFn<Ch>> {
         this.wln(&format!("f32 t = ({} - ray.o).dot({}) / dot_d_n;", cpp_vec3(plane.p), cpp_vec3(plane.n)));
         this.wln(&format!("if (t > EPS && t < res.t && (ray.o + ray.d * t - {}).len2() < {}) {{",
                           cpp_vec3(plane.p), circle.u.len2())).inc();
-        this.wln(&format!("return fac.schur({});", cpp_vec3(world.light.emission)));
+        this.wln(&format!("return {}fac.schur({});", ret, cpp_vec3(world.light.emission)));
         this.dec().wln("}");
       }
     };
     this.dec().wln("}");
-    Self::gen_handle_text(this);
+    Self::gen_handle_text(this, env, emissive);
     this.dec().wln("}");
+    this.wln(if nee { "return rad;" } else { "return Vec3{};" });
   }
 
   fn gen_geo(this: &mut CodegenBase<Ch>, obj: &Object) {
@@ -71,7 +96,9 @@ pub trait BaseFn<Ch: BaseFn<Ch>> {
         gen_color!(data, w, h, {
           this.wln("f32 u = 0.5f + atan2f(res.norm.z, res.norm.x) / (2.0f * PI);");
           this.wln("f32 v = 0.5f - asinf(res.norm.y) / PI;");
-          Self::gen_img(this, data, *w, *h, false);
+          // u is stretched towards the poles, which is ignored
+          let uv_scale = 1.0 / ((2.0f32).sqrt() * std::f32::consts::PI * sphere.r);
+          Self::gen_img(this, data, *w, *h, false, uv_scale);
         });
         this.dec().wln("}").dec().wln("}");
       }
@@ -89,7 +116,7 @@ pub trait BaseFn<Ch: BaseFn<Ch>> {
             // it is an arbitrary factor
             this.wln(&format!("f32 u = p.dot({});", cpp_vec3(u / 3.15)));
             this.wln(&format!("f32 v = p.dot({});", cpp_vec3(v / 3.15)));
-            Self::gen_img(this, data, *w, *h, true);
+            Self::gen_img(this, data, *w, *h, true, 1.0 / 3.15);
           });
         this.dec().wln("}");
       }
@@ -107,7 +134,7 @@ pub trait BaseFn<Ch: BaseFn<Ch>> {
             this.wln(&format!("Vec3 p = ray.o + ray.d * t - {};", cpp_vec3(zero)));
             this.wln(&format!("f32 u = p.dot({});", cpp_vec3(circle.u * 0.5 / circle.u.len2())));
             this.wln(&format!("f32 v = p.dot({});", cpp_vec3(circle.v * 0.5 / circle.v.len2())));
-            Self::gen_img(this, data, *w, *h, false);
+            Self::gen_img(this, data, *w, *h, false, 0.5 / (circle.u.len() * circle.v.len()).sqrt());
           });
         this.dec().wln("}");
       }
@@ -123,7 +150,9 @@ pub trait BaseFn<Ch: BaseFn<Ch>> {
         this.wln("res.t = t;");
         this.wln(&format!("res.norm = {};", cpp_vec3(plane.n)));
         this.wln(&format!("res.text = {};", Self::gen_text(obj.texture)));
-        gen_color!(data, w, h, { Self::gen_img(this, data, *w, *h, false); });
+        gen_color!(data, w, h, {
+          Self::gen_img(this, data, *w, *h, false, (rectangle.inv_u_len * rectangle.inv_v_len).sqrt());
+        });
         this.dec().wln("}").dec().wln("}");
       }
       Geo::Mesh(mesh) => Self::gen_mesh(this, mesh, obj, None),
@@ -134,42 +163,131 @@ pub trait BaseFn<Ch: BaseFn<Ch>> {
     this.dec().wln("}");
   }
 
+  // the geometry as standalone functions, for backends that cast rays in more than one place
+  // scene_hit() only hits objects, light_hit() only hits the light source
+  fn gen_scene_hit(this: &mut CodegenBase<Ch>, world: &World) {
+    this.wln("template <typename RNG>");
+    this.wln("void scene_hit(const Ray &ray, HitRes &res, RNG &rng, const RayCone &cone = RayCone{}) {").inc();
+    this.wln("TelemetryHit telemetry_hit;");
+    for obj in &world.objs {
+      Self::gen_geo(this, obj);
+    }
+    this.dec().wln("}\n");
+    this.wln("bool light_hit(const Ray &ray, f32 t_max) {").inc();
+    match &world.light.geo {
+      LightGeo::Circle(circle) => {
+        let plane = &circle.plane;
+        this.wln(&format!("f32 dot_d_n = ray.d.dot({});", cpp_vec3(plane.n)));
+        this.wln(&format!("f32 t = ({} - ray.o).dot({}) / dot_d_n;", cpp_vec3(plane.p), cpp_vec3(plane.n)));
+        this.wln(&format!("return t > EPS && t < t_max && (ray.o + ray.d * t - {}).len2() < {};",
+                          cpp_vec3(plane.p), circle.u.len2()));
+      }
+    };
+    this.dec().wln("}\n");
+  }
+
   fn gen_mesh(this: &mut CodegenBase<Ch>, mesh: &Mesh, obj: &Object, bezier: Option<&RotateBezier>);
 
   // u & v should already be in scope, res.col should be set
   // need_warp: whether u & v need to be set between [0, 1)
-  fn gen_img(this: &mut CodegenBase<Ch>, data: &[Vec3], w: u32, h: u32, need_warp: bool);
+  // uv_scale: the change of (u, v) per unit length on the surface (geometric mean of u & v), for the level of detail,
+  // with res.t, res.norm & the ray cone `cone` in scope
+  fn gen_img(this: &mut CodegenBase<Ch>, data: &[Vec3], w: u32, h: u32, need_warp: bool, uv_scale: f32);
 
   fn gen_text(text: Texture) -> String {
     match text {
       Texture::Diffuse => "0".to_owned(),
       Texture::Specular => "1".to_owned(),
-      Texture::Refractive => "2".to_owned(),
+      Texture::Refractive | Texture::Dispersive { .. } => "2".to_owned(),
       Texture::Mixed { d_prob, s_prob } => format!("({{ f32 p = rng.gen(); p < {} ? 0 : p < {} ? 1 : 2; }})", d_prob, d_prob + s_prob),
+      Texture::Emissive => "3".to_owned(),
     }
   }
 
-  fn gen_handle_text(this: &mut CodegenBase<Ch>) {
-    this.wln("if (res.t == 1e10) { break; }
-    Vec3 p = ray.o + ray.d * res.t;
+  // env & emissive: the next event estimation parts of gen_trace_loop, with `rad` & `bsdf_pdf` in scope
+  fn gen_handle_text(this: &mut CodegenBase<Ch>, env: bool, emissive: bool) {
+    if env {
+      this.wln("if (res.t == 1e10) {").inc();
+      this.wln("f32 env_pdf;");
+      this.wln("Vec3 env_rad = ENV.eval(ray.d, env_pdf);");
+      this.wln("return rad + fac.schur(env_rad) * (bsdf_pdf == 0.0f ? 1.0f : mis_weight(bsdf_pdf, env_pdf));");
+      this.dec().wln("}");
+    } else {
+      this.wln("if (res.t == 1e10) { break; }");
+    }
+    this.wln("Vec3 p = ray.o + ray.d * res.t;
     fac = fac.schur(res.col);
+    cone.w = cone.width(res.t);
     switch (res.text) {
       case 0: {
-        f32 r1 = 2.0f * PI * rng.gen();
+        cone.spread = fmaxf(cone.spread, CONE_DIFFUSE_SPREAD);
+        Vec3 w = res.norm.dot(ray.d) < 0.0f ? res.norm : -res.norm;");
+    if env {
+      this.inc().inc();
+      // next event estimation of the env map, the shadow ray is blocked by the light source as well
+      for line in r#"{
+  f32 u0 = rng.gen(), coin = rng.gen(), u1 = rng.gen(), u2 = rng.gen(), env_pdf;
+  Vec3 d;
+  Vec3 env_rad = ENV.sample(u0, coin, u1, u2, d, env_pdf);
+  f32 cos = d.dot(w);
+  if (cos > 0.0f && env_pdf > 0.0f) {
+    Ray shadow{p, d};
+    HitRes h{1e10};
+    scene_hit(shadow, h, rng);
+    if (h.t == 1e10 && !light_hit(shadow, 1e10)) {
+      // diffuse brdf (1 / PI) * cos / env_pdf, against cosine sampling of pdf cos / PI
+      rad += fac.schur(env_rad) * (cos / (PI * env_pdf) * mis_weight(env_pdf, cos / PI));
+    }
+  }
+}"#.lines() {
+        this.wln(line);
+      }
+      this.dec().dec();
+    }
+    if emissive {
+      this.inc().inc();
+      // the shadow ray reaches the sampled point, unless something (including other emissive triangles) is in front
+      for line in r#"{
+  f32 dist, light_pdf;
+  Vec3 d;
+  Vec3 e = LIGHTS.sample(rng, p, d, dist, light_pdf);
+  f32 cos = d.dot(w);
+  if (cos > 0.0f && light_pdf > 0.0f) {
+    Ray shadow{p, d};
+    HitRes h{1e10};
+    scene_hit(shadow, h, rng);
+    if (h.t > dist - EPS && !light_hit(shadow, dist)) {
+      rad += fac.schur(e) * (cos / (PI * light_pdf) * mis_weight(light_pdf, cos / PI));
+    }
+  }
+}"#.lines() {
+        this.wln(line);
+      }
+      this.dec().dec();
+    }
+    this.wln("    f32 r1 = 2.0f * PI * rng.gen();
         f32 r2 = rng.gen(), r2s = sqrtf(r2);
-        Vec3 w = res.norm.dot(ray.d) < 0.0f ? res.norm : -res.norm;
         Vec3 u = w.orthogonal_unit();
         Vec3 v = w.cross(u);
         Vec3 d = (u * cosf(r1) + v * sinf(r1)) * r2s + w * sqrtf(1.0f - r2);
-        ray = {p, d.norm()};
-        break;
+        ray = {p, d.norm()};");
+    if env || emissive {
+      this.wln("    bsdf_pdf = ray.d.dot(w) * (1.0f / PI);");
+    }
+    this.wln("    break;
       }
-      case 1: {
-        ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+      case 1: {");
+    if env || emissive {
+      this.wln("    bsdf_pdf = 0.0f;");
+    }
+    this.wln("    ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
         break;
       }
-      case 2: {
-        constexpr f32 NA = 1.0f, NG = 1.5f, R0 = (NA - NG) * (NA - NG) / ((NA + NG) * (NA + NG));
+      case 2: {");
+    if env || emissive {
+      this.wln("    bsdf_pdf = 0.0f;");
+    }
+    this.wln("    constexpr f32 NA = 1.0f, NG = 1.5f, R0 = (NA - NG) * (NA - NG) / ((NA + NG) * (NA + NG));
         f32 cos = res.norm.dot(ray.d), sin = sqrtf(1.0f - cos * cos), n;
         Vec3 norm_d = res.norm;
         if (cos < 0.0f) {
@@ -189,8 +307,14 @@ pub trait BaseFn<Ch: BaseFn<Ch>> {
           ray = {p, norm_d * (sqrtf(1.0f - sin * sin / (n * n)) - cos / n) + ray.d / n};
         }
         break;
-      }
-    }");
+      }");
+    if emissive {
+      // fac already has the emission in it
+      this.wln("    case 3: {
+        return rad + fac * (bsdf_pdf == 0.0f ? 1.0f : mis_weight(bsdf_pdf, LIGHTS.pdf(ray.o, p, res.col, res.t, res.norm.dot(ray.d))));
+      }");
+    }
+    this.wln("}");
   }
 }
 
@@ -202,14 +326,37 @@ pub struct CodegenBase<Ch: BaseFn<Ch>> {
   impls: Vec<String>,
   mesh_id: u32,
   img_id: u32,
+  // intersect RotateBezier directly (revolution_hit in tool/tracer_util.hpp) instead of proxy mesh + newton iteration
+  // only CPU backends that trace with the full geometry support it
+  direct_bezier: bool,
+  // prepended to the names of the binary blobs (meshes, images...) & so their symbols, for several scenes in one
+  // directory
+  prefix: String,
 }
 
 impl<Ch: BaseFn<Ch>> CodegenBase<Ch> {
   pub fn new(ch: Ch) -> Self {
-    Self { ch, code: String::new(), indent: String::new(), impls: Vec::new(), mesh_id: 0, img_id: 0 }
+    Self { ch, code: String::new(), indent: String::new(), impls: Vec::new(), mesh_id: 0, img_id: 0, direct_bezier: false,
+           prefix: String::new() }
+  }
+
+  pub fn direct_bezier(mut self, direct_bezier: bool) -> Self {
+    self.direct_bezier = direct_bezier;
+    self
+  }
+
+  pub fn prefix(mut self, prefix: &str) -> Self {
+    self.prefix = prefix.to_owned();
+    self
+  }
+
+  // the file name of blob `name`, the object file is <blob>.o, the symbols are _binary_<blob>_start/end
+  fn blob(&self, name: &str) -> String {
+    format!("{}{}", self.prefix, name)
   }
 
   pub fn gen(&mut self, world: &World, path: &str) {
+    assert!(Ch::NEE || !has_emissive(world), "emissive objects are not supported by this backend");
     let mut header = File::open("tool/tracer_util.hpp").unwrap();
     let mut header_content = String::new();
     let _ = header.read_to_string(&mut header_content);
@@ -243,10 +390,9 @@ impl<Ch: BaseFn<Ch>> CodegenBase<Ch> {
   }
 }
 
-fn gen_mesh_obj(id: u32, mesh: &Mesh, object: &Object) {
-  let bin_path = format!("mesh{}", id);
+fn gen_mesh_obj(bin_path: &str, mesh: &Mesh, object: &Object) {
   {
-    let mut bin = File::create(&bin_path).unwrap();
+    let mut bin = File::create(bin_path).unwrap();
     let mut data = Vec::new();
     fn walk(node: &KDNode, f: &mut Vec<u8>, mesh: &Mesh, object: &Object) -> usize {
       let ret = f.len(); // offset of self
@@ -256,8 +402,11 @@ fn gen_mesh_obj(id: u32, mesh: &Mesh, object: &Object) {
       macro_rules! write_vec2 {
         ($vec: expr) => { let _ = (f.write_f32::<LittleEndian>($vec.0), f.write_f32::<LittleEndian>($vec.1)); };
       }
-      write_vec!(node.aabb.min);
-      write_vec!(node.aabb.max);
+      // boxes of coplanar axis aligned triangles (e.g. light panels) are flat, but BB_HIT_RAY needs t_min < t_max
+      let d = node.aabb.max - node.aabb.min;
+      let pad = Vec3(1.0, 1.0, 1.0) * (d.0.max(d.1).max(d.2) * 1e-4 + 1e-6);
+      write_vec!(node.aabb.min - pad);
+      write_vec!(node.aabb.max + pad);
       match &node.kind {
         KDNodeKind::Internal(ch, sp_d, sp) => {
           f.write_u32::<LittleEndian>(0).unwrap();
@@ -346,8 +495,9 @@ fn gen_mesh_obj(id: u32, mesh: &Mesh, object: &Object) {
             write_vec!(mesh.norm[j as usize]);
             write_vec!(mesh.norm[k as usize]);
           }
-          match &object.color {
-            Color::Image { data: _, w: _, h: _ } => {
+          // uv is needed by images, and by RotateBezier as the starting point of newton iteration
+          match (&object.color, &object.geo) {
+            (Color::Image { .. }, _) | (_, Geo::RotateBezier(_)) => {
               for (idx, &(i, j, k)) in idx.iter().enumerate() {
                 if !is_tri[idx] { continue; }
                 write_vec2!(mesh.uv[i as usize]);
@@ -364,319 +514,1610 @@ fn gen_mesh_obj(id: u32, mesh: &Mesh, object: &Object) {
     walk(&mesh.kd, &mut data, mesh, object);
     bin.write_all(&data).unwrap();
   }
-  Command::new("ld").args(&["-r", "-b", "binary", &bin_path, "-o", &format!("mesh{}.o", id)]).spawn().unwrap().wait().unwrap();
-  remove_file(&bin_path).unwrap();
+  Command::new("ld").args(&["-r", "-b", "binary", bin_path, "-o", &format!("{}.o", bin_path)]).spawn().unwrap().wait().unwrap();
+  remove_file(bin_path).unwrap();
 }
 
 // img is accessed though float4 on gpu
-fn gen_img_obj(id: u32, data: &[Vec3], as_float4: bool) {
-  let bin_path = format!("img{}", id);
+fn gen_img_obj(bin_path: &str, data: &[Vec3]) {
   {
-    let mut bin = File::create(&bin_path).unwrap();
-    let mut f = Vec::with_capacity(data.len() * 12);
+    let mut bin = File::create(bin_path).unwrap();
+    let mut f = Vec::with_capacity(data.len() * 16);
     for v in data {
       f.write_f32::<LittleEndian>(v.0).unwrap();
       f.write_f32::<LittleEndian>(v.1).unwrap();
       f.write_f32::<LittleEndian>(v.2).unwrap();
-      if as_float4 {
-        f.write_f32::<LittleEndian>(0.0).unwrap();
-      }
+      f.write_f32::<LittleEndian>(0.0).unwrap();
     }
     bin.write_all(&f).unwrap();
   }
-  Command::new("ld").args(&["-r", "-b", "binary", &bin_path, "-o", &format!("img{}.o", id)]).spawn().unwrap().wait().unwrap();
-  remove_file(&bin_path).unwrap();
+  Command::new("ld").args(&["-r", "-b", "binary", bin_path, "-o", &format!("{}.o", bin_path)]).spawn().unwrap().wait().unwrap();
+  remove_file(bin_path).unwrap();
 }
 
-pub struct CppCodegen;
-
-impl BaseFn<CppCodegen> for CppCodegen {
-  fn gen_impl(this: &mut CodegenBase<CppCodegen>, world: &World) {
-    this.wln("Vec3 trace(Ray ray, XorShiftRNG &rng) {").inc();
-    this.wln("Vec3 fac{1.0f, 1.0f, 1.0f};");
-    Self::gen_trace_loop(this, world);
-    this.wln("return Vec3{};");
-    this.dec().wln("}");
-  }
-
-  fn gen_main(this: &mut CodegenBase<CppCodegen>, world: &World) {
-    this.wln(&format!(r#"const u32 W = {}, H = {};"#, world.w, world.h));
-    this.wln(r#"Vec3 output[W * H];
-
-int main(int argc, char **args) {
-  u32 ns = argc > 1 ? std::atoi(args[1]) : (puts("please specify #sample"), exit(-1), 0);"#).inc();
-    let cx = Vec3(world.w as f32 * 0.5135 / world.h as f32, 0.0, 0.0);
-    let cy = cx.cross(world.cam.d).norm() * 0.5135;
-    this.wln(&format!("constexpr Ray cam{{{}, {}}};", cpp_vec3(world.cam.o), cpp_vec3(world.cam.d)));
-    this.wln(&format!("constexpr Vec3 cx{{{}, {}, {}}};", cx.0, cx.1, cx.2));
-    this.wln(&format!("constexpr Vec3 cy{{{}, {}, {}}};", cy.0, cy.1, cy.2)).dec();
-    this.wln(r#"#pragma omp parallel for schedule(dynamic, 1)
-  for (u32 y = 0; y < H; ++y) {
-    fprintf(stderr, "\rrendering %5.2f%%", 100.0f * y / (H - 1));
-    for (u32 x = 0; x < W; ++x) {
-      u32 index = y * W + x;
-      Vec3 sum{};
-      XorShiftRNG rng{index};
-      for (u32 s = 0; s < ns / 4; ++s) {
-        for (u32 sx = 0; sx < 2; ++sx) {
-          for (u32 sy = 0; sy < 2; ++sy) {
-            f32 r1 = 2.0f * rng.gen(), r2 = 2.0f * rng.gen();
-            f32 dx = r1 < 1.0f ? sqrtf(r1) - 1.0f : 1.0f - sqrtf(2.0f - r1);
-            f32 dy = r2 < 1.0f ? sqrtf(r2) - 1.0f : 1.0f - sqrtf(2.0f - r2);
-            Vec3 d = cx * (((sx + 0.5f + dx) * 0.5f + x) / W - 0.5f) +
-                     cy * (((sy + 0.5f + dy) * 0.5f + y) / H - 0.5f) + cam.d;
-            sum += trace(Ray{cam.o + d * 14.0f, d.norm()}, rng);
+// img on cpu is 8 bit rgb (gamma encoded again, the inverse of load::texture) with a mip chain,
+// in the layout of TexLevels & tex_texel in tool/tracer_util.hpp
+fn gen_img_obj_rgb8(bin_path: &str, data: &[Vec3], w: u32, h: u32) {
+  const TILE: u32 = 8; // TEX_TILE
+  {
+    let mut bin = File::create(bin_path).unwrap();
+    let mut f = Vec::new();
+    let gamma = |x: f32| (x.max(0.0).min(1.0).powf(1.0 / 2.2) * 255.0).round() as u8;
+    let (mut level, mut w, mut h) = (data.to_vec(), w, h);
+    loop {
+      let (tiles_w, tiles_h) = ((w + TILE - 1) / TILE, (h + TILE - 1) / TILE);
+      let base = f.len();
+      f.resize(base + (tiles_w * tiles_h * TILE * TILE * 3) as usize, 0);
+      for y in 0..h {
+        for x in 0..w {
+          let (ix, iy) = (x % TILE, y % TILE);
+          let mut morton = 0;
+          for b in 0..3 {
+            morton |= (ix >> b & 1) << (2 * b) | (iy >> b & 1) << (2 * b + 1);
           }
+          let i = base + (((y / TILE * tiles_w + x / TILE) * TILE * TILE + morton) * 3) as usize;
+          let c = level[(y * w + x) as usize];
+          f[i] = gamma(c.0);
+          f[i + 1] = gamma(c.1);
+          f[i + 2] = gamma(c.2);
         }
       }
-      output[index] = sum / ns;
+      if w == 1 && h == 1 { break; }
+      // box filter in linear space, the last row / column is repeated for odd sizes
+      let (nw, nh) = ((w + 1) / 2, (h + 1) / 2);
+      let mut next = Vec::with_capacity((nw * nh) as usize);
+      for y in 0..nh {
+        for x in 0..nw {
+          let at = |x: u32, y: u32| level[(y.min(h - 1) * w + x.min(w - 1)) as usize];
+          next.push((at(2 * x, 2 * y) + at(2 * x + 1, 2 * y) + at(2 * x, 2 * y + 1) + at(2 * x + 1, 2 * y + 1)) * 0.25);
+        }
+      }
+      level = next;
+      w = nw;
+      h = nh;
     }
+    bin.write_all(&f).unwrap();
   }
-  output_png(output, W, H, argc > 2 ? args[2] : "image.png");
-}"#);
-  }
+  Command::new("ld").args(&["-r", "-b", "binary", bin_path, "-o", &format!("{}.o", bin_path)]).spawn().unwrap().wait().unwrap();
+  remove_file(bin_path).unwrap();
+}
 
-  fn gen_mesh(this: &mut CodegenBase<CppCodegen>, mesh: &Mesh, obj: &Object, bezier: Option<&RotateBezier>) {
-    let id = this.mesh_id;
-    this.mesh_id += 1;
-    this.wln(&format!("extern const KDNode _binary_mesh{}_start;", id));
-    if let Some(bezier) = bezier {
-      fn gen_coef(this: &mut CodegenBase<CppCodegen>, ps: &[F64Vec3], name: &str) {
-        let n = ps.len() - 1;
-        let mut cs = vec![vec![0; n + 1]; n + 1];
-        let mut coef = vec![(f128::new(0.0), f128::new(0.0)); n + 1];
-        cs[0][0] = 1;
-        for i in 1..=n {
-          cs[i][0] = 1;
-          for j in 1..=i {
-            cs[i][j] = cs[i - 1][j] + cs[i - 1][j - 1];
-          }
-        }
-        for i in 0..=n {
-          let fac_x = f128::new(ps[i].0) * f128::new(cs[n][i]);
-          let fac_y = f128::new(ps[i].1) * f128::new(cs[n][i]);
-          for j in i..=n {
-            let tmp = fac_x * f128::new(cs[n - i][j - i]);
-            coef[j].0 += if (j - i) % 2 == 1 { -tmp } else { tmp };
-            let tmp = fac_y * f128::new(cs[n - i][j - i]);
-            coef[j].1 += if (j - i) % 2 == 1 { -tmp } else { tmp };
-          }
-        }
-        let mut data = String::new();
-        // rev for convenient in C++
-        for (x, y) in coef.iter().rev() {
-          data += &format!("{{{}, {}}}, ", x.to_f32().unwrap(), y.to_f32().unwrap());
-        }
-        this.wln(&format!("constexpr f32 {}[][2] = {{{}}};", name, data));
-      }
-      gen_coef(this, &bezier.curve.ps, "PS");
-      gen_coef(this, &bezier.curve.der_ps, "DER");
-      this.wln(&format!("constexpr f32 SHIFT_X = {}, SHIFT_Z = {};", bezier.shift_x, bezier.shift_z));
-      this.wln(&format!("if (kd_node_hit(&_binary_mesh{}_start, ray, res, {}, {})) {{", id, Self::gen_text(obj.texture), cpp_vec3(Vec3(-1.0, 0.0, 0.0)))).inc();
-      this.wln("f32 u = res.col.x * (2 * PI);
-        f32 v = res.col.y;
-        f32 t = res.t;
-        f32 bx, by, dbx, dby;
-        Vec3 o{ray.o.x - SHIFT_X, ray.o.y, ray.o.z - SHIFT_Z};
-        Vec3 d = ray.d;
-        f32 a00, a01, a02, b0;
-        f32      a11, a12, b1;
-        f32 a20, a21, a22, b2;
-        f32 err;
-        for (u32 i = 0; i < 5; ++i) {
-          EVAL_BEZIER(PS, v, bx, by);
-          EVAL_BEZIER(DER, v, dbx, dby);
-          a00 = -bx * sinf(u), a01 = dbx * cosf(u) , a02 = -d.x, b0 = bx * cosf(u) - o.x - t * d.x;
-          /* a10 = 0       ,*/ a11 = dby           , a12 = -d.y, b1 = by - o.y - t * d.y;
-          a20 = -bx * cosf(u), a21 = -dbx * sinf(u), a22 = -d.z, b2 = -bx * sinf(u)- o.z - t * d.z;
-          err = b0 * b0 + b1 * b1 + b2 * b2;
-          {
-            f32 fac = a20 / a00;
-            a21 -= fac * a01, a22 -= fac * a02, b2 -= fac * b0;
-          }
-          {
-            f32 fac = a21 / a11;
-            a22 -= fac * a12, b2 -= fac * b1;
-          }
-          f32 x2 = b2 / a22;
-          f32 x1 = (b1 - x2 * a12) / a11;
-          f32 x0 = (b0 - x2 * a02 - x1 * a01) / a00;
-          u -= x0, v -= x1, t -= x2;
-        }");
-      this.wln("if (err < 0.01) {").inc();
-      this.wln("res.t = t;");
-      this.wln("res.norm = Vec3{a01, a11, a21}.cross(Vec3{a00, 0, a20}).norm();");
-      match &obj.color {
-        Color::Image { data, w, h } => {
-          this.wln("u = fmaxf(fminf(u / (2 * PI), 0.9999), 0);");
-          this.wln("v = fmaxf(fminf(v, 0.9999), 0);");
-          Self::gen_img(this, data, *w, *h, false);
-        }
-        Color::RGB(rgb) => { this.wln(&format!("res.col = {};", cpp_vec3(*rgb))); }
-      };
-      this.dec().wln("}");
-      this.dec().wln("}");
-    } else {
-      match &obj.color {
-        Color::Image { data, w, h } => {
-          this.wln(&format!("if (kd_node_hit(&_binary_mesh{}_start, ray, res, {}, {})) {{", id, Self::gen_text(obj.texture), cpp_vec3(Vec3(-1.0, 0.0, 0.0)))).inc();
-          this.wln("f32 u = res.col.x;");
-          this.wln("f32 v = res.col.y;");
-          Self::gen_img(this, data, *w, *h, false);
-          this.dec().wln("}");
-        }
-        Color::RGB(rgb) => {
-          this.wln(&format!("kd_node_hit(&_binary_mesh{}_start, ray, res, {}, {});", id, Self::gen_text(obj.texture), cpp_vec3(*rgb)));
-        }
-      };
+// the same as luminance in tool/tracer_util.hpp
+fn luminance(c: Vec3) -> f32 {
+  0.2126 * c.0 + 0.7152 * c.1 + 0.0722 * c.2
+}
+
+// walker's alias table of the distribution p (sums to 1) by vose's method
+// entry i keeps prob[i] of its column, the rest of the column belongs to alias[i]
+fn alias_table(p: &[f32]) -> (Vec<f32>, Vec<u32>) {
+  let n = p.len();
+  let (mut prob, mut alias) = (p.iter().map(|&x| x * n as f32).collect::<Vec<_>>(), (0..n as u32).collect::<Vec<_>>());
+  let (mut small, mut large): (Vec<_>, Vec<_>) = (0..n).partition(|&i| prob[i] < 1.0);
+  while let (Some(&s), Some(&l)) = (small.last(), large.last()) {
+    small.pop();
+    alias[s] = l as u32;
+    prob[l] -= 1.0 - prob[s];
+    if prob[l] < 1.0 {
+      large.pop();
+      small.push(l);
     }
-    gen_mesh_obj(id, mesh, obj);
   }
+  // the rest are 1 up to rounding
+  for i in small.into_iter().chain(large) { prob[i] = 1.0; }
+  (prob, alias)
+}
 
-  fn gen_img(this: &mut CodegenBase<CppCodegen>, data: &[Vec3], w: u32, h: u32, need_warp: bool) {
-    let id = this.img_id;
-    this.img_id += 1;
-    this.wln(&format!("extern const Vec3 _binary_img{}_start[];", id));
-    if need_warp {
-      this.wln("u = mod1(u);");
-      this.wln("v = mod1(v);");
+// texels of the env map with the alias table, in the layout of EnvTexel in tool/env_util.hpp
+fn gen_env_obj(bin_path: &str, env: &EnvMap) {
+  let (w, h, n) = (env.w, env.h, env.data.len());
+  // texels near the poles cover less solid angle
+  let weight = env.data.iter().enumerate().map(|(i, c)| {
+    let theta = ((i as u32 / w) as f32 + 0.5) / h as f32 * std::f32::consts::PI;
+    luminance(*c).max(0.0) * theta.sin()
+  }).collect::<Vec<_>>();
+  let sum = weight.iter().map(|&x| x as f64).sum::<f64>();
+  let p = weight.iter().map(|&x| if sum > 0.0 { (x as f64 / sum) as f32 } else { 1.0 / n as f32 }).collect::<Vec<_>>();
+  let (prob, alias) = alias_table(&p);
+  {
+    let mut bin = File::create(bin_path).unwrap();
+    let mut f = Vec::with_capacity(n * 24);
+    let pdf_scale = (w * h) as f32 / (2.0 * std::f32::consts::PI * std::f32::consts::PI);
+    for i in 0..n {
+      let c = env.data[i];
+      for x in &[c.0, c.1, c.2, prob[i]] { f.write_f32::<LittleEndian>(*x).unwrap(); }
+      f.write_u32::<LittleEndian>(alias[i]).unwrap();
+      f.write_f32::<LittleEndian>(p[i] * pdf_scale).unwrap();
     }
-    this.wln(&format!("res.col = _binary_img{}_start[u32(v * {h}) * {w} + u32(u * {w})];", id, h = h, w = w));
-    gen_img_obj(id, data, false);
+    bin.write_all(&f).unwrap();
   }
+  Command::new("ld").args(&["-r", "-b", "binary", bin_path, "-o", &format!("{}.o", bin_path)]).spawn().unwrap().wait().unwrap();
+  remove_file(bin_path).unwrap();
 }
 
-pub struct CudaCodegen {
-  img_wh: Vec<(u32, u32)>,
+// scenes with at least this many emissive triangles choose them by the light bvh instead of the alias table
+const LIGHT_BVH_MIN: usize = 64;
+
+// directions up to sign, within acos(cos) of axis or -axis, cos <= 0 is all directions
+#[derive(Copy, Clone)]
+struct LightCone {
+  axis: Vec3,
+  cos: f32,
 }
 
-impl CudaCodegen {
-  pub fn new() -> CudaCodegen {
-    CudaCodegen { img_wh: Vec::new() }
+impl LightCone {
+  const ALL: LightCone = LightCone { axis: Vec3(0.0, 1.0, 0.0), cos: -1.0 };
+
+  // the smallest cone of the two (pbrt's union of direction cones), after flipping b to the side of a
+  fn union(a: LightCone, b: LightCone) -> LightCone {
+    if a.cos <= 0.0 || b.cos <= 0.0 { return LightCone::ALL; }
+    let b_axis = if a.axis.dot(b.axis) < 0.0 { -b.axis } else { b.axis };
+    let (ta, tb, td) = (a.cos.min(1.0).acos(), b.cos.min(1.0).acos(), a.axis.dot(b_axis).min(1.0).acos());
+    if td + tb <= ta { return a; }
+    if td + ta <= tb { return LightCone { axis: b_axis, cos: b.cos }; }
+    let to = (ta + td + tb) * 0.5;
+    let k = a.axis.cross(b_axis);
+    if to >= std::f32::consts::FRAC_PI_2 || k.len2() == 0.0 { return LightCone::ALL; }
+    // rotate a.axis toward b_axis by to - ta (rodrigues)
+    let (k, r) = (k.norm(), to - ta);
+    let axis = a.axis * r.cos() + k.cross(a.axis) * r.sin() + k * (k.dot(a.axis) * (1.0 - r.cos()));
+    LightCone { axis: axis.norm(), cos: to.cos() }
+  }
+
+  // the orientation measure of pbrt's saoh for emitters of cos falloff
+  fn measure(&self) -> f32 {
+    use std::f32::consts::{PI, FRAC_PI_2};
+    let to = self.cos.max(-1.0).min(1.0).acos().min(FRAC_PI_2);
+    let tw = (to + FRAC_PI_2).min(PI);
+    2.0 * PI * (1.0 - to.cos()) + FRAC_PI_2 * (2.0 * tw * to.sin() - (to - 2.0 * tw).cos() - 2.0 * to * to.sin() + to.cos())
   }
 }
 
-impl BaseFn<CudaCodegen> for CudaCodegen {
-  fn gen_impl(this: &mut CodegenBase<CudaCodegen>, world: &World) {
-    this.wln("DEVICE Vec3 trace_impl(Ray ray, XorShiftRNG &rng) {").inc();
-    this.wln("Vec3 fac{1.0f, 1.0f, 1.0f};");
-    Self::gen_trace_loop(this, world);
-    this.wln("return Vec3{};");
-    this.dec().wln("}\n");
+// a subtree or a triangle of the light bvh
+#[derive(Copy, Clone)]
+struct LightBound {
+  min: Vec3,
+  max: Vec3,
+  cone: LightCone,
+  power: f32,
+}
 
-    this.wln("GLOBAL void trace(Vec3 *gpu_output, u32 ns) {").inc();
-    let cx = Vec3(world.w as f32 * 0.5135 / world.h as f32, 0.0, 0.0);
-    let cy = cx.cross(world.cam.d).norm() * 0.5135;
-    this.wln(&format!("constexpr Ray cam{{{}, {}}};", cpp_vec3(world.cam.o), cpp_vec3(world.cam.d)));
-    this.wln(&format!("constexpr Vec3 cx{{{}, {}, {}}};", cx.0, cx.1, cx.2));
-    this.wln(&format!("constexpr Vec3 cy{{{}, {}, {}}};", cy.0, cy.1, cy.2)).dec();
-    this.wln(&format!(r#"
-  u32 x = blockIdx.x, y = blockIdx.y, th = threadIdx.x;
-  u32 index = y * {w} + x;
-  XorShiftRNG rng{{index + th * 19260817}};
-  Vec3 sum{{}};
-  for (u32 s = 0; s < ns / (CUDA_BLOCK_SIZE * 4); ++s) {{
-    for (u32 sx = 0; sx < 2; ++sx) {{
-      for (u32 sy = 0; sy < 2; ++sy) {{
-        f32 r1 = 2.0f * rng.gen(), r2 = 2.0f * rng.gen();
-        f32 dx = r1 < 1.0f ? sqrtf(r1) - 1.0f : 1.0f - sqrtf(2.0f - r1);
-        f32 dy = r2 < 1.0f ? sqrtf(r2) - 1.0f : 1.0f - sqrtf(2.0f - r2);
-        Vec3 d = cx * (((sx + 0.5f + dx) * 0.5f + x) / {w} - 0.5f) + cy * (((sy + 0.5f + dy) * 0.5f + y) / {h} - 0.5f) + cam.d;
-        sum += trace_impl(Ray{{cam.o, d.norm()}}, rng);
-      }}
-    }}
-  }}
-  sum /= ns;
-  atomicAdd(&gpu_output[index].x, sum.x);
-  atomicAdd(&gpu_output[index].y, sum.y);
-  atomicAdd(&gpu_output[index].z, sum.z);
-}}"#, w = world.w, h = world.h));
+impl LightBound {
+  fn union(a: &LightBound, b: &LightBound) -> LightBound {
+    let mut min = a.min;
+    let mut max = a.max;
+    for i in 0..3 {
+      min[i] = min[i].min(b.min[i]);
+      max[i] = max[i].max(b.max[i]);
+    }
+    LightBound { min, max, cone: LightCone::union(a.cone, b.cone), power: a.power + b.power }
   }
 
-  fn gen_main(this: &mut CodegenBase<CudaCodegen>, world: &World) {
-    this.wln(&format!("Vec3 cpu_output[{}];", world.w * world.h));
-    for i in 0..this.mesh_id {
-      this.wln(&format!("CONSTANT const KDNode * __restrict__ gpu_mesh{};", i));
+  fn cost(&self) -> f32 {
+    let d = self.max - self.min;
+    self.power * self.cone.measure() * 2.0 * (d.0 * d.1 + d.1 * d.2 + d.2 * d.0)
+  }
+}
+
+// nodes in depth first order as (bound, second child or triangle, leaf), see LightNode in tool/emissive_util.hpp
+// prims are (bound, centroid, triangle)
+fn build_light_bvh(prims: &mut [(LightBound, Vec3, u32)], depth: u32, nodes: &mut Vec<(LightBound, u32, bool)>) {
+  assert!(depth < 64, "light bvh too deep");
+  let bound = prims[1..].iter().fold(prims[0].0, |b, p| LightBound::union(&b, &p.0));
+  if prims.len() == 1 {
+    nodes.push((bound, prims[0].2, true));
+    return;
+  }
+  let (mut cmin, mut cmax) = (prims[0].1, prims[0].1);
+  for p in prims.iter() {
+    for i in 0..3 {
+      cmin[i] = cmin[i].min(p.1[i]);
+      cmax[i] = cmax[i].max(p.1[i]);
     }
-    for i in 0..this.ch.img_wh.len() {
-      this.wln(&format!("texture<float4, 2, cudaReadModeElementType> gpu_img{};", i));
-      this.wln(&format!("cudaArray *gpu_img{}_arr;", i));
+  }
+  // binned saoh, with pbrt's regularization against thin boxes
+  const BUCKET: usize = 12;
+  let ext = bound.max - bound.min;
+  let max_ext = ext.0.max(ext.1).max(ext.2);
+  let bucket = |p: &(LightBound, Vec3, u32), a: usize| {
+    (((p.1[a] - cmin[a]) / (cmax[a] - cmin[a]) * BUCKET as f32) as usize).min(BUCKET - 1)
+  };
+  let mut best = (f32::INFINITY, 0, 0);
+  for a in 0..3 {
+    if cmax[a] <= cmin[a] { continue; }
+    let mut buckets: Vec<Option<LightBound>> = vec![None; BUCKET];
+    for p in prims.iter() {
+      let b = &mut buckets[bucket(p, a)];
+      *b = Some(match b { Some(b) => LightBound::union(b, &p.0), None => p.0 });
     }
-    this.wln("");
-    this.wln("void init_res() {").inc();
-    for i in 0..this.mesh_id {
-      this.wln(&format!(r#"extern const u8 _binary_mesh{i}_start;
-  extern const u8 _binary_mesh{i}_end;
-  KDNode *gpu_mesh{i}_tmp;
-  cudaMalloc(&gpu_mesh{i}_tmp, &_binary_mesh{i}_end - &_binary_mesh{i}_start);
-  cudaMemcpy(gpu_mesh{i}_tmp, &_binary_mesh{i}_start, &_binary_mesh{i}_end - &_binary_mesh{i}_start, cudaMemcpyHostToDevice);
-  cudaMemcpyToSymbol(gpu_mesh{}, &gpu_mesh{i}_tmp, sizeof(KDNode *));"#, i = i));
+    let merge = |bs: &[Option<LightBound>]| bs.iter().flatten().fold(None, |acc: Option<LightBound>, b| {
+      Some(match acc { Some(acc) => LightBound::union(&acc, b), None => *b })
+    });
+    for k in 1..BUCKET {
+      if let (Some(l), Some(r)) = (merge(&buckets[..k]), merge(&buckets[k..])) {
+        let cost = max_ext / ext[a].max(1e-12) * (l.cost() + r.cost());
+        if cost < best.0 { best = (cost, a, k); }
+      }
     }
-    for (i, (w, h)) in this.ch.img_wh.clone().iter().enumerate() {
-      this.wln(&format!(r#"extern const u8 _binary_img{i}_start;
-  extern const u8 _binary_img{i}_end;
-  cudaChannelFormatDesc desc{i} = cudaCreateChannelDesc<float4>();
-  cudaMallocArray(&gpu_img{i}_arr, &desc{i}, {w}, {h});
-  cudaMemcpyToArray(gpu_img{i}_arr, 0, 0, &_binary_img{i}_start, &_binary_img{i}_end - &_binary_img{i}_start, cudaMemcpyHostToDevice);
-  gpu_img{i}.addressMode[0] = cudaAddressModeWrap;
-  gpu_img{i}.addressMode[1] = cudaAddressModeWrap;
-  gpu_img{i}.filterMode = cudaFilterModeLinear;
-  gpu_img{i}.normalized = true;
-  cudaBindTextureToArray(gpu_img{i}, gpu_img{i}_arr, desc{i});
-  "#, i = i, w = *w, h = *h));
+  }
+  let mid = if best.0.is_finite() {
+    let (_, a, k) = best;
+    let mut mid = 0;
+    for i in 0..prims.len() {
+      if bucket(&prims[i], a) < k {
+        prims.swap(i, mid);
+        mid += 1;
+      }
     }
-    this.dec().wln("}\n");
-    this.wln("void free_res() {").inc();
-    for i in 0..this.mesh_id {
-      this.wln(&format!(r#"KDNode *gpu_mesh{i}_tmp;
-  cudaMemcpyFromSymbol(&gpu_mesh{i}_tmp, gpu_mesh{}, sizeof(KDNode *));
-  cudaFree(gpu_mesh{i}_tmp);"#, i = i));
+    mid
+  } else {
+    // all centroids are the same
+    prims.len() / 2
+  };
+  let index = nodes.len();
+  nodes.push((bound, 0, false));
+  build_light_bvh(&mut prims[..mid], depth + 1, nodes);
+  nodes[index].1 = nodes.len() as u32;
+  build_light_bvh(&mut prims[mid..], depth + 1, nodes);
+}
+
+// emissive triangles of all objects with the alias table, in the layout of EmissiveTri in tool/emissive_util.hpp (as
+// blob `bin_path`), and the light bvh (as `bvh_path`) with at least LIGHT_BVH_MIN triangles
+// returns (#triangle, 1 / total power, whether there is a light bvh)
+fn gen_emissive_obj(bin_path: &str, bvh_path: &str, world: &World) -> (u32, f32, bool) {
+  let mut tris = Vec::new();
+  for obj in &world.objs {
+    if let Texture::Emissive = obj.texture {
+      let emission = match (&obj.geo, &obj.color) {
+        (Geo::Mesh(_), Color::RGB(rgb)) => *rgb,
+        _ => panic!("only meshes with rgb color can be emissive"),
+      };
+      if let Geo::Mesh(mesh) = &obj.geo {
+        for (i, j, k) in mesh_tris(mesh) {
+          let (a, b, c) = (mesh.v[i as usize], mesh.v[j as usize], mesh.v[k as usize]);
+          let n = (b - a).cross(c - a);
+          if n.len2() > 0.0 { tris.push((a, b - a, c - a, n, emission)); }
+        }
+      }
     }
-    for i in 0..this.ch.img_wh.len() {
-      this.wln(&format!("cudaFreeArray(gpu_img{}_arr);", i));
+  }
+  let n = tris.len();
+  // power up to a constant factor, the pdf of a point is luminance / total power in any case
+  let power = tris.iter().map(|&(_, _, _, n, e)| n.len() * 0.5 * luminance(e).max(0.0)).collect::<Vec<_>>();
+  let sum = power.iter().map(|&x| x as f64).sum::<f64>();
+  assert!(sum > 0.0, "emissive objects emit nothing");
+  let (prob, alias) = alias_table(&power.iter().map(|&x| (x as f64 / sum) as f32).collect::<Vec<_>>());
+  {
+    let mut bin = File::create(bin_path).unwrap();
+    let mut f = Vec::with_capacity(n * 72);
+    for (i, &(p, e1, e2, norm, emission)) in tris.iter().enumerate() {
+      for v in &[p, e1, e2, norm.norm(), emission] {
+        for x in &[v.0, v.1, v.2] { f.write_f32::<LittleEndian>(*x).unwrap(); }
+      }
+      f.write_f32::<LittleEndian>(prob[i]).unwrap();
+      f.write_u32::<LittleEndian>(alias[i]).unwrap();
+      f.write_f32::<LittleEndian>(norm.len() * 0.5).unwrap();
     }
-    this.dec().wln("}\n");
-    this.wln(&format!(r#"int main(int argc, char **args) {{
-  u32 ns = argc > 1 ? atoi(args[1]) : (puts("please specify #sample"), exit(-1), 0);
-  ns = (ns + (CUDA_BLOCK_SIZE * 4) - 1) / (CUDA_BLOCK_SIZE * 4) * (CUDA_BLOCK_SIZE * 4);
-  init_res();
-  Vec3 *gpu_output;
-  cudaMalloc(&gpu_output, {wh} * sizeof(Vec3));
-  trace<<<dim3({}, {}, 1), CUDA_BLOCK_SIZE>>>(gpu_output, ns);
-  cudaMemcpy(cpu_output, gpu_output, {wh} * sizeof(Vec3), cudaMemcpyDeviceToHost);
-  cudaFree(gpu_output);
-  free_res();
-  CUDA_CHECK_ERROR(cudaGetLastError());
-  output_png(cpu_output, {w}, {h}, argc > 2 ? args[2] : "image.png");
-}}"#, w = world.w, h = world.h, wh = world.w * world.h));
+    bin.write_all(&f).unwrap();
   }
-
-  fn gen_mesh(this: &mut CodegenBase<CudaCodegen>, mesh: &Mesh, obj: &Object, _bezier: Option<&RotateBezier>) {
-    let id = this.mesh_id;
-    this.mesh_id += 1;
-    this.wln(&format!("extern CONSTANT const KDNode * __restrict__ gpu_mesh{};", id));
-    gen_mesh_obj(id, mesh, obj);
-    {}
-    match &obj.color {
-      Color::Image { data, w, h } => {
-        this.wln(&format!("if (kd_node_hit(gpu_mesh{}, ray, res, {}, {})) {{", id, Self::gen_text(obj.texture), cpp_vec3(Vec3(-1.0, 0.0, 0.0)))).inc();
-        this.wln("f32 u = res.col.x;");
-        this.wln("f32 v = res.col.y;");
-        Self::gen_img(this, data, *w, *h, false);
-        this.dec().wln("}");
+  Command::new("ld").args(&["-r", "-b", "binary", bin_path, "-o", &format!("{}.o", bin_path)]).spawn().unwrap().wait().unwrap();
+  remove_file(bin_path).unwrap();
+  let bvh = n >= LIGHT_BVH_MIN;
+  if bvh {
+    let mut prims = tris.iter().zip(&power).enumerate().map(|(i, (&(p, e1, e2, norm, _), &power))| {
+      let mut bound = LightBound { min: p, max: p, cone: LightCone { axis: norm.norm(), cos: 1.0 }, power };
+      for v in &[p + e1, p + e2] {
+        for a in 0..3 {
+          bound.min[a] = bound.min[a].min(v[a]);
+          bound.max[a] = bound.max[a].max(v[a]);
+        }
       }
-      Color::RGB(rgb) => {
-        this.wln(&format!("kd_node_hit(gpu_mesh{}, ray, res, {}, {});", id, Self::gen_text(obj.texture), cpp_vec3(*rgb)));
+      (bound, p + (e1 + e2) * (1.0 / 3.0), i as u32)
+    }).collect::<Vec<_>>();
+    let mut nodes = Vec::with_capacity(2 * n);
+    build_light_bvh(&mut prims, 0, &mut nodes);
+    {
+      let mut bin = File::create(bvh_path).unwrap();
+      let mut f = Vec::with_capacity(nodes.len() * 52);
+      for (b, child, leaf) in &nodes {
+        for v in &[b.min, b.max, b.cone.axis] {
+          for x in &[v.0, v.1, v.2] { f.write_f32::<LittleEndian>(*x).unwrap(); }
+        }
+        f.write_f32::<LittleEndian>(b.cone.cos).unwrap();
+        f.write_f32::<LittleEndian>(b.power).unwrap();
+        f.write_u32::<LittleEndian>(*child).unwrap();
+        f.write_u32::<LittleEndian>(*leaf as u32).unwrap();
       }
-    };
+      bin.write_all(&f).unwrap();
+    }
+    Command::new("ld").args(&["-r", "-b", "binary", bvh_path, "-o", &format!("{}.o", bvh_path)]).spawn().unwrap().wait().unwrap();
+    remove_file(bvh_path).unwrap();
   }
+  (n as u32, (1.0 / sum) as f32, bvh)
+}
 
-  fn gen_img(this: &mut CodegenBase<CudaCodegen>, data: &[Vec3], w: u32, h: u32, _need_warp: bool) {
-    let id = this.ch.img_wh.len() as u32;
-    this.ch.img_wh.push((w, h));
-    this.wln(&format!("extern texture<float4, 2, cudaReadModeElementType> gpu_img{};", id));
-    this.wln(&format!("res.col = Vec3::from_float4(tex2D(gpu_img{}, u, v));", id));
-    gen_img_obj(id, data, true);
+fn has_emissive(world: &World) -> bool {
+  world.objs.iter().any(|obj| if let Texture::Emissive = obj.texture { true } else { false })
+}
+
+// tool/env_util.hpp & `ENV` for World::env_map, tool/emissive_util.hpp & `LIGHTS` for emissive objects, and
+// scene_hit() & light_hit() for shadow rays (also used by gen_trace_loop then), before the trace function of
+// backends using gen_trace_loop, nothing is generated without any of them
+fn gen_nee<Ch: BaseFn<Ch>>(this: &mut CodegenBase<Ch>, world: &World) {
+  let (env, emissive) = (world.env_map.as_ref(), has_emissive(world));
+  if env.is_none() && !emissive { return; }
+  for (path, used) in &[("tool/env_util.hpp", env.is_some()), ("tool/emissive_util.hpp", emissive)] {
+    if *used {
+      let mut header = File::open(path).unwrap();
+      let mut header_content = String::new();
+      let _ = header.read_to_string(&mut header_content);
+      this.wln(&header_content);
+    }
+  }
+  if let Some(env) = env {
+    let blob = this.blob("env");
+    this.wln(&format!("extern const EnvTexel _binary_{}_start[];", blob));
+    this.wln(&format!("constexpr EnvMap<{}, {}> ENV{{_binary_{}_start}};\n", env.w, env.h, blob));
+    gen_env_obj(&blob, env);
+  }
+  if emissive {
+    let (blob, bvh_blob) = (this.blob("emissive"), this.blob("light_bvh"));
+    let (n, inv_power, bvh) = gen_emissive_obj(&blob, &bvh_blob, world);
+    this.wln(&format!("extern const EmissiveTri _binary_{}_start[];", blob));
+    if bvh { this.wln(&format!("extern const LightNode _binary_{}_start[];", bvh_blob)); }
+    let nodes = if bvh { format!("_binary_{}_start", bvh_blob) } else { "nullptr".to_owned() };
+    this.wln(&format!("constexpr EmissiveTable<{}> LIGHTS{{_binary_{}_start, {}, {}}};\n", n, blob, nodes, inv_power));
+  }
+  Ch::gen_scene_hit(this, world);
+}
+
+// the triangles of a mesh, a triangle can be in more than one leaf of the kd tree
+fn mesh_tris(mesh: &Mesh) -> Vec<(u32, u32, u32)> {
+  fn collect(node: &KDNode, tri: &mut Vec<(u32, u32, u32)>) {
+    match &node.kind {
+      KDNodeKind::Internal(ch, _, _) => {
+        collect(&ch[0], tri);
+        collect(&ch[1], tri);
+      }
+      KDNodeKind::Leaf(index) => tri.extend(index.iter()),
+    }
+  }
+  let mut tri = Vec::new();
+  collect(&mesh.kd, &mut tri);
+  tri.sort();
+  tri.dedup();
+  tri
+}
+
+// uv_scale of a mesh for gen_img, from the total areas of its triangles in uv & in space
+fn mesh_uv_scale(mesh: &Mesh) -> f32 {
+  let (mut uv_area, mut area) = (0.0f64, 0.0f64);
+  for (i, j, k) in mesh_tris(mesh) {
+    let (a, b, c) = (mesh.uv[i as usize], mesh.uv[j as usize], mesh.uv[k as usize]);
+    uv_area += (((b.0 - a.0) * (c.1 - a.1) - (b.1 - a.1) * (c.0 - a.0)) as f64).abs();
+    let (a, b, c) = (mesh.v[i as usize], mesh.v[j as usize], mesh.v[k as usize]);
+    area += (b - a).cross(c - a).len() as f64;
+  }
+  if area > 0.0 { (uv_area / area).sqrt() as f32 } else { 0.0 }
+}
+
+// uv_scale of a RotateBezier, u goes around the circle of the mean radius, v along the curve
+fn bezier_uv_scale(bezier: &RotateBezier) -> f32 {
+  const N: usize = 64;
+  let (mut len, mut r) = (0.0, 0.0);
+  for i in 0..N {
+    let (v0, v1) = (i as f32 / N as f32, (i + 1) as f32 / N as f32);
+    let (p0, p1) = (bezier.curve.value(v0), bezier.curve.value(v1));
+    len += (p1 - p0).len();
+    r += (p0.0.abs() + p1.0.abs()) * 0.5 / N as f32;
+  }
+  1.0 / (2.0 * std::f32::consts::PI * r * len).sqrt()
+}
+
+// typical (median) steps of u & v of a proxy mesh, the steps are not uniform if it is from tool/tessellate.cpp
+// vertices in a row share the same v, and the first one after the seam has u = the step of u of the row
+fn bezier_steps(mesh: &Mesh) -> (f32, f32) {
+  let mut rows = std::collections::BTreeMap::new();
+  for uv in mesh.uv.iter() {
+    let du = rows.entry(uv.1.to_bits()).or_insert(1.0f32); // v >= 0, so the order of bits is the order of v
+    if uv.0 > 0.0 { *du = du.min(uv.0); }
+  }
+  let median = |mut xs: Vec<f32>| {
+    xs.sort_by(|a, b| a.partial_cmp(b).unwrap());
+    xs.get(xs.len() / 2).cloned().unwrap_or(0.0)
+  };
+  let vs = rows.keys().map(|&v| f32::from_bits(v)).collect::<Vec<_>>();
+  let du = median(rows.values().cloned().collect()) * 2.0 * std::f32::consts::PI;
+  (du, median(vs.windows(2).map(|w| w[1] - w[0]).collect()))
+}
+
+// control points of a bezier curve as `constexpr BezierPoly<#control point> name`,
+// the power basis is computed by the C++ compiler (bezier_poly in tool/tracer_util.hpp)
+fn gen_bezier_poly<Ch: BaseFn<Ch>>(this: &mut CodegenBase<Ch>, ps: &[F64Vec3], name: &str) {
+  let data = ps.iter().map(|p| format!("{{{:?}, {:?}}}", p.0, p.1)).collect::<Vec<_>>().join(", ");
+  this.wln(&format!("constexpr f64 {}_CP[][2] = {{{}}};", name, data));
+  this.wln(&format!("constexpr BezierPoly<{}> {} = bezier_poly({}_CP);", ps.len(), name, name));
+}
+
+// bernstein coefficients of the product of 2 polynomials in bernstein form of the same degree
+fn bernstein_mul(a: &[f64], b: &[f64]) -> Vec<f64> {
+  let n = a.len() - 1;
+  let binom = |n: usize, k: usize| (0..k).fold(1.0, |acc, i| acc * (n - i) as f64 / (i + 1) as f64);
+  let mut ret = vec![0.0; 2 * n + 1];
+  for i in 0..=n {
+    for j in 0..=n {
+      ret[i + j] += binom(n, i) * binom(n, j) / binom(2 * n, i + j) * a[i] * b[j];
+    }
+  }
+  ret
+}
+
+// RotateBezier without proxy mesh, see revolution_hit in tool/tracer_util.hpp
+fn gen_cpp_revolution<Ch: BaseFn<Ch>>(this: &mut CodegenBase<Ch>, obj: &Object, bezier: &RotateBezier) {
+  let xs = bezier.curve.ps.iter().map(|p| p.0).collect::<Vec<_>>();
+  let ys = bezier.curve.ps.iter().map(|p| p.1).collect::<Vec<_>>();
+  let ones = vec![1.0; ys.len()];
+  let join = |v: Vec<f64>| v.iter().map(|x| x.to_string()).collect::<Vec<_>>().join(", ");
+  gen_bezier_poly(this, &bezier.curve.ps, "BEZIER");
+  this.wln(&format!("constexpr f32 SHIFT_X = {}, SHIFT_Z = {};", bezier.shift_x, bezier.shift_z));
+  // the control points bound the curve
+  this.wln(&format!("constexpr RevolutionPoly<{}> REV{{{{{}}}, {{{}}}, {{{}}}, {}, {}, {}}};", 2 * ys.len() - 1,
+                    join(bernstein_mul(&ys, &ys)), join(bernstein_mul(&ys, &ones)), join(bernstein_mul(&xs, &xs)),
+                    ys.iter().cloned().fold(f64::INFINITY, f64::min), ys.iter().cloned().fold(f64::NEG_INFINITY, f64::max),
+                    xs.iter().fold(0.0f64, |acc, x| acc.max(x.abs()))));
+  this.wln("f32 u, v, t;");
+  this.wln("Vec3 norm;");
+  this.wln("if (revolution_hit(REV, BEZIER, Vec3{ray.o.x - SHIFT_X, ray.o.y, ray.o.z - SHIFT_Z}, ray.d, res.t, u, v, t, norm)) {").inc();
+  this.wln("res.t = t;");
+  this.wln("res.norm = norm.norm();");
+  this.wln(&format!("res.text = {};", Ch::gen_text(obj.texture)));
+  match &obj.color {
+    Color::Image { data, w, h } => {
+      this.wln("u = fmaxf(fminf(u / (2 * PI), 0.9999), 0);");
+      this.wln("v = fmaxf(fminf(v, 0.9999), 0);");
+      Ch::gen_img(this, data, *w, *h, false, bezier_uv_scale(bezier));
+    }
+    Color::RGB(rgb) => { this.wln(&format!("res.col = {};", cpp_vec3(*rgb))); }
+  };
+  this.dec().wln("}");
+}
+
+// mesh & image code shared by all CPU backends that trace with the full geometry (including RotateBezier)
+fn gen_cpp_mesh<Ch: BaseFn<Ch>>(this: &mut CodegenBase<Ch>, mesh: &Mesh, obj: &Object, bezier: Option<&RotateBezier>) {
+  if let (Some(bezier), true) = (bezier, this.direct_bezier) {
+    gen_cpp_revolution(this, obj, bezier);
+    return;
+  }
+  let blob = this.blob(&format!("mesh{}", this.mesh_id));
+  this.mesh_id += 1;
+  this.wln(&format!("extern const KDNode _binary_{}_start;", blob));
+  if let Some(bezier) = bezier {
+    gen_bezier_poly(this, &bezier.curve.ps, "BEZIER");
+    this.wln(&format!("constexpr f32 SHIFT_X = {}, SHIFT_Z = {};", bezier.shift_x, bezier.shift_z));
+    // the parameter steps of the proxy mesh, for the neighbouring starting points of newton iteration
+    let (du, dv) = bezier_steps(&bezier.mesh);
+    this.wln(&format!("constexpr f32 DU = {}, DV = {};", du, dv));
+    // res is restored if newton iteration fails, otherwise the proxy triangle would be left as the hit
+    this.wln("HitRes prev = res;");
+    this.wln(&format!("if (kd_node_hit(&_binary_{}_start, ray, res, {}, {})) {{", blob, Ch::gen_text(obj.texture), cpp_vec3(Vec3(-1.0, 0.0, 0.0)))).inc();
+    this.wln("f32 u = res.col.x * (2 * PI), v = res.col.y, t = res.t;");
+    this.wln("Vec3 norm;");
+    this.wln("if (rotate_bezier_hit(BEZIER, Vec3{ray.o.x - SHIFT_X, ray.o.y, ray.o.z - SHIFT_Z}, ray.d, DU, DV, prev.t, u, v, t, norm)) {").inc();
+    this.wln("res.t = t;");
+    this.wln("res.norm = norm.norm();");
+    match &obj.color {
+      Color::Image { data, w, h } => {
+        this.wln("u = fmaxf(fminf(u / (2 * PI), 0.9999), 0);");
+        this.wln("v = fmaxf(fminf(v, 0.9999), 0);");
+        Ch::gen_img(this, data, *w, *h, false, bezier_uv_scale(bezier));
+      }
+      Color::RGB(rgb) => { this.wln(&format!("res.col = {};", cpp_vec3(*rgb))); }
+    };
+    this.dec().wln("} else {").inc();
+    this.wln("res = prev;");
+    this.dec().wln("}");
+    this.dec().wln("}");
+  } else {
+    match &obj.color {
+      Color::Image { data, w, h } => {
+        this.wln(&format!("if (kd_node_hit(&_binary_{}_start, ray, res, {}, {})) {{", blob, Ch::gen_text(obj.texture), cpp_vec3(Vec3(-1.0, 0.0, 0.0)))).inc();
+        this.wln("f32 u = res.col.x;");
+        this.wln("f32 v = res.col.y;");
+        Ch::gen_img(this, data, *w, *h, false, mesh_uv_scale(mesh));
+        this.dec().wln("}");
+      }
+      Color::RGB(rgb) => {
+        this.wln(&format!("kd_node_hit(&_binary_{}_start, ray, res, {}, {});", blob, Ch::gen_text(obj.texture), cpp_vec3(*rgb)));
+      }
+    };
+  }
+  gen_mesh_obj(&blob, mesh, obj);
+}
+
+// the lookup of image blob `blob` at (u, v), the image itself is from gen_img_obj_rgb8
+fn gen_cpp_img_fetch<Ch: BaseFn<Ch>>(this: &mut CodegenBase<Ch>, blob: &str, w: u32, h: u32, need_warp: bool, uv_scale: f32) {
+  this.wln(&format!("extern const u8 _binary_{}_start[];", blob));
+  if need_warp {
+    this.wln("u = mod1(u);");
+    this.wln("v = mod1(v);");
+  }
+  // texels per unit length at level 0
+  let density = uv_scale * ((w * h) as f32).sqrt();
+  this.wln(&format!("res.col = tex_fetch<{}, {}, {}>(_binary_{}_start, u, v, tex_lod(cone.width(res.t), ray.d.dot(res.norm), {}));",
+                    w, h, need_warp, blob, density));
+}
+
+fn gen_cpp_img<Ch: BaseFn<Ch>>(this: &mut CodegenBase<Ch>, data: &[Vec3], w: u32, h: u32, need_warp: bool, uv_scale: f32) {
+  let blob = this.blob(&format!("img{}", this.img_id));
+  this.img_id += 1;
+  gen_cpp_img_fetch(this, &blob, w, h, need_warp, uv_scale);
+  gen_img_obj_rgb8(&blob, data, w, h);
+}
+
+// the angle of a pixel (at the center of the screen) of the camera of gen_cpp_camera
+fn pixel_spread(world: &World) -> f32 {
+  0.5135 / world.h as f32
+}
+
+// `cam`, `cx` & `cy` in the main function of CPU backends
+fn gen_cpp_camera<Ch: BaseFn<Ch>>(this: &mut CodegenBase<Ch>, world: &World) {
+  let cx = Vec3(world.w as f32 * 0.5135 / world.h as f32, 0.0, 0.0);
+  let cy = cx.cross(world.cam.d).norm() * 0.5135;
+  this.wln(&format!("constexpr Ray cam{{{}, {}}};", cpp_vec3(world.cam.o), cpp_vec3(world.cam.d)));
+  this.wln(&format!("constexpr Vec3 cx{{{}, {}, {}}};", cx.0, cx.1, cx.2));
+  this.wln(&format!("constexpr Vec3 cy{{{}, {}, {}}};", cy.0, cy.1, cy.2));
+  this.wln(&format!("constexpr f32 PIXEL_SPREAD = {};", pixel_spread(world)));
+}
+
+// where the random numbers of the pixel loop come from
+#[derive(Copy, Clone)]
+pub enum Sampler {
+  XorShift,
+  // owen scrambled sobol sequence in tool/sampler.hpp, scrambled per pixel
+  Sobol,
+  // counter based rng in tool/sampler.hpp, keyed by (seed, pixel, sample, dimension), `seed` should be in scope
+  Philox,
+  // Sobol, with the scrambling of the first dimensions from the tiles in tool/blue_noise.hpp,
+  // so that the error at low spp is distributed as blue noise over the screen
+  BlueNoise,
+}
+// for samplers other than XorShift, `trace` should accept them, and tool/sampler.hpp should be in the generated code
+// (and tool/blue_noise.hpp for BlueNoise)
+
+// the rest of main function of CPU path tracing backends, `ns` should be in scope
+// finish (complete lines) is inserted after rendering, before writing the image
+fn gen_cpp_pixel_loop<Ch: BaseFn<Ch>>(this: &mut CodegenBase<Ch>, sampler: Sampler, finish: &str) {
+  let (rng, next) = match sampler {
+    Sampler::XorShift => ("XorShiftRNG rng{index};", ""),
+    Sampler::Sobol => ("SobolSampler rng{index};", "\n            rng.next_sample();"),
+    Sampler::Philox => ("PhiloxRNG rng{seed, index};", "\n            rng.next_sample();"),
+    Sampler::BlueNoise => (r#"SobolSampler rng{index};
+      for (u32 d = 0; d < 2 * BLUE_NOISE_PAIR; ++d) {
+        rng.reseed(d, BLUE_NOISE_SEED[d / 2][y % BLUE_NOISE_SIZE * BLUE_NOISE_SIZE + x % BLUE_NOISE_SIZE]);
+      }"#, "\n            rng.next_sample();"),
+  };
+  // the camera ray starts at the screen, 14 * |d| from the eye
+  let cone = if Ch::CONE { ", RayCone{14.0f * d.len() * PIXEL_SPREAD, PIXEL_SPREAD}" } else { "" };
+  this.wln(&format!(r#"#ifdef TRACE_STATS
+  static TraceStats pixel_stats[W * H];
+#endif
+  telemetry.start(u64(W) * H * (ns / 4 * 4));
+#pragma omp parallel for schedule(dynamic, 1)
+  for (u32 y = 0; y < H; ++y) {{
+    TelemetrySlot &slot = telemetry_thread_slot();
+    for (u32 x = 0; x < W; ++x) {{
+      u64 pixel_start = telemetry_clock();
+      u32 index = y * W + x;
+      Vec3 sum{{}};
+#ifdef TRACE_STATS
+      trace_stats = TraceStats{{}};
+#endif
+      {}
+      for (u32 s = 0; s < ns / 4; ++s) {{
+        for (u32 sx = 0; sx < 2; ++sx) {{
+          for (u32 sy = 0; sy < 2; ++sy) {{
+            f32 r1 = 2.0f * rng.gen(), r2 = 2.0f * rng.gen();
+            f32 dx = r1 < 1.0f ? sqrtf(r1) - 1.0f : 1.0f - sqrtf(2.0f - r1);
+            f32 dy = r2 < 1.0f ? sqrtf(r2) - 1.0f : 1.0f - sqrtf(2.0f - r2);
+            Vec3 d = cx * (((sx + 0.5f + dx) * 0.5f + x) / W - 0.5f) +
+                     cy * (((sy + 0.5f + dy) * 0.5f + y) / H - 0.5f) + cam.d;
+            sum += trace(Ray{{cam.o + d * 14.0f, d.norm()}}, rng{});{}
+          }}
+        }}
+      }}
+      output[index] = sum / ns;
+#ifdef TRACE_STATS
+      pixel_stats[index] = trace_stats;
+#endif
+      telemetry_add(slot.samples, ns / 4 * 4);
+      telemetry_add(slot.busy_cycles, telemetry_clock() - pixel_start);
+    }}
+  }}
+  telemetry.finish(argc > 2 ? args[2] : "image.png");
+{}#ifdef TRACE_STATS
+  output_trace_stats(pixel_stats, W, H, ns, argc > 2 ? args[2] : "image.png");
+#endif
+  output_png(output, W, H, argc > 2 ? args[2] : "image.png");
+}}"#, rng, cone, next, finish));
+}
+
+pub struct CppCodegen {
+  sampler: Sampler,
+}
+
+impl CppCodegen {
+  pub fn new(sampler: Sampler) -> CppCodegen {
+    CppCodegen { sampler }
+  }
+}
+
+impl BaseFn<CppCodegen> for CppCodegen {
+  const NEE: bool = true;
+  const CONE: bool = true;
+
+  fn gen_impl(this: &mut CodegenBase<CppCodegen>, world: &World) {
+    let headers: &[&str] = match this.ch.sampler {
+      Sampler::XorShift => &[],
+      Sampler::Sobol | Sampler::Philox => &["tool/sampler.hpp"],
+      Sampler::BlueNoise => &["tool/sampler.hpp", "tool/blue_noise.hpp"],
+    };
+    for path in headers {
+      let mut header = File::open(path).unwrap();
+      let mut header_content = String::new();
+      let _ = header.read_to_string(&mut header_content);
+      this.wln(&header_content);
+    }
+    gen_nee(this, world);
+    this.wln("template <typename RNG>");
+    this.wln("Vec3 trace(Ray ray, RNG &rng, RayCone cone) {").inc();
+    this.wln("Vec3 fac{1.0f, 1.0f, 1.0f};");
+    Self::gen_trace_loop(this, world);
+    this.dec().wln("}");
+  }
+
+  fn gen_main(this: &mut CodegenBase<CppCodegen>, world: &World) {
+    this.wln(&format!(r#"const u32 W = {}, H = {};"#, world.w, world.h));
+    this.wln(r#"Vec3 output[W * H];
+
+int main(int argc, char **args) {
+  u32 ns = argc > 1 ? std::atoi(args[1]) : (puts("please specify #sample"), exit(-1), 0);"#).inc();
+    if let Sampler::Philox = this.ch.sampler {
+      // images rendered with different seeds are independent, and can be averaged
+      this.wln("u32 seed = argc > 3 ? std::atoi(args[3]) : 0;");
+    }
+    gen_cpp_camera(this, world);
+    this.dec();
+    let sampler = this.ch.sampler;
+    gen_cpp_pixel_loop(this, sampler, "");
+  }
+
+  fn gen_mesh(this: &mut CodegenBase<CppCodegen>, mesh: &Mesh, obj: &Object, bezier: Option<&RotateBezier>) {
+    gen_cpp_mesh(this, mesh, obj, bezier);
+  }
+
+  fn gen_img(this: &mut CodegenBase<CppCodegen>, data: &[Vec3], w: u32, h: u32, need_warp: bool, uv_scale: f32) {
+    gen_cpp_img(this, data, w, h, need_warp, uv_scale);
+  }
+}
+
+// path tracing with hero wavelength spectral sampling, for dispersion
+// all Texture::Dispersive objects should share the same coefficients
+pub struct SpectralCodegen {
+  sampler: Sampler,
+}
+
+impl SpectralCodegen {
+  pub fn new(sampler: Sampler) -> SpectralCodegen {
+    SpectralCodegen { sampler }
+  }
+}
+
+impl BaseFn<SpectralCodegen> for SpectralCodegen {
+  const CONE: bool = true;
+
+  fn gen_impl(this: &mut CodegenBase<SpectralCodegen>, world: &World) {
+    let mut headers = vec!["tool/spectral_util.hpp"];
+    match this.ch.sampler {
+      Sampler::XorShift => {}
+      Sampler::Sobol | Sampler::Philox => headers.push("tool/sampler.hpp"),
+      Sampler::BlueNoise => headers.extend(&["tool/sampler.hpp", "tool/blue_noise.hpp"]),
+    };
+    for path in headers {
+      let mut header = File::open(path).unwrap();
+      let mut header_content = String::new();
+      let _ = header.read_to_string(&mut header_content);
+      this.wln(&header_content);
+    }
+    let mut cauchy = None;
+    for obj in &world.objs {
+      if let Texture::Dispersive { a, b } = obj.texture {
+        assert!(cauchy.map_or(true, |c| c == (a, b)), "dispersive objects with different coefficients");
+        cauchy = Some((a, b));
+      }
+    }
+    let (a, b) = cauchy.unwrap_or((1.5, 0.0));
+    this.wln(&format!("constexpr f32 CAUCHY_A = {}, CAUCHY_B = {};\n", a, b));
+    Self::gen_scene_hit(this, world);
+    this.wln("template <typename RNG>");
+    this.wln("Vec3 trace(Ray ray, RNG &rng, RayCone cone) {").inc();
+    this.wln("f32x4 l = sample_wavelengths(rng.gen()), fac{1.0f, 1.0f, 1.0f, 1.0f};");
+    this.wln("bool hero_only = false;");
+    this.wln("for (u32 _ = 0; _ < 16; ++_) {").inc();
+    this.wln("if (fmaxf(fmaxf(fac[0], fac[1]), fmaxf(fac[2], fac[3])) <= 1e-2f) { break; }");
+    this.wln("TRACE_STAT(path, 1);");
+    this.wln("HitRes res{1e10};");
+    this.wln("scene_hit(ray, res, rng, cone);");
+    this.wln("if (light_hit(ray, res.t)) {").inc();
+    this.wln(&format!("return spectral_to_rgb(fac * spectrum({}, l), l);", cpp_vec3(world.light.emission)));
+    this.dec().wln("}");
+    this.wln(r#"if (res.t == 1e10) { break; }
+    Vec3 p = ray.o + ray.d * res.t;
+    fac *= spectrum(res.col, l);
+    cone.w = cone.width(res.t);
+    switch (res.text) {
+      case 0: {
+        cone.spread = fmaxf(cone.spread, CONE_DIFFUSE_SPREAD);
+        f32 r1 = 2.0f * PI * rng.gen();
+        f32 r2 = rng.gen(), r2s = sqrtf(r2);
+        Vec3 w = res.norm.dot(ray.d) < 0.0f ? res.norm : -res.norm;
+        Vec3 u = w.orthogonal_unit();
+        Vec3 v = w.cross(u);
+        Vec3 d = (u * cosf(r1) + v * sinf(r1)) * r2s + w * sqrtf(1.0f - r2);
+        ray = {p, d.norm()};
+        break;
+      }
+      case 1: {
+        ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        break;
+      }
+      case 2: {
+        constexpr f32 NA = 1.0f, NG = 1.5f, R0 = (NA - NG) * (NA - NG) / ((NA + NG) * (NA + NG));
+        f32 cos = res.norm.dot(ray.d), sin = sqrtf(1.0f - cos * cos), n;
+        Vec3 norm_d = res.norm;
+        if (cos < 0.0f) {
+          n = NG / NA;
+          cos = -cos;
+          norm_d = -norm_d;
+        } else {
+          n = NA / NG;
+          if (sin >= n) {
+            ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+            break;
+          }
+        }
+        if (rng.gen() < R0 + (1.0f - R0) * powf(1.0f - cos, 5)) {
+          ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        } else {
+          ray = {p, norm_d * (sqrtf(1.0f - sin * sin / (n * n)) - cos / n) + ray.d / n};
+        }
+        break;
+      }
+      case 3: {
+        // the hero chooses between reflection & refraction, reflection is shared by all lanes (weighted by the
+        // fresnel term of each lane), refraction is not, so the other lanes are terminated and the hero represents
+        // all wavelengths
+        f32x4 ng = cauchy_ior(CAUCHY_A, CAUCHY_B, l), r0 = (ng - 1.0f) * (ng - 1.0f) / ((ng + 1.0f) * (ng + 1.0f));
+        f32 cos = res.norm.dot(ray.d), sin = sqrtf(1.0f - cos * cos);
+        Vec3 norm_d = res.norm;
+        f32x4 n = ng;
+        if (cos < 0.0f) {
+          cos = -cos;
+          norm_d = -norm_d;
+        } else {
+          n = 1.0f / ng;
+        }
+        f32x4 r = r0 + (1.0f - r0) * powf(1.0f - cos, 5);
+        for (u32 i = 0; i < SPECTRAL_N; ++i) {
+          if (sin >= n[i]) { r[i] = 1.0f; }
+        }
+        if (rng.gen() < r[0]) {
+          fac *= r / r[0];
+          ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        } else {
+          if (!hero_only) {
+            fac = f32x4{fac[0] * SPECTRAL_N, 0.0f, 0.0f, 0.0f};
+            hero_only = true;
+          }
+          ray = {p, norm_d * (sqrtf(1.0f - sin * sin / (n[0] * n[0])) - cos / n[0]) + ray.d / n[0]};
+        }
+        break;
+      }
+    }"#);
+    this.dec().wln("}");
+    this.wln("return Vec3{};");
+    this.dec().wln("}");
+  }
+
+  fn gen_main(this: &mut CodegenBase<SpectralCodegen>, world: &World) {
+    this.wln(&format!(r#"const u32 W = {}, H = {};"#, world.w, world.h));
+    this.wln(r#"Vec3 output[W * H];
+
+int main(int argc, char **args) {
+  u32 ns = argc > 1 ? std::atoi(args[1]) : (puts("please specify #sample"), exit(-1), 0);"#).inc();
+    if let Sampler::Philox = this.ch.sampler {
+      this.wln("u32 seed = argc > 3 ? std::atoi(args[3]) : 0;");
+    }
+    gen_cpp_camera(this, world);
+    this.dec();
+    let sampler = this.ch.sampler;
+    gen_cpp_pixel_loop(this, sampler, "");
+  }
+
+  fn gen_mesh(this: &mut CodegenBase<SpectralCodegen>, mesh: &Mesh, obj: &Object, bezier: Option<&RotateBezier>) {
+    gen_cpp_mesh(this, mesh, obj, bezier);
+  }
+
+  fn gen_img(this: &mut CodegenBase<SpectralCodegen>, data: &[Vec3], w: u32, h: u32, need_warp: bool, uv_scale: f32) {
+    gen_cpp_img(this, data, w, h, need_warp, uv_scale);
+  }
+
+  fn gen_text(text: Texture) -> String {
+    match text {
+      Texture::Dispersive { .. } => "3".to_owned(),
+      _ => CppCodegen::gen_text(text),
+    }
+  }
+}
+
+pub struct MLTCodegen;
+
+impl BaseFn<MLTCodegen> for MLTCodegen {
+  const NEE: bool = true;
+
+  fn gen_impl(this: &mut CodegenBase<MLTCodegen>, world: &World) {
+    let mut header = File::open("tool/mlt_util.hpp").unwrap();
+    let mut header_content = String::new();
+    let _ = header.read_to_string(&mut header_content);
+    this.wln(&header_content);
+    gen_nee(this, world);
+    this.wln("Vec3 trace(Ray ray, PSSSampler &rng, RayCone cone) {").inc();
+    this.wln("Vec3 fac{1.0f, 1.0f, 1.0f};");
+    Self::gen_trace_loop(this, world);
+    this.dec().wln("}");
+  }
+
+  fn gen_main(this: &mut CodegenBase<MLTCodegen>, world: &World) {
+    this.wln(&format!(r#"const u32 W = {}, H = {};"#, world.w, world.h));
+    this.wln("Vec3 output[W * H];\n");
+    // the pixel position is also a part of the primary sample, so it can be mutated as well
+    this.wln("Vec3 eval_path(PSSSampler &rng, u32 &index) {").inc();
+    let cx = Vec3(world.w as f32 * 0.5135 / world.h as f32, 0.0, 0.0);
+    let cy = cx.cross(world.cam.d).norm() * 0.5135;
+    this.wln(&format!("constexpr Ray cam{{{}, {}}};", cpp_vec3(world.cam.o), cpp_vec3(world.cam.d)));
+    this.wln(&format!("constexpr Vec3 cx{{{}, {}, {}}};", cx.0, cx.1, cx.2));
+    this.wln(&format!("constexpr Vec3 cy{{{}, {}, {}}};", cy.0, cy.1, cy.2));
+    this.wln(r#"f32 fx = rng.gen() * W, fy = rng.gen() * H;
+  index = std::min(u32(fy), H - 1) * W + std::min(u32(fx), W - 1);
+  Vec3 d = cx * (fx / W - 0.5f) + cy * (fy / H - 0.5f) + cam.d;"#);
+    this.wln(&format!("return trace(Ray{{cam.o + d * 14.0f, d.norm()}}, rng, RayCone{{14.0f * d.len() * {0}f, {0}f}});", pixel_spread(world)));
+    this.dec().wln("}\n");
+    this.wln(r#"int main(int argc, char **args) {
+  u32 mpp = argc > 1 ? std::atoi(args[1]) : (puts("please specify #mutation per pixel"), exit(-1), 0);
+  render_mlt(output, W, H, mpp, eval_path);
+  output_png(output, W, H, argc > 2 ? args[2] : "image.png");
+}"#);
+  }
+
+  fn gen_mesh(this: &mut CodegenBase<MLTCodegen>, mesh: &Mesh, obj: &Object, bezier: Option<&RotateBezier>) {
+    gen_cpp_mesh(this, mesh, obj, bezier);
+  }
+
+  fn gen_img(this: &mut CodegenBase<MLTCodegen>, data: &[Vec3], w: u32, h: u32, need_warp: bool, uv_scale: f32) {
+    gen_cpp_img(this, data, w, h, need_warp, uv_scale);
+  }
+}
+
+// path tracing, but caustics (light -> specular/refractive -> diffuse) come from a photon map
+// paths of the form ... diffuse -> specular/refractive -> light are not counted in trace() to avoid double counting
+pub struct CausticCodegen {
+  // the photon gather radius
+  radius: f32,
+}
+
+impl CausticCodegen {
+  pub fn new(radius: f32) -> CausticCodegen {
+    CausticCodegen { radius }
+  }
+}
+
+impl BaseFn<CausticCodegen> for CausticCodegen {
+  fn gen_impl(this: &mut CodegenBase<CausticCodegen>, world: &World) {
+    for path in &["tool/sampler.hpp", "tool/ppm_util.hpp"] {
+      let mut header = File::open(path).unwrap();
+      let mut header_content = String::new();
+      let _ = header.read_to_string(&mut header_content);
+      this.wln(&header_content);
+    }
+    this.wln("HashGrid caustic_grid;\n");
+    Self::gen_scene_hit(this, world);
+    this.wln(r#"void caustic_photon_pass(Ray ray, Vec3 flux, SobolSampler &rng) {
+  bool caustic = false;
+  for (u32 d = 0; d < 20; ++d) {
+    HitRes res{1e10};
+    scene_hit(ray, res, rng);
+    if (res.t == 1e10) { break; }
+    Vec3 p = ray.o + ray.d * res.t;
+    switch (res.text) {
+      case 0: {
+        if (caustic) {
+          caustic_grid.add_hit_point(HitPoint{.fac=Vec3{}, .pos=p, .norm=res.norm, .flux=flux, .r2=0, .n=0, .idx=0});
+        }
+        return;
+      }
+      case 1: {
+        flux = flux.schur(res.col);
+        ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        break;
+      }
+      case 2: {
+        flux = flux.schur(res.col);
+        constexpr f32 NA = 1.0f, NG = 1.5f, R0 = (NA - NG) * (NA - NG) / ((NA + NG) * (NA + NG));
+        f32 cos = res.norm.dot(ray.d), sin = sqrtf(1.0f - cos * cos), n;
+        Vec3 norm_d = res.norm;
+        if (cos < 0.0f) {
+          n = NG / NA;
+          cos = -cos;
+          norm_d = -norm_d;
+        } else {
+          n = NA / NG;
+          if (sin >= n) {
+            ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+            break;
+          }
+        }
+        if (rng.gen() < R0 + (1.0f - R0) * powf(1.0f - cos, 5)) {
+          ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        } else {
+          ray = {p, norm_d * (sqrtf(1.0f - sin * sin / (n * n)) - cos / n) + ray.d / n};
+        }
+        break;
+      }
+    }
+    caustic = true;
+  }
+}
+"#);
+    this.wln("Vec3 trace(Ray ray, XorShiftRNG &rng) {").inc();
+    this.wln("Vec3 fac{1.0f, 1.0f, 1.0f}, rad{};");
+    this.wln("// diffuse: a diffuse surface has been hit, specular: a specular/refractive surface has been hit after that");
+    this.wln("bool diffuse = false, specular = false;");
+    this.wln("for (u32 _ = 0; _ < 16; ++_) {").inc();
+    this.wln("if (fac.len2() <= 1e-4) { break; }");
+    this.wln("TRACE_STAT(path, 1);");
+    this.wln("HitRes res{1e10};");
+    this.wln("scene_hit(ray, res, rng);");
+    this.wln("if (light_hit(ray, res.t)) {").inc();
+    this.wln("if (!(diffuse && specular)) {").inc();
+    this.wln(&format!("rad += fac.schur({});", cpp_vec3(world.light.emission)));
+    this.dec().wln("}");
+    this.wln("break;");
+    this.dec().wln("}");
+    this.wln(&format!(r#"if (res.t == 1e10) {{ break; }}
+    Vec3 p = ray.o + ray.d * res.t;
+    fac = fac.schur(res.col);
+    switch (res.text) {{
+      case 0: {{
+        Vec3 pos = (p - caustic_grid.min) * caustic_grid.inv_grid_size;
+        if (!caustic_grid.hot.empty() && pos.x >= 0.0f && pos.y >= 0.0f && pos.z >= 0.0f) {{
+          u32 h = caustic_grid.hash(u32(pos.x), u32(pos.y), u32(pos.z));
+          Vec3 sum{{}};
+          for (u32 i = caustic_grid.idx[h], end = caustic_grid.idx[h + 1]; i < end; ++i) {{
+            const HitPointHot &ph = caustic_grid.hot[caustic_grid.pool[i]];
+            Vec3 v = ph.pos - p;
+            if (ph.norm.dot(res.norm) > EPS && v.dot(v) <= {r2}f) {{
+              sum += caustic_grid.cold[caustic_grid.pool[i]].flux;
+            }}
+          }}
+          rad += fac.schur(sum) * {inv_area}f;
+        }}
+        diffuse = true, specular = false;
+        f32 r1 = 2.0f * PI * rng.gen();
+        f32 r2 = rng.gen(), r2s = sqrtf(r2);
+        Vec3 w = res.norm.dot(ray.d) < 0.0f ? res.norm : -res.norm;
+        Vec3 u = w.orthogonal_unit();
+        Vec3 v = w.cross(u);
+        Vec3 d = (u * cosf(r1) + v * sinf(r1)) * r2s + w * sqrtf(1.0f - r2);
+        ray = {{p, d.norm()}};
+        break;
+      }}
+      case 1: {{
+        specular = true;
+        ray = {{p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)}};
+        break;
+      }}
+      case 2: {{
+        specular = true;
+        constexpr f32 NA = 1.0f, NG = 1.5f, R0 = (NA - NG) * (NA - NG) / ((NA + NG) * (NA + NG));
+        f32 cos = res.norm.dot(ray.d), sin = sqrtf(1.0f - cos * cos), n;
+        Vec3 norm_d = res.norm;
+        if (cos < 0.0f) {{
+          n = NG / NA;
+          cos = -cos;
+          norm_d = -norm_d;
+        }} else {{
+          n = NA / NG;
+          if (sin >= n) {{
+            ray = {{p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)}};
+            break;
+          }}
+        }}
+        if (rng.gen() < R0 + (1.0f - R0) * powf(1.0f - cos, 5)) {{
+          ray = {{p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)}};
+        }} else {{
+          ray = {{p, norm_d * (sqrtf(1.0f - sin * sin / (n * n)) - cos / n) + ray.d / n}};
+        }}
+        break;
+      }}
+    }}"#, r2 = this.ch.radius * this.ch.radius,
+      // diffuse brdf (1 / PI) * density estimation (1 / (PI * r^2))
+      inv_area = 1.0 / (std::f32::consts::PI * std::f32::consts::PI * this.ch.radius * this.ch.radius)));
+    this.dec().wln("}");
+    this.wln("return rad;");
+    this.dec().wln("}");
+  }
+
+  fn gen_main(this: &mut CodegenBase<CausticCodegen>, world: &World) {
+    this.wln(&format!(r#"const u32 W = {}, H = {};"#, world.w, world.h));
+    this.wln(r#"Vec3 output[W * H];
+
+int main(int argc, char **args) {
+  u32 ns = argc > 1 ? std::atoi(args[1]) : (puts("please specify #sample"), exit(-1), 0);
+  u32 np_1024 = argc > 3 ? std::atoi(args[3]) : 1024;"#).inc();
+    gen_cpp_camera(this, world);
+    this.wln("#pragma omp parallel for schedule(dynamic, 1)");
+    this.wln("for (u32 i = 0; i < np_1024; ++i) {").inc();
+    this.wln("SobolSampler rng{0, i * 1024};");
+    this.wln("for (u32 j = 0; j < 1024; j++, rng.next_sample()) {").inc();
+    match &world.light.geo {
+      LightGeo::Circle(circle) => {
+        // two-sided light, cosine weighted emission on both sides
+        let plane = &circle.plane;
+        let power = world.light.emission * (2.0 * std::f32::consts::PI * std::f32::consts::PI * circle.u.len2());
+        this.wln("f32 th1 = 2 * PI * rng.gen(), r = sqrtf(rng.gen());");
+        this.wln("f32 th2 = 2 * PI * rng.gen(), r2 = rng.gen(), r2s = sqrtf(r2);");
+        this.wln(&format!("Vec3 n = rng.gen() < 0.5f ? {} : -{};", cpp_vec3(plane.n), cpp_vec3(plane.n)));
+        this.wln(&format!("Vec3 d = ({} * cosf(th2) + {} * sinf(th2)) * r2s + n * sqrtf(1.0f - r2);",
+                          cpp_vec3(circle.u.norm()), cpp_vec3(circle.v.norm())));
+        this.wln(&format!("Ray ray{{{} + {} * r * cosf(th1) + {} * r * sinf(th1), d}};",
+                          cpp_vec3(plane.p), cpp_vec3(circle.u), cpp_vec3(circle.v)));
+        this.wln(&format!("caustic_photon_pass(ray, {} / (np_1024 * 1024.0f), rng);", cpp_vec3(power)));
+      }
+    };
+    this.dec().wln("}").dec().wln("}");
+    this.wln("caustic_grid.collect_hit_points();");
+    this.wln(&format!("fprintf(stderr, \"caustic photons: %d\\n\", caustic_grid.size());"));
+    this.wln(&format!("caustic_grid.build({});", this.ch.radius));
+    this.dec();
+    gen_cpp_pixel_loop(this, Sampler::XorShift, "");
+  }
+
+  fn gen_mesh(this: &mut CodegenBase<CausticCodegen>, mesh: &Mesh, obj: &Object, bezier: Option<&RotateBezier>) {
+    gen_cpp_mesh(this, mesh, obj, bezier);
+  }
+
+  fn gen_img(this: &mut CodegenBase<CausticCodegen>, data: &[Vec3], w: u32, h: u32, need_warp: bool, uv_scale: f32) {
+    gen_cpp_img(this, data, w, h, need_warp, uv_scale);
+  }
+}
+
+// path tracing, plus next event estimation through refractive surfaces by manifold walk
+// paths of the form ... diffuse -> refractive{1, MANIFOLD_MAX_INTERFACE} -> light are only counted in the NEE
+pub struct ManifoldCodegen;
+
+impl BaseFn<ManifoldCodegen> for ManifoldCodegen {
+  fn gen_impl(this: &mut CodegenBase<ManifoldCodegen>, world: &World) {
+    let mut header = File::open("tool/manifold_util.hpp").unwrap();
+    let mut header_content = String::new();
+    let _ = header.read_to_string(&mut header_content);
+    this.wln(&header_content);
+    Self::gen_scene_hit(this, world);
+    this.wln("Vec3 trace(Ray ray, XorShiftRNG &rng) {").inc();
+    this.wln("Vec3 fac{1.0f, 1.0f, 1.0f}, rad{};");
+    this.wln("// n_refract: refraction count since the last diffuse hit, other: reflection happened since the last diffuse hit");
+    this.wln("bool diffuse = false, other = false;");
+    this.wln("u32 n_refract = 0;");
+    this.wln("for (u32 _ = 0; _ < 16; ++_) {").inc();
+    this.wln("if (fac.len2() <= 1e-4) { break; }");
+    this.wln("TRACE_STAT(path, 1);");
+    this.wln("HitRes res{1e10};");
+    this.wln("scene_hit(ray, res, rng);");
+    this.wln("if (light_hit(ray, res.t)) {").inc();
+    this.wln("if (!(diffuse && !other && n_refract != 0 && n_refract <= MANIFOLD_MAX_INTERFACE)) {").inc();
+    this.wln(&format!("rad += fac.schur({});", cpp_vec3(world.light.emission)));
+    this.dec().wln("}");
+    this.wln("break;");
+    this.dec().wln("}");
+    this.wln(r#"if (res.t == 1e10) { break; }
+    Vec3 p = ray.o + ray.d * res.t;
+    fac = fac.schur(res.col);
+    switch (res.text) {
+      case 0: {
+        Vec3 w = res.norm.dot(ray.d) < 0.0f ? res.norm : -res.norm;"#);
+    this.inc().inc();
+    match &world.light.geo {
+      LightGeo::Circle(circle) => {
+        let plane = &circle.plane;
+        let (u, v, r) = (circle.u.norm(), circle.v.norm(), circle.u.len());
+        this.wln("auto chain = [&](const Vec3 &d, ManifoldChain &c) {").inc();
+        this.wln("Ray r{p, d};");
+        this.wln("c.trans = Vec3{1.0f, 1.0f, 1.0f}, c.n = 0;");
+        this.wln("while (true) {").inc();
+        this.wln("HitRes h{1e10};");
+        this.wln("scene_hit(r, h, rng);");
+        this.wln(&format!("f32 t = ({} - r.o).dot({}) / r.d.dot({});", cpp_vec3(plane.p), cpp_vec3(plane.n), cpp_vec3(plane.n)));
+        this.wln("if (t > EPS && t < h.t) {").inc();
+        this.wln(&format!("Vec3 q = r.o + r.d * t - {};", cpp_vec3(plane.p)));
+        this.wln(&format!("c.qu = q.dot({}), c.qv = q.dot({});", cpp_vec3(u), cpp_vec3(v)));
+        this.wln("return c.n != 0;");
+        this.dec().wln("}");
+        this.wln(r#"if (h.t == 1e10 || h.text != 2 || c.n == MANIFOLD_MAX_INTERFACE) { return false; }
+          Vec3 out;
+          f32 fresnel;
+          if (!refract_dir(r.d, h.norm, out, fresnel)) { return false; }
+          c.trans = c.trans.schur(h.col) * (1.0f - fresnel);
+          ++c.n;
+          r = {r.o + r.d * h.t, out};"#);
+        this.dec().wln("}");
+        this.dec().wln("};");
+        this.wln("f32 th = 2.0f * PI * rng.gen(), rr = sqrtf(rng.gen());");
+        this.wln(&format!("f32 tu = {r} * rr * cosf(th), tv = {r} * rr * sinf(th);", r = r));
+        this.wln(&format!("Vec3 nd = ({} + {} * tu + {} * tv - p).norm();", cpp_vec3(plane.p), cpp_vec3(u), cpp_vec3(v)));
+        this.wln("ManifoldChain c;");
+        this.wln("f32 inv_det;");
+        this.wln(&format!("if (manifold_solve(nd, tu, tv, chain, c, inv_det, {}) && nd.dot(w) > 0.0f) {{", r * 1e-3)).inc();
+        // diffuse brdf (1 / PI) * cos * emission * |d(solid angle) / d(area)| / pdf(1 / area)
+        this.wln(&format!("rad += fac.schur(c.trans).schur({}) * (nd.dot(w) * inv_det * {});",
+                          cpp_vec3(world.light.emission), r * r));
+        this.dec().wln("}");
+      }
+    };
+    this.dec().dec();
+    this.wln(r#"        diffuse = true, other = false, n_refract = 0;
+        f32 r1 = 2.0f * PI * rng.gen();
+        f32 r2 = rng.gen(), r2s = sqrtf(r2);
+        Vec3 u = w.orthogonal_unit();
+        Vec3 v = w.cross(u);
+        Vec3 d = (u * cosf(r1) + v * sinf(r1)) * r2s + w * sqrtf(1.0f - r2);
+        ray = {p, d.norm()};
+        break;
+      }
+      case 1: {
+        other = true;
+        ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        break;
+      }
+      case 2: {
+        Vec3 out;
+        f32 fresnel;
+        if (refract_dir(ray.d, res.norm, out, fresnel) && rng.gen() >= fresnel) {
+          ++n_refract;
+          ray = {p, out};
+        } else {
+          other = true;
+          ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        }
+        break;
+      }
+    }"#);
+    this.dec().wln("}");
+    this.wln("return rad;");
+    this.dec().wln("}");
+  }
+
+  fn gen_main(this: &mut CodegenBase<ManifoldCodegen>, world: &World) {
+    this.wln(&format!(r#"const u32 W = {}, H = {};"#, world.w, world.h));
+    this.wln(r#"Vec3 output[W * H];
+
+int main(int argc, char **args) {
+  u32 ns = argc > 1 ? std::atoi(args[1]) : (puts("please specify #sample"), exit(-1), 0);"#).inc();
+    gen_cpp_camera(this, world);
+    this.dec();
+    gen_cpp_pixel_loop(this, Sampler::XorShift, "");
+  }
+
+  fn gen_mesh(this: &mut CodegenBase<ManifoldCodegen>, mesh: &Mesh, obj: &Object, bezier: Option<&RotateBezier>) {
+    gen_cpp_mesh(this, mesh, obj, bezier);
+  }
+
+  fn gen_img(this: &mut CodegenBase<ManifoldCodegen>, data: &[Vec3], w: u32, h: u32, need_warp: bool, uv_scale: f32) {
+    gen_cpp_img(this, data, w, h, need_warp, uv_scale);
+  }
+}
+
+// path tracing, diffuse bounces are sampled from the incident radiance learned in previous passes
+// only the image of the last pass is output
+pub struct GuidingCodegen {
+  // bound of the spatial tree, like PPMCodeGen
+  min: Vec3,
+  max: Vec3,
+}
+
+impl GuidingCodegen {
+  pub fn new(min: Vec3, max: Vec3) -> GuidingCodegen {
+    GuidingCodegen { min, max }
+  }
+}
+
+impl BaseFn<GuidingCodegen> for GuidingCodegen {
+  fn gen_impl(this: &mut CodegenBase<GuidingCodegen>, world: &World) {
+    let mut header = File::open("tool/guiding_util.hpp").unwrap();
+    let mut header_content = String::new();
+    let _ = header.read_to_string(&mut header_content);
+    this.wln(&header_content);
+    this.wln(&format!("STree stree{{{}, {}}};", cpp_vec3(this.ch.min), cpp_vec3(this.ch.max)));
+    this.wln("bool learning = true;\n");
+    Self::gen_scene_hit(this, world);
+    this.wln("Vec3 trace(Ray ray, XorShiftRNG &rng) {").inc();
+    this.wln("Vec3 fac{1.0f, 1.0f, 1.0f}, rad{};");
+    this.wln("GuidingVertex verts[16];");
+    this.wln("u32 n_vert = 0;");
+    this.wln("for (u32 _ = 0; _ < 16; ++_) {").inc();
+    this.wln("if (fac.len2() <= 1e-4) { break; }");
+    this.wln("TRACE_STAT(path, 1);");
+    this.wln("HitRes res{1e10};");
+    this.wln("scene_hit(ray, res, rng);");
+    this.wln("if (light_hit(ray, res.t)) {").inc();
+    this.wln(&format!("rad = fac.schur({});", cpp_vec3(world.light.emission)));
+    this.wln("break;");
+    this.dec().wln("}");
+    this.wln(r#"if (res.t == 1e10) { break; }
+    Vec3 p = ray.o + ray.d * res.t;
+    fac = fac.schur(res.col);
+    switch (res.text) {
+      case 0: {
+        Vec3 w = res.norm.dot(ray.d) < 0.0f ? res.norm : -res.norm, d;
+        GuidingLeaf &leaf = stree.lookup(p);
+        f32 pdf;
+        if (!guiding_sample(leaf, w, rng, d, pdf)) {
+          fac = Vec3{};
+          break;
+        }
+        // diffuse brdf (1 / PI) * cos / pdf, it is exactly 1 for cosine sampling
+        fac *= d.dot(w) / (PI * pdf);
+        if (learning) {
+          verts[n_vert++] = GuidingVertex{&leaf, dir_to_square(d), fac, pdf};
+        }
+        ray = {p, d};
+        break;
+      }
+      case 1: {
+        ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        break;
+      }
+      case 2: {
+        constexpr f32 NA = 1.0f, NG = 1.5f, R0 = (NA - NG) * (NA - NG) / ((NA + NG) * (NA + NG));
+        f32 cos = res.norm.dot(ray.d), sin = sqrtf(1.0f - cos * cos), n;
+        Vec3 norm_d = res.norm;
+        if (cos < 0.0f) {
+          n = NG / NA;
+          cos = -cos;
+          norm_d = -norm_d;
+        } else {
+          n = NA / NG;
+          if (sin >= n) {
+            ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+            break;
+          }
+        }
+        if (rng.gen() < R0 + (1.0f - R0) * powf(1.0f - cos, 5)) {
+          ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        } else {
+          ray = {p, norm_d * (sqrtf(1.0f - sin * sin / (n * n)) - cos / n) + ray.d / n};
+        }
+        break;
+      }
+    }"#);
+    this.dec().wln("}");
+    this.wln("if (learning) {").inc();
+    this.wln("guiding_record(verts, n_vert, rad);");
+    this.dec().wln("}");
+    this.wln("return rad;");
+    this.dec().wln("}");
+  }
+
+  fn gen_main(this: &mut CodegenBase<GuidingCodegen>, world: &World) {
+    this.wln(&format!(r#"const u32 W = {}, H = {};"#, world.w, world.h));
+    this.wln("Vec3 output[W * H];\n");
+    this.wln("void render_pass(u32 ns, u32 pass) {").inc();
+    gen_cpp_camera(this, world);
+    this.wln(r#"#pragma omp parallel for schedule(dynamic, 1)
+  for (u32 y = 0; y < H; ++y) {
+    fprintf(stderr, "\rrendering pass %d %5.2f%%", pass, 100.0f * y / (H - 1));
+    for (u32 x = 0; x < W; ++x) {
+      u32 index = y * W + x;
+      Vec3 sum{};
+      XorShiftRNG rng{pass * W * H + index};
+      for (u32 s = 0; s < ns / 4; ++s) {
+        for (u32 sx = 0; sx < 2; ++sx) {
+          for (u32 sy = 0; sy < 2; ++sy) {
+            f32 r1 = 2.0f * rng.gen(), r2 = 2.0f * rng.gen();
+            f32 dx = r1 < 1.0f ? sqrtf(r1) - 1.0f : 1.0f - sqrtf(2.0f - r1);
+            f32 dy = r2 < 1.0f ? sqrtf(r2) - 1.0f : 1.0f - sqrtf(2.0f - r2);
+            Vec3 d = cx * (((sx + 0.5f + dx) * 0.5f + x) / W - 0.5f) +
+                     cy * (((sy + 0.5f + dy) * 0.5f + y) / H - 0.5f) + cam.d;
+            sum += trace(Ray{cam.o + d * 14.0f, d.norm()}, rng);
+          }
+        }
+      }
+      output[index] = sum / ns;
+    }
+  }
+  fprintf(stderr, "\n");"#);
+    this.dec().wln("}\n");
+    this.wln(r#"int main(int argc, char **args) {
+  u32 ns = argc > 1 ? std::atoi(args[1]) : (puts("please specify #sample"), exit(-1), 0);
+  // learning passes use 4, 8, 16... spp, until half of the budget is used, the rest renders the final image
+  u32 used = 0, pass = 0;
+  for (u32 spp = 4; used + spp <= ns / 2; used += spp, spp *= 2, ++pass) {
+    render_pass(spp, pass);
+    stree.refine(pass);
+    fprintf(stderr, "guiding: %d spatial leaves\n", u32(stree.leaves.size()));
+  }
+  learning = false;
+  render_pass(std::max(ns - used, 4u) / 4 * 4, pass);
+  output_png(output, W, H, argc > 2 ? args[2] : "image.png");
+}"#);
+  }
+
+  fn gen_mesh(this: &mut CodegenBase<GuidingCodegen>, mesh: &Mesh, obj: &Object, bezier: Option<&RotateBezier>) {
+    gen_cpp_mesh(this, mesh, obj, bezier);
+  }
+
+  fn gen_img(this: &mut CodegenBase<GuidingCodegen>, data: &[Vec3], w: u32, h: u32, need_warp: bool, uv_scale: f32) {
+    gen_cpp_img(this, data, w, h, need_warp, uv_scale);
+  }
+}
+
+// path tracing, but the radiance of the second diffuse hit comes from an irradiance cache instead of recursing
+// the cache is filled lazily while rendering, a new record is computed by path tracing without the cache
+pub struct IrradianceCodegen {
+  // clamp of the record radius
+  r_min: f32,
+  r_max: f32,
+}
+
+impl IrradianceCodegen {
+  pub fn new(r_min: f32, r_max: f32) -> IrradianceCodegen {
+    IrradianceCodegen { r_min, r_max }
+  }
+}
+
+impl BaseFn<IrradianceCodegen> for IrradianceCodegen {
+  fn gen_impl(this: &mut CodegenBase<IrradianceCodegen>, world: &World) {
+    let mut header = File::open("tool/irradiance_util.hpp").unwrap();
+    let mut header_content = String::new();
+    let _ = header.read_to_string(&mut header_content);
+    this.wln(&header_content);
+    this.wln(&format!("IrradianceCache icache{{{}, {}}};\n", this.ch.r_min, this.ch.r_max));
+    Self::gen_scene_hit(this, world);
+    // plain path tracing, dist is the distance of the first hit
+    this.wln("Vec3 trace_pt(Ray ray, XorShiftRNG &rng, f32 &dist) {").inc();
+    this.wln("Vec3 fac{1.0f, 1.0f, 1.0f};");
+    this.wln("dist = 1e10;");
+    this.wln("// the rays of the cache leave a diffuse surface");
+    this.wln("RayCone cone{0.0f, CONE_DIFFUSE_SPREAD};");
+    this.wln("for (u32 _ = 0; _ < 16; ++_) {").inc();
+    this.wln("if (fac.len2() <= 1e-4) { return Vec3{}; }");
+    this.wln("TRACE_STAT(path, 1);");
+    this.wln("HitRes res{1e10};");
+    this.wln("scene_hit(ray, res, rng, cone);");
+    this.wln("if (_ == 0) { dist = res.t; }");
+    this.wln(&format!("if (light_hit(ray, res.t)) {{ return fac.schur({}); }}", cpp_vec3(world.light.emission)));
+    Self::gen_handle_text(this, false, false);
+    this.dec().wln("}");
+    this.wln("return Vec3{};");
+    this.dec().wln("}\n");
+    this.wln("Vec3 trace(Ray ray, XorShiftRNG &rng) {").inc();
+    this.wln("Vec3 fac{1.0f, 1.0f, 1.0f};");
+    this.wln("bool diffuse = false;");
+    this.wln("for (u32 _ = 0; _ < 16; ++_) {").inc();
+    this.wln("if (fac.len2() <= 1e-4) { return Vec3{}; }");
+    this.wln("TRACE_STAT(path, 1);");
+    this.wln("HitRes res{1e10};");
+    this.wln("scene_hit(ray, res, rng);");
+    this.wln(&format!("if (light_hit(ray, res.t)) {{ return fac.schur({}); }}", cpp_vec3(world.light.emission)));
+    this.wln(r#"if (res.t == 1e10) { break; }
+    Vec3 p = ray.o + ray.d * res.t;
+    fac = fac.schur(res.col);
+    switch (res.text) {
+      case 0: {
+        Vec3 w = res.norm.dot(ray.d) < 0.0f ? res.norm : -res.norm;
+        if (diffuse) {
+          // diffuse brdf (1 / PI) * irradiance
+          Vec3 e = icache.get(p, w, rng, [&](const Ray &r, f32 &dist) { return trace_pt(r, rng, dist); });
+          return fac.schur(e) * (1.0f / PI);
+        }
+        diffuse = true;
+        f32 r1 = 2.0f * PI * rng.gen();
+        f32 r2 = rng.gen(), r2s = sqrtf(r2);
+        Vec3 u = w.orthogonal_unit();
+        Vec3 v = w.cross(u);
+        Vec3 d = (u * cosf(r1) + v * sinf(r1)) * r2s + w * sqrtf(1.0f - r2);
+        ray = {p, d.norm()};
+        break;
+      }
+      case 1: {
+        ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        break;
+      }
+      case 2: {
+        constexpr f32 NA = 1.0f, NG = 1.5f, R0 = (NA - NG) * (NA - NG) / ((NA + NG) * (NA + NG));
+        f32 cos = res.norm.dot(ray.d), sin = sqrtf(1.0f - cos * cos), n;
+        Vec3 norm_d = res.norm;
+        if (cos < 0.0f) {
+          n = NG / NA;
+          cos = -cos;
+          norm_d = -norm_d;
+        } else {
+          n = NA / NG;
+          if (sin >= n) {
+            ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+            break;
+          }
+        }
+        if (rng.gen() < R0 + (1.0f - R0) * powf(1.0f - cos, 5)) {
+          ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        } else {
+          ray = {p, norm_d * (sqrtf(1.0f - sin * sin / (n * n)) - cos / n) + ray.d / n};
+        }
+        break;
+      }
+    }"#);
+    this.dec().wln("}");
+    this.wln("return Vec3{};");
+    this.dec().wln("}");
+  }
+
+  fn gen_main(this: &mut CodegenBase<IrradianceCodegen>, world: &World) {
+    this.wln(&format!(r#"const u32 W = {}, H = {};"#, world.w, world.h));
+    this.wln(r#"Vec3 output[W * H];
+
+int main(int argc, char **args) {
+  u32 ns = argc > 1 ? std::atoi(args[1]) : (puts("please specify #sample"), exit(-1), 0);"#).inc();
+    gen_cpp_camera(this, world);
+    this.dec();
+    gen_cpp_pixel_loop(this, Sampler::XorShift, "  icache.print_info();\n");
+  }
+
+  fn gen_mesh(this: &mut CodegenBase<IrradianceCodegen>, mesh: &Mesh, obj: &Object, bezier: Option<&RotateBezier>) {
+    gen_cpp_mesh(this, mesh, obj, bezier);
+  }
+
+  fn gen_img(this: &mut CodegenBase<IrradianceCodegen>, data: &[Vec3], w: u32, h: u32, need_warp: bool, uv_scale: f32) {
+    gen_cpp_img(this, data, w, h, need_warp, uv_scale);
+  }
+}
+
+pub struct CudaCodegen {
+  img_wh: Vec<(u32, u32)>,
+}
+
+impl CudaCodegen {
+  pub fn new() -> CudaCodegen {
+    CudaCodegen { img_wh: Vec::new() }
+  }
+}
+
+impl BaseFn<CudaCodegen> for CudaCodegen {
+  fn gen_impl(this: &mut CodegenBase<CudaCodegen>, world: &World) {
+    assert!(world.env_map.is_none(), "env map is only supported by CPU backends");
+    this.wln("DEVICE Vec3 trace_impl(Ray ray, XorShiftRNG &rng, RayCone cone) {").inc();
+    this.wln("Vec3 fac{1.0f, 1.0f, 1.0f};");
+    Self::gen_trace_loop(this, world);
+    this.dec().wln("}\n");
+
+    this.wln("GLOBAL void trace(Vec3 *gpu_output, u32 ns) {").inc();
+    let cx = Vec3(world.w as f32 * 0.5135 / world.h as f32, 0.0, 0.0);
+    let cy = cx.cross(world.cam.d).norm() * 0.5135;
+    this.wln(&format!("constexpr Ray cam{{{}, {}}};", cpp_vec3(world.cam.o), cpp_vec3(world.cam.d)));
+    this.wln(&format!("constexpr Vec3 cx{{{}, {}, {}}};", cx.0, cx.1, cx.2));
+    this.wln(&format!("constexpr Vec3 cy{{{}, {}, {}}};", cy.0, cy.1, cy.2)).dec();
+    this.wln(&format!(r#"
+  u32 x = blockIdx.x, y = blockIdx.y, th = threadIdx.x;
+  u32 index = y * {w} + x;
+  XorShiftRNG rng{{index + th * 19260817}};
+  Vec3 sum{{}};
+  for (u32 s = 0; s < ns / (CUDA_BLOCK_SIZE * 4); ++s) {{
+    for (u32 sx = 0; sx < 2; ++sx) {{
+      for (u32 sy = 0; sy < 2; ++sy) {{
+        f32 r1 = 2.0f * rng.gen(), r2 = 2.0f * rng.gen();
+        f32 dx = r1 < 1.0f ? sqrtf(r1) - 1.0f : 1.0f - sqrtf(2.0f - r1);
+        f32 dy = r2 < 1.0f ? sqrtf(r2) - 1.0f : 1.0f - sqrtf(2.0f - r2);
+        Vec3 d = cx * (((sx + 0.5f + dx) * 0.5f + x) / {w} - 0.5f) + cy * (((sy + 0.5f + dy) * 0.5f + y) / {h} - 0.5f) + cam.d;
+        sum += trace_impl(Ray{{cam.o, d.norm()}}, rng, RayCone{{0.0f, {spread}f}});
+      }}
+    }}
+  }}
+  sum /= ns;
+  atomicAdd(&gpu_output[index].x, sum.x);
+  atomicAdd(&gpu_output[index].y, sum.y);
+  atomicAdd(&gpu_output[index].z, sum.z);
+}}"#, w = world.w, h = world.h, spread = pixel_spread(world)));
+  }
+
+  fn gen_main(this: &mut CodegenBase<CudaCodegen>, world: &World) {
+    this.wln(&format!("Vec3 cpu_output[{}];", world.w * world.h));
+    for i in 0..this.mesh_id {
+      this.wln(&format!("CONSTANT const KDNode * __restrict__ gpu_mesh{};", i));
+    }
+    for i in 0..this.ch.img_wh.len() {
+      this.wln(&format!("texture<float4, 2, cudaReadModeElementType> gpu_img{};", i));
+      this.wln(&format!("cudaArray *gpu_img{}_arr;", i));
+    }
+    this.wln("");
+    this.wln("void init_res() {").inc();
+    for i in 0..this.mesh_id {
+      this.wln(&format!(r#"extern const u8 _binary_{p}mesh{i}_start;
+  extern const u8 _binary_{p}mesh{i}_end;
+  KDNode *gpu_mesh{i}_tmp;
+  cudaMalloc(&gpu_mesh{i}_tmp, &_binary_{p}mesh{i}_end - &_binary_{p}mesh{i}_start);
+  cudaMemcpy(gpu_mesh{i}_tmp, &_binary_{p}mesh{i}_start, &_binary_{p}mesh{i}_end - &_binary_{p}mesh{i}_start, cudaMemcpyHostToDevice);
+  cudaMemcpyToSymbol(gpu_mesh{i}, &gpu_mesh{i}_tmp, sizeof(KDNode *));"#, i = i, p = this.prefix));
+    }
+    for (i, (w, h)) in this.ch.img_wh.clone().iter().enumerate() {
+      this.wln(&format!(r#"extern const u8 _binary_{p}img{i}_start;
+  extern const u8 _binary_{p}img{i}_end;
+  cudaChannelFormatDesc desc{i} = cudaCreateChannelDesc<float4>();
+  cudaMallocArray(&gpu_img{i}_arr, &desc{i}, {w}, {h});
+  cudaMemcpyToArray(gpu_img{i}_arr, 0, 0, &_binary_{p}img{i}_start, &_binary_{p}img{i}_end - &_binary_{p}img{i}_start, cudaMemcpyHostToDevice);
+  gpu_img{i}.addressMode[0] = cudaAddressModeWrap;
+  gpu_img{i}.addressMode[1] = cudaAddressModeWrap;
+  gpu_img{i}.filterMode = cudaFilterModeLinear;
+  gpu_img{i}.normalized = true;
+  cudaBindTextureToArray(gpu_img{i}, gpu_img{i}_arr, desc{i});
+  "#, i = i, w = *w, h = *h, p = this.prefix));
+    }
+    this.dec().wln("}\n");
+    this.wln("void free_res() {").inc();
+    for i in 0..this.mesh_id {
+      this.wln(&format!(r#"KDNode *gpu_mesh{i}_tmp;
+  cudaMemcpyFromSymbol(&gpu_mesh{i}_tmp, gpu_mesh{}, sizeof(KDNode *));
+  cudaFree(gpu_mesh{i}_tmp);"#, i = i));
+    }
+    for i in 0..this.ch.img_wh.len() {
+      this.wln(&format!("cudaFreeArray(gpu_img{}_arr);", i));
+    }
+    this.dec().wln("}\n");
+    this.wln(&format!(r#"int main(int argc, char **args) {{
+  u32 ns = argc > 1 ? atoi(args[1]) : (puts("please specify #sample"), exit(-1), 0);
+  ns = (ns + (CUDA_BLOCK_SIZE * 4) - 1) / (CUDA_BLOCK_SIZE * 4) * (CUDA_BLOCK_SIZE * 4);
+  init_res();
+  Vec3 *gpu_output;
+  cudaMalloc(&gpu_output, {wh} * sizeof(Vec3));
+  trace<<<dim3({}, {}, 1), CUDA_BLOCK_SIZE>>>(gpu_output, ns);
+  cudaMemcpy(cpu_output, gpu_output, {wh} * sizeof(Vec3), cudaMemcpyDeviceToHost);
+  cudaFree(gpu_output);
+  free_res();
+  CUDA_CHECK_ERROR(cudaGetLastError());
+  output_png(cpu_output, {w}, {h}, argc > 2 ? args[2] : "image.png");
+}}"#, w = world.w, h = world.h, wh = world.w * world.h));
+  }
+
+  fn gen_mesh(this: &mut CodegenBase<CudaCodegen>, mesh: &Mesh, obj: &Object, _bezier: Option<&RotateBezier>) {
+    let id = this.mesh_id;
+    this.mesh_id += 1;
+    this.wln(&format!("extern CONSTANT const KDNode * __restrict__ gpu_mesh{};", id));
+    gen_mesh_obj(&this.blob(&format!("mesh{}", id)), mesh, obj);
+    {}
+    match &obj.color {
+      Color::Image { data, w, h } => {
+        this.wln(&format!("if (kd_node_hit(gpu_mesh{}, ray, res, {}, {})) {{", id, Self::gen_text(obj.texture), cpp_vec3(Vec3(-1.0, 0.0, 0.0)))).inc();
+        this.wln("f32 u = res.col.x;");
+        this.wln("f32 v = res.col.y;");
+        Self::gen_img(this, data, *w, *h, false, 0.0);
+        this.dec().wln("}");
+      }
+      Color::RGB(rgb) => {
+        this.wln(&format!("kd_node_hit(gpu_mesh{}, ray, res, {}, {});", id, Self::gen_text(obj.texture), cpp_vec3(*rgb)));
+      }
+    };
+  }
+
+  fn gen_img(this: &mut CodegenBase<CudaCodegen>, data: &[Vec3], w: u32, h: u32, _need_warp: bool, _uv_scale: f32) {
+    let id = this.ch.img_wh.len() as u32;
+    this.ch.img_wh.push((w, h));
+    this.wln(&format!("extern texture<float4, 2, cudaReadModeElementType> gpu_img{};", id));
+    this.wln(&format!("res.col = Vec3::from_float4(tex2D(gpu_img{}, u, v));", id));
+    gen_img_obj(&this.blob(&format!("img{}", id)), data);
   }
 }
 
@@ -697,11 +2138,13 @@ impl PPMCodeGen {
 
 impl BaseFn<PPMCodeGen> for PPMCodeGen {
   fn gen_impl(this: &mut CodegenBase<PPMCodeGen>, world: &World) {
-    let mut header = File::open("tool/ppm_util.hpp").unwrap();
-    let mut header_content = String::new();
-    let _ = header.read_to_string(&mut header_content);
-    this.wln(&header_content);
-    this.wln("void hit_point_pass(Ray ray, Vec3 fac, u32 dep, u32 index) {").inc();
+    for path in &["tool/sampler.hpp", "tool/ppm_util.hpp"] {
+      let mut header = File::open(path).unwrap();
+      let mut header_content = String::new();
+      let _ = header.read_to_string(&mut header_content);
+      this.wln(&header_content);
+    }
+    this.wln("void hit_point_pass(Ray ray, Vec3 fac, u32 dep, u32 index, RayCone cone) {").inc();
     this.wln("for (; dep < 20; ++dep) {").inc();
     this.wln("HitRes res{1e10};");
     for obj in &world.objs {
@@ -712,11 +2155,10 @@ impl BaseFn<PPMCodeGen> for PPMCodeGen {
     if (p.x < {} - EPS || p.y < {} - EPS || p.z < {} - EPS || p.x > {} + EPS || p.y > {} + EPS || p.z > {} + EPS) {{ return; }}
     "#, this.ch.min.0, this.ch.min.1, this.ch.min.2, this.ch.max.0, this.ch.max.1, this.ch.max.2));
     this.wln(r"fac = fac.schur(res.col);
+    cone.w = cone.width(res.t);
     switch (res.text) {
       case 0: {
-        grid.mu.lock();
-        grid.hps.push_back(HitPoint{.fac=fac, .pos=p, .norm=res.norm, .flux=Vec3{}, .r2=0, .n=0, .idx = index});
-        grid.mu.unlock();
+        grid.add_hit_point(HitPoint{.fac=fac, .pos=p, .norm=res.norm, .flux=Vec3{}, .r2=0, .n=0, .idx = index});
         return;
       }
       case 1: {
@@ -739,7 +2181,7 @@ impl BaseFn<PPMCodeGen> for PPMCodeGen {
           }
         }
         f32 prob = R0 + (1.0f - R0) * powf(1.0f - cos, 5);
-        hit_point_pass({p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)}, fac * prob, dep + 1, index);
+        hit_point_pass({p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)}, fac * prob, dep + 1, index, cone);
         ray = {p, norm_d * (sqrtf(1.0f - sin * sin / (n * n)) - cos / n) + ray.d / n};
         fac *= (1 - prob);
         break;
@@ -749,7 +2191,9 @@ impl BaseFn<PPMCodeGen> for PPMCodeGen {
     this.ch.pass = 1;
     this.img_id = 0;
     this.mesh_id = 0;
-    this.wln("void photon_pass(Ray ray, Vec3 flux, u32 seed) {").inc();
+    this.wln("void photon_pass(Ray ray, Vec3 flux, SobolSampler &rng) {").inc();
+    // photons have no footprint, so they always read the finest level
+    this.wln("constexpr RayCone cone{};");
     this.wln("Vec3 fac{1.0f, 1.0f, 1.0f};");
     this.wln("for (u32 d = 0; d < 20; ++d) {").inc();
     this.wln("HitRes res{1e10};");
@@ -758,26 +2202,22 @@ impl BaseFn<PPMCodeGen> for PPMCodeGen {
     }
     this.wln(&format!(r#"if (res.t == 1e10) {{ break; }}
     Vec3 p = ray.o + ray.d * res.t;
-    if (p.x < {} - EPS || p.y < {} - EPS || p.z < {} - EPS || p.x > {} + EPS || p.y > {} + EPS || p.z > {} + EPS) {{ return; }}
-    u32 d3 = d * 3 + 5;"#, this.ch.min.0, this.ch.min.1, this.ch.min.2, this.ch.max.0, this.ch.max.1, this.ch.max.2));
+    if (p.x < {} - EPS || p.y < {} - EPS || p.z < {} - EPS || p.x > {} + EPS || p.y > {} + EPS || p.z > {} + EPS) {{ return; }}"#, this.ch.min.0, this.ch.min.1, this.ch.min.2, this.ch.max.0, this.ch.max.1, this.ch.max.2));
     this.wln(r#"switch (res.text) {
       case 0: {
         Vec3 pos = (p - grid.min) * grid.inv_grid_size;
         u32 h = grid.hash(u32(pos.x), u32(pos.y), u32(pos.z));
         for (u32 i = grid.idx[h], end = grid.idx[h + 1]; i < end; ++i) {
-          HitPoint *hp = grid.pool[i];
-          Vec3 v = hp->pos - p;
-          if (hp->norm.dot(res.norm) > EPS && v.dot(v) <= hp->r2) {
-            f32 g = (hp->n * ALPHA + ALPHA) / (hp->n * ALPHA + 1.0);
-            hp->r2 = hp->r2 * g;
-            ++hp->n;
-            hp->flux = (hp->flux + hp->fac.schur(flux) * (1 / PI)) * g;
+          const HitPointHot &hp = grid.hot[grid.pool[i]];
+          Vec3 v = hp.pos - p;
+          if (hp.norm.dot(res.norm) > EPS && v.dot(v) <= hp.r2) {
+            grid.add_photon(grid.pool[i], grid.cold[grid.pool[i]].fac.schur(flux) * (1 / PI));
           }
         }
         f32 prob = res.col.x > res.col.y && res.col.x > res.col.z ? res.col.x : res.col.y > res.col.z ? res.col.y : res.col.z;
-        if (hal[d3 + 1].gen(seed) < prob) {
+        if (rng.gen() < prob) {
           flux = flux.schur(res.col) / prob;
-          f32 r1 = 2 * PI * hal[d3 - 1].gen(seed), r2 = hal[d3].gen(seed), r2s = sqrtf(r2);
+          f32 r1 = 2 * PI * rng.gen(), r2 = rng.gen(), r2s = sqrtf(r2);
           Vec3 w = res.norm.dot(ray.d) < 0.0f ? res.norm : -res.norm;
           Vec3 u = w.orthogonal_unit();
           Vec3 v = w.cross(u);
@@ -809,7 +2249,7 @@ impl BaseFn<PPMCodeGen> for PPMCodeGen {
             break;
           }
         }
-        if (hal[d3 - 1].gen(seed) < R0 + (1.0f - R0) * powf(1.0f - cos, 5)) {
+        if (rng.gen() < R0 + (1.0f - R0) * powf(1.0f - cos, 5)) {
           ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
         } else {
           ray = {p, norm_d * (sqrtf(1.0f - sin * sin / (n * n)) - cos / n) + ray.d / n};
@@ -830,44 +2270,59 @@ int main(int argc, char **args) {
     let cy = cx.cross(world.cam.d).norm() * 0.5135;
     this.wln(&format!("constexpr Ray cam{{{}, {}}};", cpp_vec3(world.cam.o), cpp_vec3(world.cam.d)));
     this.wln(&format!("constexpr Vec3 cx{{{}, {}, {}}};", cx.0, cx.1, cx.2));
-    this.wln(&format!("constexpr Vec3 cy{{{}, {}, {}}};", cy.0, cy.1, cy.2)).dec();
-    this.wln(r#"#pragma omp parallel for schedule(dynamic, 1)
+    this.wln(&format!("constexpr Vec3 cy{{{}, {}, {}}};", cy.0, cy.1, cy.2));
+    this.wln(&format!("constexpr f32 PIXEL_SPREAD = {};", pixel_spread(world))).dec();
+    // static schedule & per thread buffers make hit points in the same order every time
+    this.wln(r#"#pragma omp parallel for schedule(static, 1)
   for (u32 y = 0; y < H; ++y) {
     fprintf(stdout, "\rrendering: hit point pass %5.2f%%", 100.0 * y / (H - 1));
     for (u32 x = 0; x < W; ++x) {
       u32 index = y * W + x;
+      SobolSampler rng{0, index};
       for (u32 sx = 0; sx < 2; ++sx) {
         for (u32 sy = 0; sy < 2; ++sy) {
-          f32 r1 = 2.0f * hal[sx * 4 + sy * 2].gen(index), r2 = 2.0f * hal[sx * 4 + sy * 2 + 1].gen(index);
+          f32 r1 = 2.0f * rng.gen(), r2 = 2.0f * rng.gen();
           f32 dx = r1 < 1.0f ? sqrtf(r1) - 1.0f : 1.0f - sqrtf(2.0f - r1);
           f32 dy = r2 < 1.0f ? sqrtf(r2) - 1.0f : 1.0f - sqrtf(2.0f - r2);
           Vec3 d = cx * (((sx + 0.5f + dx) * 0.5f + x) / W - 0.5f)
                    + cy * (((sy + 0.5f + dy) * 0.5f + y) / H - 0.5f) + cam.d;
-          hit_point_pass(Ray{cam.o + d * 14.0f, d.norm()}, Vec3{0.25, 0.25, 0.25}, 0, index);
+          hit_point_pass(Ray{cam.o + d * 14.0f, d.norm()}, Vec3{0.25, 0.25, 0.25}, 0, index,
+                         RayCone{14.0f * d.len() * PIXEL_SPREAD, PIXEL_SPREAD});
         }
       }
     }
   }
   fprintf(stderr, "\n");
+  grid.collect_hit_points();
   grid.rebuild(W, H);"#);
-    this.wln("#pragma omp parallel for schedule(dynamic, 1)").inc();
-    this.wln("for (u32 i = 0; i < np_1024; ++i) {").inc();
-    this.wln(r#"fprintf(stdout, "\rrendering: photon pass %5.2f%%", 100.0f * i / (np_1024 - 1));"#);
-    this.wln("u32 base = i * 1024;");
-    this.wln("for (u32 j = 0; j < 1024; j++) {").inc();
+    // passes grow from 1 (* 1024 photons) to PPM_PASS_1024, so radii shrink fast at the beginning
+    this.inc().wln("for (u32 pass = 0, len = 1; pass < np_1024; pass += len, len = std::min(len * 2, PPM_PASS_1024)) {").inc();
+    this.wln(r#"fprintf(stdout, "\rrendering: photon pass %5.2f%%", 100.0f * pass / np_1024);"#);
+    this.wln("#pragma omp parallel for schedule(static, 1)");
+    this.wln("for (u32 i = pass; i < std::min(pass + len, np_1024); ++i) {").inc();
+    this.wln("SobolSampler rng{0, i * 1024};");
+    this.wln("for (u32 j = 0; j < 1024; j++, rng.next_sample()) {").inc();
     match &world.light.geo {
       LightGeo::Circle(circle) => {
         let plane = &circle.plane;
-        this.wln("f32 th1 = 2 * PI * hal[0].gen(base + j), r = sqrtf(hal[1].gen(base + j));");
-        this.wln("f32 th2 = 2 * PI * hal[2].gen(base + j), th3 = 2 * acosf(sqrtf(1 - hal[3].gen(base + j)));");
+        this.wln("f32 th1 = 2 * PI * rng.gen(), r = sqrtf(rng.gen());");
+        this.wln("f32 th2 = 2 * PI * rng.gen(), th3 = 2 * acosf(sqrtf(1 - rng.gen()));");
         this.wln(&format!("Ray ray{{{} + {} * r * cosf(th1) + {} * r * sinf(th1), Vec3{{cosf(th2) * sinf(th3), cosf(th3), sinf(th2) * sinf(th3)}}}};",
                           cpp_vec3(plane.p), cpp_vec3(circle.u), cpp_vec3(circle.v)));
-        this.wln("photon_pass(ray, Vec3{25, 25, 25} * (PI * 4.0), base + j);");
+        this.wln("photon_pass(ray, Vec3{25, 25, 25} * (PI * 4.0), rng);");
       }
     };
     this.dec().wln("}").dec().wln("}");
-    this.wln(r#"for (auto &hp : grid.hps) {
-    output[hp.idx] += hp.flux * (1.0f / (PI * hp.r2 * np_1024 * 1000.0f));
+    this.wln("grid.end_pass();");
+    this.dec().wln("}").dec();
+    this.wln(r#"// summed in the order the hit points were collected, build() sorted them by cell
+  std::vector<u32> rank(grid.size());
+  for (u32 i = 0; i < grid.size(); ++i) {
+    rank[grid.order[i]] = i;
+  }
+  for (u32 j = 0; j < grid.size(); ++j) {
+    u32 i = rank[j];
+    output[grid.cold[i].idx] += grid.cold[i].flux * (1.0f / (PI * grid.hot[i].r2 * np_1024 * 1000.0f));
   }
   output_png(output, W, H, argc > 2 ? args[2] : "image.png");
   fprintf(stdout, "\n");
@@ -877,38 +2332,437 @@ int main(int argc, char **args) {
 
   // copied CppCodeGen::gen_mesh
   fn gen_mesh(this: &mut CodegenBase<PPMCodeGen>, mesh: &Mesh, obj: &Object, _bezier: Option<&RotateBezier>) {
-    let id = this.mesh_id;
+    let blob = this.blob(&format!("mesh{}", this.mesh_id));
     this.mesh_id += 1;
-    this.wln(&format!("extern const KDNode _binary_mesh{}_start;", id));
+    this.wln(&format!("extern const KDNode _binary_{}_start;", blob));
     if this.ch.pass == 0 {
-      gen_mesh_obj(id, mesh, obj);
+      gen_mesh_obj(&blob, mesh, obj);
     }
     match &obj.color {
       Color::Image { data, w, h } => {
-        this.wln(&format!("if (kd_node_hit(&_binary_mesh{}_start, ray, res, {}, {})) {{", id, Self::gen_text(obj.texture), cpp_vec3(Vec3(-1.0, 0.0, 0.0)))).inc();
+        this.wln(&format!("if (kd_node_hit(&_binary_{}_start, ray, res, {}, {})) {{", blob, Self::gen_text(obj.texture), cpp_vec3(Vec3(-1.0, 0.0, 0.0)))).inc();
         this.wln("f32 u = res.col.x;");
         this.wln("f32 v = res.col.y;");
-        Self::gen_img(this, data, *w, *h, false);
+        Self::gen_img(this, data, *w, *h, false, mesh_uv_scale(mesh));
         this.dec().wln("}");
       }
       Color::RGB(rgb) => {
-        this.wln(&format!("kd_node_hit(&_binary_mesh{}_start, ray, res, {}, {});", id, Self::gen_text(obj.texture), cpp_vec3(*rgb)));
+        this.wln(&format!("kd_node_hit(&_binary_{}_start, ray, res, {}, {});", blob, Self::gen_text(obj.texture), cpp_vec3(*rgb)));
       }
     };
   }
 
-  // copied CppCodeGen::gen_img
-  fn gen_img(this: &mut CodegenBase<PPMCodeGen>, data: &[Vec3], w: u32, h: u32, need_warp: bool) {
-    let id = this.img_id;
+  // CppCodeGen::gen_img, but the image is only generated in the first pass
+  fn gen_img(this: &mut CodegenBase<PPMCodeGen>, data: &[Vec3], w: u32, h: u32, need_warp: bool, uv_scale: f32) {
+    let blob = this.blob(&format!("img{}", this.img_id));
     this.img_id += 1;
-    this.wln(&format!("extern const Vec3 _binary_img{}_start[];", id));
-    if need_warp {
-      this.wln("u = mod1(u);");
-      this.wln("v = mod1(v);");
-    }
-    this.wln(&format!("res.col = _binary_img{}_start[u32(v * {h}) * {w} + u32(u * {w})];", id, h = h, w = w));
+    gen_cpp_img_fetch(this, &blob, w, h, need_warp, uv_scale);
     if this.ch.pass == 0 {
-      gen_img_obj(id, data, false);
+      gen_img_obj_rgb8(&blob, data, w, h);
+    }
+  }
+}
+
+// stochastic progressive photon mapping, every iteration traces a new hit point per pixel (with a new lens sample)
+// and a new batch of photons, radius, N & tau are kept per pixel
+pub struct SPPMCodegen {
+  // diameter of the lens, 0 for pinhole camera
+  aperture: f32,
+  // distance to the focal plane along camera direction
+  focus: f32,
+}
+
+impl SPPMCodegen {
+  pub fn new(aperture: f32, focus: f32) -> SPPMCodegen {
+    SPPMCodegen { aperture, focus }
+  }
+}
+
+impl BaseFn<SPPMCodegen> for SPPMCodegen {
+  fn gen_impl(this: &mut CodegenBase<SPPMCodegen>, world: &World) {
+    for path in &["tool/sampler.hpp", "tool/ppm_util.hpp"] {
+      let mut header = File::open(path).unwrap();
+      let mut header_content = String::new();
+      let _ = header.read_to_string(&mut header_content);
+      this.wln(&header_content);
+    }
+    this.wln(r#"struct SPPMPixel {
+  f32 r2;
+  u32 n;
+  Vec3 tau, direct;
+};
+"#);
+    Self::gen_scene_hit(this, world);
+    // follow specular & refractive surfaces to the first diffuse surface, choosing one branch randomly
+    this.wln("void camera_pass(Ray ray, XorShiftRNG &rng, SPPMPixel &pix, u32 index) {").inc();
+    this.wln("Vec3 fac{1.0f, 1.0f, 1.0f};");
+    this.wln("for (u32 d = 0; d < 20; ++d) {").inc();
+    this.wln("HitRes res{1e10};");
+    this.wln("scene_hit(ray, res, rng);");
+    this.wln("if (light_hit(ray, res.t)) {").inc();
+    this.wln(&format!("pix.direct += fac.schur({});", cpp_vec3(world.light.emission)));
+    this.wln("return;");
+    this.dec().wln("}");
+    this.wln(r#"if (res.t == 1e10) { return; }
+    Vec3 p = ray.o + ray.d * res.t;
+    fac = fac.schur(res.col);
+    switch (res.text) {
+      case 0: {
+        grid.add_hit_point(HitPoint{.fac=fac, .pos=p, .norm=res.norm, .flux=pix.tau, .r2=pix.r2, .n=pix.n, .idx=index});
+        return;
+      }
+      case 1: {
+        ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        break;
+      }
+      case 2: {
+        constexpr f32 NA = 1.0f, NG = 1.5f, R0 = (NA - NG) * (NA - NG) / ((NA + NG) * (NA + NG));
+        f32 cos = res.norm.dot(ray.d), sin = sqrtf(1.0f - cos * cos), n;
+        Vec3 norm_d = res.norm;
+        if (cos < 0.0f) {
+          n = NG / NA;
+          cos = -cos;
+          norm_d = -norm_d;
+        } else {
+          n = NA / NG;
+          if (sin >= n) {
+            ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+            break;
+          }
+        }
+        if (rng.gen() < R0 + (1.0f - R0) * powf(1.0f - cos, 5)) {
+          ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        } else {
+          ray = {p, norm_d * (sqrtf(1.0f - sin * sin / (n * n)) - cos / n) + ray.d / n};
+        }
+        break;
+      }
+    }"#);
+    this.dec().wln("}").dec().wln("}\n");
+    // the light source absorbs photons, just like it blocks rays in camera_pass()
+    this.wln(r#"void photon_pass(Ray ray, Vec3 flux, SobolSampler &rng) {
+  for (u32 d = 0; d < 20; ++d) {
+    HitRes res{1e10};
+    scene_hit(ray, res, rng);
+    if (res.t == 1e10 || light_hit(ray, res.t)) { break; }
+    Vec3 p = ray.o + ray.d * res.t;
+    switch (res.text) {
+      case 0: {
+        Vec3 pos = (p - grid.min) * grid.inv_grid_size;
+        if (pos.x >= 0.0f && pos.y >= 0.0f && pos.z >= 0.0f) {
+          u32 h = grid.hash(u32(pos.x), u32(pos.y), u32(pos.z));
+          for (u32 i = grid.idx[h], end = grid.idx[h + 1]; i < end; ++i) {
+            const HitPointHot &hp = grid.hot[grid.pool[i]];
+            Vec3 v = hp.pos - p;
+            if (hp.norm.dot(res.norm) > EPS && v.dot(v) <= hp.r2) {
+              grid.add_photon(grid.pool[i], grid.cold[grid.pool[i]].fac.schur(flux) * (1 / PI));
+            }
+          }
+        }
+        f32 prob = res.col.x > res.col.y && res.col.x > res.col.z ? res.col.x : res.col.y > res.col.z ? res.col.y : res.col.z;
+        if (rng.gen() < prob) {
+          flux = flux.schur(res.col) / prob;
+          f32 r1 = 2 * PI * rng.gen(), r2 = rng.gen(), r2s = sqrtf(r2);
+          Vec3 w = res.norm.dot(ray.d) < 0.0f ? res.norm : -res.norm;
+          Vec3 u = w.orthogonal_unit();
+          Vec3 v = w.cross(u);
+          Vec3 d = (u * cosf(r1) + v * sinf(r1)) * r2s + w * sqrtf(1.0f - r2);
+          ray = {p, d.norm()};
+        } else {
+          return;
+        }
+        break;
+      }
+      case 1: {
+        flux = flux.schur(res.col);
+        ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        break;
+      }
+      case 2: {
+        flux = flux.schur(res.col);
+        constexpr f32 NA = 1.0f, NG = 1.5f, R0 = (NA - NG) * (NA - NG) / ((NA + NG) * (NA + NG));
+        f32 cos = res.norm.dot(ray.d), sin = sqrtf(1.0f - cos * cos), n;
+        Vec3 norm_d = res.norm;
+        if (cos < 0.0f) {
+          n = NG / NA;
+          cos = -cos;
+          norm_d = -norm_d;
+        } else {
+          n = NA / NG;
+          if (sin >= n) {
+            ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+            break;
+          }
+        }
+        if (rng.gen() < R0 + (1.0f - R0) * powf(1.0f - cos, 5)) {
+          ray = {p, ray.d - res.norm * 2.0f * res.norm.dot(ray.d)};
+        } else {
+          ray = {p, norm_d * (sqrtf(1.0f - sin * sin / (n * n)) - cos / n) + ray.d / n};
+        }
+        break;
+      }
+    }
+  }
+}
+"#);
+  }
+
+  fn gen_main(this: &mut CodegenBase<SPPMCodegen>, world: &World) {
+    this.wln(&format!(r#"const u32 W = {}, H = {};"#, world.w, world.h));
+    this.wln(r#"Vec3 output[W * H];
+SPPMPixel pixels[W * H];
+
+int main(int argc, char **args) {
+  u32 n_iter = argc > 1 ? std::atoi(args[1]) : (puts("please specify #iteration"), exit(-1), 0);
+  u32 np_1024 = argc > 3 ? std::atoi(args[3]) : 64; // photons per iteration (* 1024)"#).inc();
+    gen_cpp_camera(this, world);
+    this.wln("// the radius is set by the first pass with any hit point");
+    this.wln("bool initialized = false;");
+    this.wln("for (u32 iter = 0; iter < n_iter; ++iter) {").inc();
+    this.wln(r#"fprintf(stderr, "\rrendering %5.2f%%", 100.0f * iter / n_iter);"#);
+    this.wln("#pragma omp parallel for schedule(static, 1)");
+    this.wln("for (u32 y = 0; y < H; ++y) {").inc();
+    this.wln("for (u32 x = 0; x < W; ++x) {").inc();
+    this.wln("u32 index = y * W + x;");
+    this.wln("XorShiftRNG rng{iter * W * H + index};");
+    this.wln("f32 r1 = 2.0f * rng.gen(), r2 = 2.0f * rng.gen();");
+    this.wln("f32 dx = r1 < 1.0f ? sqrtf(r1) - 1.0f : 1.0f - sqrtf(2.0f - r1);");
+    this.wln("f32 dy = r2 < 1.0f ? sqrtf(r2) - 1.0f : 1.0f - sqrtf(2.0f - r2);");
+    this.wln("Vec3 d = cx * ((x + 0.5f + dx) / W - 0.5f) + cy * ((y + 0.5f + dy) / H - 0.5f) + cam.d;");
+    if this.ch.aperture > 0.0 {
+      // thin lens, the lens is at the position where rays start, parallel to cx & cy
+      let cx = Vec3(world.w as f32 * 0.5135 / world.h as f32, 0.0, 0.0);
+      let cy = cx.cross(world.cam.d).norm() * 0.5135;
+      this.wln("f32 th = 2.0f * PI * rng.gen(), lr = sqrtf(rng.gen());");
+      this.wln(&format!("Vec3 o = cam.o + d * 14.0f + ({} * cosf(th) + {} * sinf(th)) * lr;",
+                        cpp_vec3(cx.norm() * (this.ch.aperture * 0.5)), cpp_vec3(cy.norm() * (this.ch.aperture * 0.5))));
+      this.wln(&format!("camera_pass(Ray{{o, (cam.o + d * {} - o).norm()}}, rng, pixels[index], index);", this.ch.focus));
+    } else {
+      this.wln("camera_pass(Ray{cam.o + d * 14.0f, d.norm()}, rng, pixels[index], index);");
+    }
+    this.dec().wln("}").dec().wln("}");
+    this.wln(r#"grid.clear();
+    grid.collect_hit_points();
+    if (grid.hot.empty()) { continue; }
+    if (!initialized) {
+      initialized = true;
+      f32 rad = grid.init_rad(W, H);
+      for (u32 i = 0; i < W * H; ++i) {
+        pixels[i].r2 = rad * rad;
+      }
+      for (auto &hp : grid.hot) {
+        hp.r2 = rad * rad;
+      }
+    }
+    f32 max_r2 = 0.0f;
+#pragma omp parallel for reduction(max: max_r2)
+    for (u32 i = 0; i < grid.size(); ++i) {
+      max_r2 = fmaxf(max_r2, grid.hot[i].r2);
+    }
+    grid.build(sqrtf(max_r2));
+#pragma omp parallel for schedule(static, 1)
+    for (u32 i = 0; i < np_1024; ++i) {
+      SobolSampler rng{0, (iter * np_1024 + i) * 1024};
+      for (u32 j = 0; j < 1024; j++, rng.next_sample()) {"#);
+    this.inc().inc();
+    match &world.light.geo {
+      LightGeo::Circle(circle) => {
+        // two-sided light, cosine weighted emission on both sides
+        let plane = &circle.plane;
+        let power = world.light.emission * (2.0 * std::f32::consts::PI * std::f32::consts::PI * circle.u.len2());
+        this.wln("f32 th1 = 2 * PI * rng.gen(), r = sqrtf(rng.gen());");
+        this.wln("f32 th2 = 2 * PI * rng.gen(), r2 = rng.gen(), r2s = sqrtf(r2);");
+        this.wln(&format!("Vec3 n = rng.gen() < 0.5f ? {} : -{};", cpp_vec3(plane.n), cpp_vec3(plane.n)));
+        this.wln(&format!("Vec3 d = ({} * cosf(th2) + {} * sinf(th2)) * r2s + n * sqrtf(1.0f - r2);",
+                          cpp_vec3(circle.u.norm()), cpp_vec3(circle.v.norm())));
+        this.wln(&format!("Ray ray{{{} + {} * r * cosf(th1) + {} * r * sinf(th1), d}};",
+                          cpp_vec3(plane.p), cpp_vec3(circle.u), cpp_vec3(circle.v)));
+        this.wln(&format!("photon_pass(ray, {} / (np_1024 * 1024.0f), rng);", cpp_vec3(power)));
+      }
+    };
+    this.dec().wln("}").dec().wln("}");
+    this.wln(r#"grid.end_pass();
+    for (u32 i = 0; i < grid.size(); ++i) {
+      SPPMPixel &pix = pixels[grid.cold[i].idx];
+      pix.r2 = grid.hot[i].r2, pix.n = grid.cold[i].n, pix.tau = grid.cold[i].flux;
+    }"#);
+    this.dec().wln("}");
+    this.wln(r#"fprintf(stderr, "\n");
+  for (u32 i = 0; i < W * H; ++i) {
+    const SPPMPixel &pix = pixels[i];
+    output[i] = pix.direct / n_iter + (pix.r2 > 0.0f ? pix.tau / (PI * pix.r2 * n_iter) : Vec3{});
+  }
+  output_png(output, W, H, argc > 2 ? args[2] : "image.png");"#);
+    this.dec().wln("}");
+  }
+
+  fn gen_mesh(this: &mut CodegenBase<SPPMCodegen>, mesh: &Mesh, obj: &Object, bezier: Option<&RotateBezier>) {
+    gen_cpp_mesh(this, mesh, obj, bezier);
+  }
+
+  fn gen_img(this: &mut CodegenBase<SPPMCodegen>, data: &[Vec3], w: u32, h: u32, need_warp: bool, uv_scale: f32) {
+    gen_cpp_img(this, data, w, h, need_warp, uv_scale);
+  }
+}
+
+// the voxels & the majorant grid of a heterogeneous medium, in the layout of Medium in tool/volume_util.hpp
+// returns the resolution of the majorant grid
+fn gen_medium_obj(density_path: &str, majorant_path: &str, grid: &DensityGrid) -> (u32, u32, u32) {
+  // the same as MAJORANT_BLOCK
+  const BLOCK: u32 = 8;
+  let (nx, ny, nz) = grid.res;
+  assert_eq!(grid.data.len(), (nx * ny * nz) as usize, "the density grid doesn't match its resolution");
+  let (mx, my, mz) = ((nx + BLOCK - 1) / BLOCK, (ny + BLOCK - 1) / BLOCK, (nz + BLOCK - 1) / BLOCK);
+  let mut majorant = vec![0.0f32; (mx * my * mz) as usize];
+  for z in 0..nz {
+    for y in 0..ny {
+      for x in 0..nx {
+        let m = &mut majorant[((z / BLOCK * my + y / BLOCK) * mx + x / BLOCK) as usize];
+        *m = m.max(grid.data[((z * ny + y) * nx + x) as usize]);
+      }
+    }
+  }
+  for (bin_path, data) in &[(density_path, &grid.data[..]), (majorant_path, &majorant[..])] {
+    {
+      let mut bin = File::create(bin_path).unwrap();
+      let mut f = Vec::with_capacity(data.len() * 4);
+      for x in data.iter() { f.write_f32::<LittleEndian>(*x).unwrap(); }
+      bin.write_all(&f).unwrap();
+    }
+    let obj_path = format!("{}.o", bin_path);
+    Command::new("ld").args(&["-r", "-b", "binary", bin_path, "-o", &obj_path]).spawn().unwrap().wait().unwrap();
+    remove_file(bin_path).unwrap();
+  }
+  (mx, my, mz)
+}
+
+// path tracing in a participating medium filling the scene (outside & inside objects), lit by the light source
+// each segment of a path adds the light scattered once in the medium toward its origin, by mis between free flight in
+// the majorant medium & equiangular sampling toward a point on the light; the path itself scatters in the medium by
+// delta tracking, so the light reached right after a scattering is already counted, and is skipped
+pub struct VolumeCodegen {
+  medium: Medium,
+}
+
+impl VolumeCodegen {
+  pub fn new(medium: Medium) -> VolumeCodegen {
+    VolumeCodegen { medium }
+  }
+}
+
+impl BaseFn<VolumeCodegen> for VolumeCodegen {
+  const CONE: bool = true;
+
+  fn gen_impl(this: &mut CodegenBase<VolumeCodegen>, world: &World) {
+    let mut header = File::open("tool/volume_util.hpp").unwrap();
+    let mut header_content = String::new();
+    let _ = header.read_to_string(&mut header_content);
+    this.wln(&header_content);
+    let (sigma_s, sigma_a) = (this.ch.medium.sigma_s, this.ch.medium.sigma_a);
+    let medium = match &this.ch.medium.grid {
+      Some(grid) => {
+        let (density, majorant) = (this.blob("density"), this.blob("majorant"));
+        let (mx, my, mz) = gen_medium_obj(&density, &majorant, grid);
+        let (nx, ny, nz) = grid.res;
+        let voxel = Vec3((grid.max.0 - grid.min.0) / nx as f32, (grid.max.1 - grid.min.1) / ny as f32,
+                         (grid.max.2 - grid.min.2) / nz as f32);
+        format!("extern const f32 _binary_{d}_start[], _binary_{m}_start[];
+constexpr Medium MEDIUM{{{}, {}, _binary_{d}_start, _binary_{m}_start, {}, {}, {}, {}, {}, {}, {}, {}}};\n",
+                sigma_s, sigma_a, cpp_vec3(grid.min), cpp_vec3(voxel), nx, ny, nz, mx, my, mz, d = density, m = majorant)
+      }
+      None => format!("constexpr Medium MEDIUM{{{}, {}, nullptr, nullptr, Vec3{{}}, Vec3{{}}, 0, 0, 0, 0, 0, 0}};\n",
+                      sigma_s, sigma_a),
+    };
+    this.wln(&medium);
+    Self::gen_scene_hit(this, world);
+    let (c, n, u, v, r) = match &world.light.geo {
+      LightGeo::Circle(circle) => (circle.plane.p, circle.plane.n, circle.u.norm(), circle.v.norm(), circle.u.len()),
+    };
+    let emission = cpp_vec3(world.light.emission);
+    this.wln("template <typename RNG>");
+    this.wln("Vec3 segment_nee(const Ray &ray, f32 t1, RNG &rng) {").inc();
+    this.wln("// a point on the light, uniform in area");
+    this.wln(&format!("f32 th = 2.0f * PI * rng.gen(), rr = {} * sqrtf(rng.gen());", r));
+    this.wln(&format!("Vec3 y = {} + {} * (rr * cosf(th)) + {} * (rr * sinf(th));", cpp_vec3(c), cpp_vec3(u), cpp_vec3(v)));
+    this.wln(r#"Equiangular eq{ray, y, t1};
+  f32 t[2], pdf[2], other[2];
+  bool ok[2];
+  ok[0] = MEDIUM.sample_majorant(ray, t1, rng.gen(), t[0], pdf[0]);
+  other[0] = ok[0] ? eq.pdf(t[0]) : 0.0f;
+  t[1] = eq.sample(rng.gen()), pdf[1] = eq.pdf(t[1]), ok[1] = pdf[1] > 0.0f && pdf[1] < INFINITY;
+  other[1] = ok[1] ? MEDIUM.majorant_pdf(ray, t1, t[1]) : 0.0f;
+  Vec3 sum{};
+  for (u32 i = 0; i < 2; ++i) {
+    if (!ok[i]) { continue; }
+    Vec3 x = ray.o + ray.d * t[i];
+    f32 density = MEDIUM.density_at(x);
+    if (density <= 0.0f) { continue; }
+    Vec3 w = y - x;
+    f32 dist = w.len();
+    w /= dist;
+    Ray shadow{x, w};
+    HitRes h{1e10};
+    scene_hit(shadow, h, rng);
+    if (h.t < dist - EPS) { continue; }
+    f32 tr = MEDIUM.transmittance(ray, t[i], rng) * MEDIUM.transmittance(shadow, dist, rng);"#);
+    // the phase function is 1 / (4 PI), the area pdf of y is 1 / area
+    this.inc();
+    this.wln(&format!("f32 g = fabsf(w.dot({})) / (dist * dist) * {};", cpp_vec3(n), r * r / 4.0));
+    this.wln(&format!("sum += {} * (MEDIUM.sigma_s * density * tr * g / pdf[i] * mis_weight(pdf[i], other[i]));", emission));
+    this.dec();
+    this.wln("}");
+    this.wln("return sum;");
+    this.dec().wln("}\n");
+    this.wln("template <typename RNG>");
+    this.wln("Vec3 trace(Ray ray, RNG &rng, RayCone cone) {").inc();
+    this.wln("Vec3 fac{1.0f, 1.0f, 1.0f}, rad{};");
+    this.wln("// the last vertex is a real collision in the medium");
+    this.wln("bool scattered = false;");
+    this.wln("for (u32 _ = 0; _ < 16; ++_) {").inc();
+    this.wln("if (fac.len2() <= 1e-4) { break; }");
+    this.wln("TRACE_STAT(path, 1);");
+    this.wln("HitRes res{1e10};");
+    this.wln("scene_hit(ray, res, rng, cone);");
+    this.wln("bool light = light_hit(ray, res.t);");
+    this.wln(&format!("f32 t1 = light ? ({} - ray.o).dot({}) / ray.d.dot({}) : res.t, t;", cpp_vec3(c), cpp_vec3(n), cpp_vec3(n)));
+    this.wln("rad += fac.schur(segment_nee(ray, t1, rng));");
+    this.wln(r#"if (MEDIUM.sample_distance(ray, t1, rng, t)) {
+      // the albedo, the phase function is sampled exactly
+      fac *= MEDIUM.sigma_s / MEDIUM.sigma_t();
+      cone.w = cone.width(t);
+      cone.spread = fmaxf(cone.spread, CONE_DIFFUSE_SPREAD);
+      ray = {ray.o + ray.d * t, sample_sphere(rng.gen(), rng.gen())};
+      scattered = true;
+      continue;
     }
+    if (light) {"#);
+    this.inc();
+    this.wln(&format!("if (!scattered) {{ rad += fac.schur({}); }}", emission));
+    this.wln("break;");
+    this.dec().wln("}");
+    this.wln("scattered = false;");
+    Self::gen_handle_text(this, false, false);
+    this.dec().wln("}");
+    this.wln("return rad;");
+    this.dec().wln("}");
+  }
+
+  fn gen_main(this: &mut CodegenBase<VolumeCodegen>, world: &World) {
+    this.wln(&format!(r#"const u32 W = {}, H = {};"#, world.w, world.h));
+    this.wln(r#"Vec3 output[W * H];
+
+int main(int argc, char **args) {
+  u32 ns = argc > 1 ? std::atoi(args[1]) : (puts("please specify #sample"), exit(-1), 0);"#).inc();
+    gen_cpp_camera(this, world);
+    this.dec();
+    gen_cpp_pixel_loop(this, Sampler::XorShift, "");
+  }
+
+  fn gen_mesh(this: &mut CodegenBase<VolumeCodegen>, mesh: &Mesh, obj: &Object, bezier: Option<&RotateBezier>) {
+    gen_cpp_mesh(this, mesh, obj, bezier);
+  }
+
+  fn gen_img(this: &mut CodegenBase<VolumeCodegen>, data: &[Vec3], w: u32, h: u32, need_warp: bool, uv_scale: f32) {
+    gen_cpp_img(this, data, w, h, need_warp, uv_scale);
   }
-}
\ No newline at end of file
+}
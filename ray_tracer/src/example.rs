@@ -65,13 +65,38 @@ fn main() {
       emission: Vec3(15.0, 15.0, 15.0),
     },
     env: Vec3::zero(),
+    env_map: None,
     cam: Ray::new(Vec3(5.0, 5.2, 29.56), Vec3(0.0, -0.042612, -1.0)),
     w: 2048,
     h: 2048,
   };
-  // 4 ways to render
+  // 12 ways to render
   CodegenBase::new(PPMCodeGen::new(Vec3(0.0, 0.0, 0.0), Vec3(10.0, 8.5, 20.0))).gen(&world, "ppm_tracer.cpp");
-  CodegenBase::new(CppCodegen).gen(&world, "pt_tracer.cpp");
+  CodegenBase::new(CppCodegen::new(Sampler::Sobol)).gen(&world, "pt_tracer.cpp");
+  CodegenBase::new(MLTCodegen).gen(&world, "mlt_tracer.cpp");
+  CodegenBase::new(CausticCodegen::new(0.05)).gen(&world, "caustic_tracer.cpp");
+  CodegenBase::new(ManifoldCodegen).gen(&world, "manifold_tracer.cpp");
+  CodegenBase::new(GuidingCodegen::new(Vec3(0.0, 0.0, 0.0), Vec3(10.0, 8.5, 20.0))).gen(&world, "guiding_tracer.cpp");
+  CodegenBase::new(IrradianceCodegen::new(0.1, 1.0)).gen(&world, "irradiance_tracer.cpp");
+  CodegenBase::new(SPPMCodegen::new(0.0, 0.0)).gen(&world, "sppm_tracer.cpp");
+  CodegenBase::new(SpectralCodegen::new(Sampler::Sobol)).gen(&world, "spectral_tracer.cpp");
+  CodegenBase::new(VolumeCodegen::new(Medium { sigma_s: 0.02, sigma_a: 0.005, grid: None })).gen(&world, "volume_tracer.cpp");
   CodegenBase::new(CudaCodegen::new()).gen(&world, "pt_tracer.cu");
   let _ = world.path_tracing(8192).write("rs_image.png"); // may not work, haven't used for a long time...
+
+  // the dragons replaced by a vase, its proxy mesh is made for this camera by tool/tessellate.cpp (`make all` in tool
+  // makes it), its blobs are prefixed so vase_mesh0.o doesn't replace the mesh0.o of the tracers above
+  let vase_obj = "resource/vase.obj";
+  if !std::path::Path::new(vase_obj).exists() {
+    eprintln!("{} not found, skipping the vase scene (make ../resource/vase.obj in tool)", vase_obj);
+    return;
+  }
+  let mut world = world;
+  world.objs.truncate(6);
+  world.objs.push(Object {
+    geo: Geo::RotateBezier(load::bezier_curve("resource/vase.txt").unwrap().rotate_bezier_obj(vase_obj, Vec3(5.0, 0.0, 8.0), 1.5).unwrap()),
+    color: Color::RGB(Vec3(0.9, 0.8, 0.5)),
+    texture: Texture::Diffuse,
+  });
+  CodegenBase::new(CppCodegen::new(Sampler::Sobol)).prefix("vase_").gen(&world, "vase_tracer.cpp");
 }
@@ -7,8 +7,6 @@ extern crate serde;
 extern crate serde_json;
 extern crate bincode;
 extern crate byteorder;
-extern crate f128;
-extern crate num_traits;
 
 pub mod vec;
 pub mod geo;
@@ -2,7 +2,7 @@ use super::vec::*;
 use super::mesh::Mesh;
 use super::bezier::*;
 use super::mat44::Mat44;
-use super::material::Color;
+use super::material::{Color, EnvMap};
 use std::fs::*;
 use std::io::prelude::*;
 use std::io;
@@ -131,4 +131,74 @@ pub fn texture(path: &str, flip: bool) -> io::Result<Color> {
   } else {
     Ok(Color::Image { data: color.into(), w: info.width, h: info.height })
   }
-}
\ No newline at end of file
+}
+
+// radiance .hdr (rgbe), flat or new style run length encoded scanlines, with the standard "-Y h +X w" orientation
+pub fn env_map(path: &str) -> io::Result<EnvMap> {
+  fn invalid(msg: &str) -> io::Error {
+    io::Error::new(io::ErrorKind::InvalidData, msg)
+  }
+  let mut buf = Vec::new();
+  File::open(path)?.read_to_end(&mut buf)?;
+  let mut pos = 0;
+  // the next line of the header, the file must not end in the header
+  let mut line = || {
+    let start = pos;
+    if start >= buf.len() { return Err(invalid("truncated hdr header")); }
+    while pos < buf.len() && buf[pos] != b'\n' { pos += 1; }
+    pos += 1;
+    Ok(String::from_utf8_lossy(&buf[start..(pos - 1).min(buf.len())]).into_owned())
+  };
+  if !line()?.starts_with("#?") { return Err(invalid("not a radiance hdr file")); }
+  loop {
+    let l = line()?;
+    if l.is_empty() { break; }
+    if l.starts_with("FORMAT=") && l != "FORMAT=32-bit_rle_rgbe" { return Err(invalid("unsupported hdr format")); }
+  }
+  let res = line()?;
+  let res = res.split_whitespace().collect::<Vec<_>>();
+  if res.len() != 4 || res[0] != "-Y" || res[2] != "+X" { return Err(invalid("unsupported hdr orientation")); }
+  let (h, w): (u32, u32) = match (res[1].parse(), res[3].parse()) {
+    (Ok(h), Ok(w)) => (h, w),
+    _ => return Err(invalid("invalid hdr resolution")),
+  };
+  // every scanline takes at least 8 bytes, 2 per channel for each 127 pixels when run length encoded, so a bogus
+  // resolution fails here instead of on reserving memory
+  let n = (w as usize).checked_mul(h as usize).ok_or_else(|| invalid("invalid hdr resolution"))?;
+  if h as usize > buf.len() || w as usize / 16 > buf.len() { return Err(invalid("truncated hdr file")); }
+  let mut data = Vec::with_capacity(n.min(buf.len() * 16));
+  let mut scan = vec![0u8; w as usize * 4];
+  for _ in 0..h {
+    let rle = w >= 8 && w < 32768 && pos + 4 <= buf.len() && buf[pos] == 2 && buf[pos + 1] == 2
+      && ((buf[pos + 2] as u32) << 8 | buf[pos + 3] as u32) == w;
+    if rle {
+      // 4 channels one after another, a count > 128 is a run of count - 128 copies of the next byte
+      pos += 4;
+      for c in 0..4 {
+        let mut x = 0;
+        while x < w as usize {
+          let count = *buf.get(pos).ok_or_else(|| invalid("truncated hdr file"))? as usize;
+          let (run, n) = if count > 128 { (true, count - 128) } else { (false, count) };
+          if n == 0 || x + n > w as usize || pos + 1 + if run { 1 } else { n } > buf.len() {
+            return Err(invalid("corrupted hdr scanline"));
+          }
+          for i in 0..n {
+            scan[(x + i) * 4 + c] = buf[pos + 1 + if run { 0 } else { i }];
+          }
+          pos += 1 + if run { 1 } else { n };
+          x += n;
+        }
+      }
+    } else {
+      let n = scan.len();
+      if pos + n > buf.len() { return Err(invalid("truncated hdr file")); }
+      scan.copy_from_slice(&buf[pos..pos + n]);
+      pos += n;
+    }
+    for p in scan.chunks(4) {
+      let f = if p[3] == 0 { 0.0 } else { 2.0f32.powi(p[3] as i32 - 136) };
+      data.push(Vec3(p[0] as f32 * f, p[1] as f32 * f, p[2] as f32 * f));
+    }
+  }
+  Ok(EnvMap { data: data.into(), w, h })
+}
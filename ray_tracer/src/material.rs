@@ -1,6 +1,7 @@
 use super::vec::*;
 use super::geo::Ray;
 use serde::{Serialize, Deserialize};
+use std::f32::consts::PI;
 
 #[derive(Serialize, Deserialize, Copy, Clone)]
 pub enum Texture {
@@ -8,6 +9,12 @@ pub enum Texture {
   Specular,
   Refractive,
   Mixed { d_prob: f32, s_prob: f32 },
+  // refractive with index a + b / lambda^2 (lambda in um), only dispersive in SpectralCodegen, other backends
+  // treat it as Refractive
+  Dispersive { a: f32, b: f32 },
+  // emits the color of the object (which should be Color::RGB) from both sides & reflects nothing
+  // only meshes can be emissive, and only backends with next event estimation in gen_trace_loop support it
+  Emissive,
 }
 
 impl Texture {
@@ -59,4 +66,42 @@ impl Color {
       }
     }
   }
-}
\ No newline at end of file
+}
+
+// equirectangular environment map in linear hdr, row 0 is +y, column x is phi = atan2(z, x) in [0, 2 PI)
+// the same mapping as EnvMap in tool/env_util.hpp
+#[derive(Serialize, Deserialize)]
+pub struct EnvMap {
+  pub data: Box<[Vec3]>,
+  pub w: u32,
+  pub h: u32,
+}
+
+impl EnvMap {
+  pub fn get(&self, d: Vec3) -> Vec3 {
+    let phi = d.2.atan2(d.0);
+    let phi = if phi < 0.0 { phi + 2.0 * PI } else { phi };
+    let theta = d.1.max(-1.0).min(1.0).acos();
+    let x = ((phi * (0.5 / PI) * self.w as f32) as u32).min(self.w - 1);
+    let y = ((theta / PI * self.h as f32) as u32).min(self.h - 1);
+    self.data[(y * self.w + x) as usize]
+  }
+}
+
+// a participating medium filling the scene, gray & isotropic, see VolumeCodegen
+// sigma_t(p) = (sigma_s + sigma_a) * density(p), the density is 1 everywhere without a grid
+#[derive(Serialize, Deserialize)]
+pub struct Medium {
+  pub sigma_s: f32,
+  pub sigma_a: f32,
+  pub grid: Option<DensityGrid>,
+}
+
+// voxels of density in the box [min, max], x first, the density is constant in a voxel & 0 outside the box
+#[derive(Serialize, Deserialize)]
+pub struct DensityGrid {
+  pub min: Vec3,
+  pub max: Vec3,
+  pub res: (u32, u32, u32),
+  pub data: Box<[f32]>,
+}
@@ -14,6 +14,9 @@ pub struct World {
   pub objs: Vec<Object>,
   pub light: LightSource,
   pub env: Vec3,
+  // lights the scene from infinitely far away, in backends with the shared trace loop (see gen_trace_loop)
+  #[serde(default)]
+  pub env_map: Option<EnvMap>,
   pub cam: Ray,
   pub w: u32,
   pub h: u32,
@@ -152,9 +155,10 @@ impl World {
               })
             } else { self.path_tracing_impl(reflect, dep + 1, rng) }
           }
+          Texture::Emissive => color,
           _ => unimplemented!()
         }
       } else { self.env }
-    } else { self.env }
+    } else if let Some(env_map) = &self.env_map { env_map.get(ray.d) } else { self.env }
   }
 }
@@ -0,0 +1,386 @@
+#include "tracer_util.hpp"
+#include <omp.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// micro benchmarks of the intersection & traversal kernels, in Mrays/s for each kernel, ray set & thread count
+// usage: make bench && ./bench [mesh0|-] [n_ray] [bench.json]
+// mesh0 is a mesh blob as written by gen_mesh_obj, it can be taken back from the object file by
+// `objcopy -O binary -j .data mesh0.o mesh0`; without it (-), only the analytic primitives & RotateBezier are run
+// the rays are generated once from the bounds of the mesh and recorded in mesh0.rays (bench.rays without a mesh),
+// later runs load them, so that the numbers stay comparable; delete the file to record new ones
+// ray sets: camera (toward the mesh from outside), diffuse (cosine bounces from the first hits) and shadow (from the
+// first hits toward a point above the mesh, with t_max), and bezier for the built-in surface of revolution
+// the summary table goes to stdout, bench.json has one record per measurement for regression tracking
+
+constexpr u32 LEAF_TRIS = 16;  // triangles per ray in the leaf tests, about a leaf of the kd tree
+constexpr f64 MIN_TIME = 0.25; // seconds per measurement, the number of passes is doubled until then
+
+struct BenchRay {
+  Ray ray;
+  f32 t_max;
+  f32 u, v, t; // the starting point of newton iteration, bezier rays only
+};
+
+struct RaySet {
+  const char *name;
+  std::vector<BenchRay> rays;
+};
+
+// the triangle for the moller-trumbore test, recovered from TriMat
+struct Tri {
+  Vec3 p, e1, e2;
+};
+
+std::vector<u32> load_mesh(const char *path) {
+  FILE *fp = fopen(path, "rb");
+  if (!fp) { exit((fprintf(stderr, "can't open %s\n", path), -1)); }
+  fseek(fp, 0, SEEK_END);
+  long len = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  std::vector<u32> buf((len + 3) / 4);
+  if (fread(buf.data(), 1, len, fp) != size_t(len)) { exit((fprintf(stderr, "can't read %s\n", path), -1)); }
+  fclose(fp);
+  return buf;
+}
+
+// TriMat maps p to (u, v, plane distance), so its inverse maps (0, 0, 0), (1, 0, 0) & (0, 1, 0) to the vertices
+Tri tri_of(const TriMat &m) {
+  f64 a[3][3] = {{m.m00, m.m01, m.m02}, {m.m10, m.m11, m.m12}, {m.m20, m.m21, m.m22}}, b[3] = {m.m03, m.m13, m.m23};
+  f64 inv[3][3];
+  f64 det = a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) - a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0]) +
+            a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+  for (u32 i = 0; i < 3; ++i) {
+    for (u32 j = 0; j < 3; ++j) {
+      u32 r0 = (j + 1) % 3, r1 = (j + 2) % 3, c0 = (i + 1) % 3, c1 = (i + 2) % 3;
+      inv[i][j] = (a[r0][c0] * a[r1][c1] - a[r0][c1] * a[r1][c0]) / det;
+    }
+  }
+  auto map = [&](f64 u, f64 v) {
+    f64 q[3] = {u - b[0], v - b[1], -b[2]}, p[3];
+    for (u32 i = 0; i < 3; ++i) { p[i] = inv[i][0] * q[0] + inv[i][1] * q[1] + inv[i][2] * q[2]; }
+    return Vec3{f32(p[0]), f32(p[1]), f32(p[2])};
+  };
+  Vec3 p = map(0.0, 0.0);
+  return Tri{p, map(1.0, 0.0) - p, map(0.0, 1.0) - p};
+}
+
+void collect_tris(const KDNode *rt, const KDNode *x, std::vector<TriMat> &ms) {
+  if (x->len >> 31) {
+    ms.insert(ms.end(), x->ms, x->ms + (x->len & 0x7fffffff));
+  } else {
+    collect_tris(rt, (const KDNode *) ((const char *) x + 24 + 12), ms);
+    collect_tris(rt, (const KDNode *) ((const char *) rt + x->ch1), ms);
+  }
+}
+
+inline bool moller_hit(const Tri &tri, const Ray &ray, f32 t_max, f32 &t, f32 &u, f32 &v) {
+  Vec3 p = ray.d.cross(tri.e2);
+  f32 det = tri.e1.dot(p);
+  if (fabsf(det) < 1e-12f) { return false; }
+  f32 inv = 1.0f / det;
+  Vec3 s = ray.o - tri.p;
+  u = s.dot(p) * inv;
+  if (u < 0.0f || u > 1.0f) { return false; }
+  Vec3 q = s.cross(tri.e1);
+  v = ray.d.dot(q) * inv;
+  if (v < 0.0f || u + v > 1.0f) { return false; }
+  t = tri.e2.dot(q) * inv;
+  return t >= EPS && t <= t_max;
+}
+
+// the tests of the analytic primitives, the same as gen_geo emits inline
+struct Prims {
+  Vec3 c;   // center of the sphere, the rectangle & the circle, a point of the plane
+  f32 r;    // radius of the sphere & the circle
+  Vec3 n;   // normal of the plane, the rectangle & the circle
+  Vec3 u, v; // edges of the rectangle (starting from c)
+  f32 inv_u_len, inv_v_len;
+
+  bool sphere(const Ray &ray, f32 &t) const {
+    Vec3 oc = c - ray.o;
+    f32 b = oc.dot(ray.d), det = b * b - oc.len2() + r * r;
+    if (det <= 0.0f) { return false; }
+    f32 sq_det = sqrtf(det);
+    t = b - sq_det > EPS ? b - sq_det : b + sq_det > EPS ? b + sq_det : 0.0f;
+    return t != 0.0f;
+  }
+
+  bool plane(const Ray &ray, f32 &t) const {
+    t = (c - ray.o).dot(n) / ray.d.dot(n);
+    return t > EPS;
+  }
+
+  bool rectangle(const Ray &ray, f32 &t) const {
+    t = (c - ray.o).dot(n) / ray.d.dot(n);
+    if (!(t > EPS)) { return false; }
+    Vec3 p = ray.o + ray.d * t - c;
+    f32 pu = p.dot(u * inv_u_len), pv = p.dot(v * inv_v_len);
+    return 0.0f < pu && pu < 1.0f && 0.0f < pv && pv < 1.0f;
+  }
+
+  bool circle(const Ray &ray, f32 &t) const {
+    t = (c - ray.o).dot(n) / ray.d.dot(n);
+    return t > EPS && (ray.o + ray.d * t - c).len2() < r * r;
+  }
+};
+
+// the built-in surface of revolution (a vase), its proxy mesh would have DU & DV as parameter steps
+constexpr f64 BEZIER_CP[][2] = {{0.3, 0.0}, {1.4, 0.2}, {0.2, 1.0}, {0.9, 1.6}, {0.6, 2.0}};
+constexpr u32 BEZIER_N = sizeof(BEZIER_CP) / sizeof(BEZIER_CP[0]);
+constexpr BezierPoly<BEZIER_N> BEZIER = bezier_poly(BEZIER_CP);
+constexpr f32 DU = 2.0f * PI / 64.0f, DV = 1.0f / 32.0f;
+
+// product of two polynomials in bernstein form (of the same degree), like bernstein_mul in codegen.rs
+std::vector<f64> bernstein_mul(const std::vector<f64> &a, const std::vector<f64> &b) {
+  u32 n = a.size() - 1;
+  auto binom = [](u32 n, u32 k) {
+    f64 c = 1.0;
+    for (u32 i = 0; i < k; ++i) { c = c * (n - i) / (i + 1); }
+    return c;
+  };
+  std::vector<f64> ret(2 * n + 1);
+  for (u32 i = 0; i <= n; ++i) {
+    for (u32 j = 0; j <= n; ++j) { ret[i + j] += a[i] * b[j] * binom(n, i) * binom(n, j) / binom(2 * n, i + j); }
+  }
+  return ret;
+}
+
+RevolutionPoly<2 * BEZIER_N - 1> revolution_poly() {
+  std::vector<f64> xs, ys, ones(BEZIER_N, 1.0);
+  for (auto &p : BEZIER_CP) { xs.push_back(p[0]), ys.push_back(p[1]); }
+  RevolutionPoly<2 * BEZIER_N - 1> rev{};
+  auto by2 = bernstein_mul(ys, ys), by = bernstein_mul(ys, ones), bx2 = bernstein_mul(xs, xs);
+  std::copy(by2.begin(), by2.end(), rev.by2), std::copy(by.begin(), by.end(), rev.by), std::copy(bx2.begin(), bx2.end(), rev.bx2);
+  rev.y_min = *std::min_element(ys.begin(), ys.end()), rev.y_max = *std::max_element(ys.begin(), ys.end());
+  for (f64 x : xs) { rev.r_max = std::max(rev.r_max, f32(fabs(x))); }
+  return rev;
+}
+
+const RevolutionPoly<2 * BEZIER_N - 1> REV = revolution_poly();
+
+Vec3 cosine_dir(const Vec3 &w, XorShiftRNG &rng) {
+  f32 r1 = 2.0f * PI * rng.gen(), r2 = rng.gen(), r2s = sqrtf(r2);
+  Vec3 u = w.orthogonal_unit(), v = w.cross(u);
+  return ((u * cosf(r1) + v * sinf(r1)) * r2s + w * sqrtf(1.0f - r2)).norm();
+}
+
+std::vector<RaySet> gen_rays(const KDNode *mesh, u32 n) {
+  XorShiftRNG rng{1};
+  std::vector<RaySet> sets;
+  if (mesh) {
+    Vec3 c = (mesh->min + mesh->max) * 0.5f, ext = mesh->max - mesh->min;
+    f32 diag = ext.len();
+    Vec3 cam = c + Vec3{0.0f, 0.0f, 2.0f * diag}, light = c + Vec3{0.0f, diag, 0.0f};
+    RaySet cams{"camera", {}}, diffuse{"diffuse", {}}, shadow{"shadow", {}};
+    for (u32 tries = 0; tries < 64 * n && (cams.rays.size() < n || diffuse.rays.size() < n); ++tries) {
+      Vec3 target = c + Vec3{(rng.gen() - 0.5f) * ext.x, (rng.gen() - 0.5f) * ext.y, 0.0f};
+      Ray ray{cam, (target - cam).norm()};
+      if (cams.rays.size() < n) { cams.rays.push_back({ray, 1e10f, 0.0f, 0.0f, 0.0f}); }
+      HitRes res{1e10f, Vec3{}, 0, Vec3{}};
+      if (!kd_node_hit(mesh, ray, res, 0, Vec3{})) { continue; }
+      Vec3 p = ray.o + ray.d * res.t, w = res.norm.dot(ray.d) < 0.0f ? res.norm : -res.norm;
+      diffuse.rays.push_back({Ray{p, cosine_dir(w, rng)}, 1e10f, 0.0f, 0.0f, 0.0f});
+      Vec3 l = light - p;
+      shadow.rays.push_back({Ray{p, l.norm()}, l.len(), 0.0f, 0.0f, 0.0f});
+    }
+    for (RaySet *s : {&cams, &diffuse, &shadow}) {
+      if (s->rays.size() > n) { s->rays.resize(n); }
+      sets.push_back(*s);
+    }
+  }
+  // rays toward random points of the surface, seeded near the first hit, within the steps of a proxy mesh
+  RaySet bezier{"bezier", {}};
+  Vec3 cam{0.0f, 1.0f, 6.0f};
+  for (u32 tries = 0; tries < 64 * n && bezier.rays.size() < n; ++tries) {
+    f32 u = 2.0f * PI * rng.gen(), v = rng.gen(), bx, by;
+    EVAL_BEZIER(BEZIER.ps, v, bx, by);
+    Ray ray{cam, (Vec3{bx * cosf(u), by, -bx * sinf(u)} - cam).norm()};
+    f32 hu, hv, ht;
+    Vec3 norm;
+    if (!revolution_hit(REV, BEZIER, ray.o, ray.d, 1e10f, hu, hv, ht, norm)) { continue; }
+    bezier.rays.push_back({ray, 1e10f, hu + (rng.gen() - 0.5f) * DU, hv + (rng.gen() - 0.5f) * DV,
+                           ht * (1.0f + (rng.gen() - 0.5f) * 0.01f)});
+  }
+  sets.push_back(bezier);
+  return sets;
+}
+
+void save_rays(const char *path, const std::vector<RaySet> &sets) {
+  FILE *fp = fopen(path, "wb");
+  if (!fp) { return; }
+  for (const RaySet &s : sets) {
+    u32 n = s.rays.size();
+    fwrite(&n, 4, 1, fp);
+    fwrite(s.rays.data(), sizeof(BenchRay), n, fp);
+  }
+  fclose(fp);
+}
+
+// the sets are in the order of gen_rays
+bool load_rays(const char *path, std::vector<RaySet> &sets, bool mesh) {
+  FILE *fp = fopen(path, "rb");
+  if (!fp) { return false; }
+  const char *names[] = {"camera", "diffuse", "shadow", "bezier"};
+  bool ok = true;
+  for (u32 i = mesh ? 0 : 3; i < 4 && ok; ++i) {
+    u32 n;
+    RaySet s{names[i], {}};
+    ok = fread(&n, 4, 1, fp) == 1;
+    if (ok) {
+      s.rays.resize(n);
+      ok = fread(s.rays.data(), sizeof(BenchRay), n, fp) == n;
+    }
+    sets.push_back(s);
+  }
+  fclose(fp);
+  if (!ok) { sets.clear(); }
+  return ok;
+}
+
+struct Record {
+  const char *kernel, *set;
+  u32 threads, rays;
+  f64 mrays;
+  u64 hits;
+};
+
+// runs kernel on every ray of the set (in parallel), until MIN_TIME has passed
+template <typename K>
+Record measure(const char *kernel, const RaySet &set, u32 threads, K k) {
+  omp_set_num_threads(threads);
+  const std::vector<BenchRay> &rays = set.rays;
+  u32 n = rays.size();
+  u64 hits = 0;
+  f64 time = 0.0;
+  u32 passes = 1;
+  for (;; passes *= 2) {
+    hits = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (u32 p = 0; p < passes; ++p) {
+#pragma omp parallel for schedule(static) reduction(+ : hits)
+      for (u32 i = 0; i < n; ++i) { hits += k(rays[i]); }
+    }
+    time = std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count();
+    if (time >= MIN_TIME || passes >= (1u << 20)) { break; }
+  }
+  return Record{kernel, set.name, threads, n, f64(n) * passes / time * 1e-6, hits / passes};
+}
+
+int main(int argc, char **args) {
+  const char *mesh_path = argc > 1 && strcmp(args[1], "-") ? args[1] : nullptr;
+  u32 n_ray = argc > 2 ? std::atoi(args[2]) : 1 << 16;
+  const char *json_path = argc > 3 ? args[3] : "bench.json";
+  std::vector<u32> blob;
+  const KDNode *mesh = nullptr;
+  std::vector<TriMat> ms;
+  std::vector<Tri> tris;
+  if (mesh_path) {
+    blob = load_mesh(mesh_path);
+    mesh = (const KDNode *) blob.data();
+    collect_tris(mesh, mesh, ms);
+    for (const TriMat &m : ms) { tris.push_back(tri_of(m)); }
+  }
+  std::string ray_path = mesh_path ? std::string(mesh_path) + ".rays" : "bench.rays";
+  std::vector<RaySet> sets;
+  if (load_rays(ray_path.c_str(), sets, mesh)) {
+    fprintf(stderr, "rays loaded from %s\n", ray_path.c_str());
+  } else {
+    sets = gen_rays(mesh, n_ray);
+    save_rays(ray_path.c_str(), sets);
+    fprintf(stderr, "rays recorded in %s\n", ray_path.c_str());
+  }
+  Prims prims{};
+  if (mesh) {
+    Vec3 c = (mesh->min + mesh->max) * 0.5f, ext = mesh->max - mesh->min;
+    prims = Prims{c, ext.len() / 3.0f, Vec3{0.0f, 0.0f, 1.0f}, Vec3{ext.x * 0.5f, 0.0f, 0.0f},
+                  Vec3{0.0f, ext.y * 0.5f, 0.0f}, 2.0f / ext.x, 2.0f / ext.y};
+  }
+
+  std::vector<u32> thread_counts;
+  u32 max_threads = omp_get_max_threads();
+  for (u32 t = 1; t < max_threads; t *= 2) { thread_counts.push_back(t); }
+  thread_counts.push_back(max_threads);
+
+  std::vector<Record> records;
+  for (u32 threads : thread_counts) {
+    for (const RaySet &set : sets) {
+      if (!strcmp(set.name, "bezier")) {
+        records.push_back(measure("newton", set, threads, [&](const BenchRay &r) {
+          f32 u = r.u, v = r.v, t = r.t;
+          Vec3 norm;
+          return rotate_bezier_hit(BEZIER, r.ray.o, r.ray.d, DU, DV, r.t_max, u, v, t, norm);
+        }));
+        records.push_back(measure("revolution", set, threads, [&](const BenchRay &r) {
+          f32 u, v, t;
+          Vec3 norm;
+          return revolution_hit(REV, BEZIER, r.ray.o, r.ray.d, r.t_max, u, v, t, norm);
+        }));
+        continue;
+      }
+      records.push_back(measure("kd_node_hit", set, threads, [&](const BenchRay &r) {
+        HitRes res{r.t_max, Vec3{}, 0, Vec3{}};
+        return kd_node_hit(mesh, r.ray, res, 0, Vec3{});
+      }));
+      // the same triangles for both tests, LEAF_TRIS in a row from a place depending on the ray
+      u32 n_tri = ms.size();
+      records.push_back(measure("trimat", set, threads, [&](const BenchRay &r) {
+        u32 base = u32(&r - set.rays.data()) * 7919u % n_tri, hits = 0;
+        f32 t_max = r.t_max, t, u, v;
+        for (u32 i = 0; i < LEAF_TRIS; ++i) {
+          if (trimat_hit(ms[(base + i) % n_tri], r.ray, t_max, t, u, v)) { t_max = t, ++hits; }
+        }
+        return hits;
+      }));
+      records.push_back(measure("moller", set, threads, [&](const BenchRay &r) {
+        u32 base = u32(&r - set.rays.data()) * 7919u % n_tri, hits = 0;
+        f32 t_max = r.t_max, t, u, v;
+        for (u32 i = 0; i < LEAF_TRIS; ++i) {
+          if (moller_hit(tris[(base + i) % n_tri], r.ray, t_max, t, u, v)) { t_max = t, ++hits; }
+        }
+        return hits;
+      }));
+      records.push_back(measure("sphere", set, threads, [&](const BenchRay &r) {
+        f32 t;
+        return prims.sphere(r.ray, t) && t < r.t_max;
+      }));
+      records.push_back(measure("plane", set, threads, [&](const BenchRay &r) {
+        f32 t;
+        return prims.plane(r.ray, t) && t < r.t_max;
+      }));
+      records.push_back(measure("rectangle", set, threads, [&](const BenchRay &r) {
+        f32 t;
+        return prims.rectangle(r.ray, t) && t < r.t_max;
+      }));
+      records.push_back(measure("circle", set, threads, [&](const BenchRay &r) {
+        f32 t;
+        return prims.circle(r.ray, t) && t < r.t_max;
+      }));
+    }
+  }
+
+  // summary: a row per kernel & ray set, a column per thread count
+  printf("%-12s %-8s %8s %10s", "kernel", "rays", "n", "hits");
+  for (u32 threads : thread_counts) { printf(" %7u thr", threads); }
+  printf("   (Mrays/s)\n");
+  u32 n_row = records.size() / thread_counts.size();
+  for (u32 i = 0; i < n_row; ++i) {
+    const Record &r = records[i];
+    printf("%-12s %-8s %8u %10llu", r.kernel, r.set, r.rays, r.hits);
+    for (u32 j = 0; j < thread_counts.size(); ++j) { printf(" %11.2f", records[j * n_row + i].mrays); }
+    printf("\n");
+  }
+  if (mesh) { printf("mesh: %u triangles (with duplicates in leaves), %u per ray in trimat & moller\n", u32(ms.size()), LEAF_TRIS); }
+
+  FILE *fp = fopen(json_path, "w");
+  if (!fp) { exit((fprintf(stderr, "can't write %s\n", json_path), -1)); }
+  fprintf(fp, "[\n");
+  for (u32 i = 0; i < records.size(); ++i) {
+    const Record &r = records[i];
+    fprintf(fp, "  {\"kernel\": \"%s\", \"rays\": \"%s\", \"n\": %u, \"threads\": %u, \"mrays_per_s\": %.4f, \"hits\": %llu}%s\n",
+            r.kernel, r.set, r.rays, r.threads, r.mrays, r.hits, i + 1 < records.size() ? "," : "");
+  }
+  fprintf(fp, "]\n");
+  fclose(fp);
+}
@@ -0,0 +1,209 @@
+#include "tracer_util.hpp"
+#include "sampler.hpp"
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <complex>
+
+// generate blue noise scrambling tiles for SobolSampler, print them as blue_noise.hpp, and validate them
+// usage: g++ -O3 -march=native -fopenmp blue_noise.cpp && ./a.out > blue_noise.hpp
+// in the style of A Low-Discrepancy Sampler that Distributes Monte Carlo Errors as a Blue Noise in Screen Space
+// https://belcour.github.io/blog/research/publication/2019/06/17/sampling-bluenoise.html
+// every pixel of a tile gets a seed for dimension 2j & 2j + 1, the seeds are swapped between pixels or replaced by
+// unused ones to make the integration errors of nearby pixels different (the energy of Georgiev & Fajardo)
+// validation (stderr): share of the error power in low frequencies, white noise would be about LOW_AREA
+
+constexpr u32 SIZE = 64, N_PAIR = 4;
+constexpr u32 N_FN = 48;                     // #integrand (random heaviside step)
+constexpr u32 SPP = 4;                       // the pixel loop takes 4 samples in a round
+constexpr int RADIUS = 5;
+constexpr f32 SIGMA_I = 2.1f;
+constexpr u32 N_MOVE = 1 << 21;
+constexpr u32 LOW_FREQ = 8;                  // frequencies with radius < LOW_FREQ (of SIZE / 2) are low
+const f32 LOW_AREA = PI * LOW_FREQ * LOW_FREQ / (SIZE * SIZE);
+
+struct Step {
+  Vec2 c, n;
+
+  f32 eval(Vec2 p) const { return (p - c).dot(n) > 0.0f; }
+};
+
+std::vector<Step> gen_steps(std::mt19937 &mt, u32 n) {
+  std::uniform_real_distribution<f32> uni;
+  std::vector<Step> ret;
+  for (u32 i = 0; i < n; ++i) {
+    f32 th = 2.0f * PI * uni(mt);
+    ret.push_back(Step{Vec2{uni(mt), uni(mt)}, Vec2{cosf(th), sinf(th)}});
+  }
+  return ret;
+}
+
+// the first spp samples of dimension 2j & 2j + 1 of a sampler with seed s
+void points(u32 s, u32 j, u32 spp, Vec2 *ps) {
+  SobolSampler rng{s};
+  for (u32 i = 0; i < spp; ++i, rng.next_sample()) {
+    for (u32 d = 0; d < 2 * j; ++d) { rng.gen(); }
+    f32 x = rng.gen(), y = rng.gen();
+    ps[i] = Vec2{x, y};
+  }
+}
+
+// the estimation of each step, the exact integral doesn't matter because only differences are used
+void estimate(u32 s, u32 j, const std::vector<Step> &fns, f32 *err) {
+  Vec2 ps[SPP];
+  points(s, j, SPP, ps);
+  for (u32 f = 0; f < N_FN; ++f) {
+    f32 sum = 0.0f;
+    for (u32 i = 0; i < SPP; ++i) { sum += fns[f].eval(ps[i]); }
+    err[f] = sum / SPP;
+  }
+}
+
+f32 weight_i[2 * RADIUS + 1][2 * RADIUS + 1];
+
+struct Tile {
+  std::vector<u32> seed;
+  std::vector<f32> err; // err[p * N_FN + i]
+  f32 inv_scale;        // to make the mean squared difference 1
+
+  f32 energy(u32 p, u32 at) const {
+    // energy of putting pixel p's seed at position at, except the pair with itself
+    int x = at % SIZE, y = at / SIZE;
+    f32 e = 0.0f;
+    for (int dy = -RADIUS; dy <= RADIUS; ++dy) {
+      for (int dx = -RADIUS; dx <= RADIUS; ++dx) {
+        u32 q = (y + dy + SIZE) % SIZE * SIZE + (x + dx + SIZE) % SIZE;
+        if (q == at || q == p) { continue; }
+        const f32 *a = &err[p * N_FN], *b = &err[q * N_FN];
+        f32 d2 = 0.0f;
+        for (u32 f = 0; f < N_FN; ++f) { d2 += (a[f] - b[f]) * (a[f] - b[f]); }
+        e += weight_i[dy + RADIUS][dx + RADIUS] * expf(-d2 * inv_scale);
+      }
+    }
+    return e;
+  }
+
+  void swap(u32 p, u32 q) {
+    std::swap(seed[p], seed[q]);
+    std::swap_ranges(&err[p * N_FN], &err[(p + 1) * N_FN], &err[q * N_FN]);
+  }
+};
+
+// share of the power of the error image in low frequencies, the mean is removed
+f32 low_freq_power(const std::vector<f32> &img) {
+  f32 mean = 0.0f;
+  for (f32 v : img) { mean += v; }
+  mean /= img.size();
+  f32 low = 0.0f, total = 0.0f;
+  for (int v = 0; v < int(SIZE); ++v) {
+    for (int u = 0; u < int(SIZE); ++u) {
+      std::complex<f32> c{};
+      for (u32 y = 0; y < SIZE; ++y) {
+        for (u32 x = 0; x < SIZE; ++x) {
+          f32 th = -2.0f * PI * (u * x + v * y) / SIZE;
+          c += (img[y * SIZE + x] - mean) * std::complex<f32>{cosf(th), sinf(th)};
+        }
+      }
+      int fu = u < int(SIZE / 2) ? u : u - int(SIZE), fv = v < int(SIZE / 2) ? v : v - int(SIZE);
+      f32 p = std::norm(c);
+      total += p;
+      if (fu * fu + fv * fv < int(LOW_FREQ * LOW_FREQ)) { low += p; }
+    }
+  }
+  return low / total;
+}
+
+f32 validate(const std::vector<u32> &seed, u32 j, const std::vector<Step> &fns) {
+  f32 sum = 0.0f;
+  for (u32 f = 0; f < fns.size(); ++f) {
+    std::vector<f32> img(SIZE * SIZE);
+    for (u32 p = 0; p < SIZE * SIZE; ++p) {
+      Vec2 ps[SPP];
+      points(seed[p], j, SPP, ps);
+      for (u32 i = 0; i < SPP; ++i) { img[p] += fns[f].eval(ps[i]) / SPP; }
+    }
+    sum += low_freq_power(img);
+  }
+  return sum / fns.size();
+}
+
+int main() {
+  for (int dy = -RADIUS; dy <= RADIUS; ++dy) {
+    for (int dx = -RADIUS; dx <= RADIUS; ++dx) {
+      weight_i[dy + RADIUS][dx + RADIUS] = expf(-(dx * dx + dy * dy) / (SIGMA_I * SIGMA_I));
+    }
+  }
+  std::vector<Tile> tiles(N_PAIR);
+#pragma omp parallel for schedule(dynamic, 1)
+  for (u32 j = 0; j < N_PAIR; ++j) {
+    std::mt19937 mt{19260817 + j};
+    std::vector<Step> fns = gen_steps(mt, N_FN);
+    Tile &t = tiles[j];
+    // distinct seeds, never used by the per pixel seeding of the pixel loop for a reasonable resolution
+    std::vector<u32> all(1 << 16);
+    for (u32 i = 0; i < all.size(); ++i) { all[i] = (1u << 24) + i; }
+    std::shuffle(all.begin(), all.end(), mt);
+    t.seed.assign(all.begin(), all.begin() + SIZE * SIZE);
+    t.err.resize(SIZE * SIZE * N_FN);
+    for (u32 p = 0; p < SIZE * SIZE; ++p) { estimate(t.seed[p], j, fns, &t.err[p * N_FN]); }
+    double s = 0.0;
+    for (u32 i = 0; i < 4096; ++i) {
+      u32 p = mt() % (SIZE * SIZE), q = mt() % (SIZE * SIZE);
+      for (u32 f = 0; f < N_FN; ++f) {
+        f32 d = t.err[p * N_FN + f] - t.err[q * N_FN + f];
+        s += d * d;
+      }
+    }
+    t.inv_scale = s > 0.0 ? 4096.0 / s : 0.0f;
+    // greedy search, either swap the seeds of 2 pixels, or replace the seed of a pixel by an unused one
+    std::vector<u32> spare(all.begin() + SIZE * SIZE, all.end());
+    u32 accepted = 0;
+    f32 cand[N_FN];
+    for (u32 it = 0; it < N_MOVE; ++it) {
+      u32 p = mt() % (SIZE * SIZE);
+      if (it & 1) {
+        u32 q = mt() % (SIZE * SIZE);
+        if (p == q) { continue; }
+        f32 before = t.energy(p, p) + t.energy(q, q), after = t.energy(p, q) + t.energy(q, p);
+        if (after < before) {
+          t.swap(p, q);
+          ++accepted;
+        }
+      } else {
+        u32 i = mt() % spare.size();
+        estimate(spare[i], j, fns, cand);
+        f32 before = t.energy(p, p);
+        std::vector<f32> old(&t.err[p * N_FN], &t.err[(p + 1) * N_FN]);
+        std::copy(cand, cand + N_FN, &t.err[p * N_FN]);
+        if (t.energy(p, p) < before) {
+          std::swap(t.seed[p], spare[i]);
+          ++accepted;
+        } else {
+          std::copy(old.begin(), old.end(), &t.err[p * N_FN]);
+        }
+      }
+    }
+    fprintf(stderr, "pair %d: %d moves accepted\n", j, accepted);
+  }
+  // validate with other integrands, compared with the seeds before optimization
+  for (u32 j = 0; j < N_PAIR; ++j) {
+    std::mt19937 mt{19660813 + j};
+    std::vector<Step> fns = gen_steps(mt, 4);
+    std::vector<u32> shuffled = tiles[j].seed;
+    std::shuffle(shuffled.begin(), shuffled.end(), mt);
+    fprintf(stderr, "pair %d: low frequency power %.4f, shuffled %.4f, white noise %.4f\n", j,
+            validate(tiles[j].seed, j, fns), validate(shuffled, j, fns), LOW_AREA);
+  }
+  printf("// generated by tool/blue_noise.cpp\n");
+  printf("constexpr u32 BLUE_NOISE_SIZE = %d, BLUE_NOISE_PAIR = %d;\n\n", SIZE, N_PAIR);
+  printf("// BLUE_NOISE_SEED[j][y * BLUE_NOISE_SIZE + x]: seed of dimension 2j & 2j + 1 of pixel (x, y)\n");
+  printf("const u32 BLUE_NOISE_SEED[BLUE_NOISE_PAIR][BLUE_NOISE_SIZE * BLUE_NOISE_SIZE] = {\n");
+  for (u32 j = 0; j < N_PAIR; ++j) {
+    printf("  {");
+    for (u32 p = 0; p < SIZE * SIZE; ++p) {
+      printf("%s%d", p == 0 ? "" : p % 16 == 0 ? ",\n   " : ", ", tiles[j].seed[p]);
+    }
+    printf("},\n");
+  }
+  printf("};\n");
+}
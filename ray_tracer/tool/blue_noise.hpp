@@ -0,0 +1,1030 @@
+// generated by tool/blue_noise.cpp
+constexpr u32 BLUE_NOISE_SIZE = 64, BLUE_NOISE_PAIR = 4;
+
+// BLUE_NOISE_SEED[j][y * BLUE_NOISE_SIZE + x]: seed of dimension 2j & 2j + 1 of pixel (x, y)
+const u32 BLUE_NOISE_SEED[BLUE_NOISE_PAIR][BLUE_NOISE_SIZE * BLUE_NOISE_SIZE] = {
+  {16799725, 16832237, 16788263, 16809911, 16796632, 16785116, 16800955, 16813849, 16837101, 16817317, 16778863, 16792921, 16841811, 16842656, 16841954, 16824914,
+   16828170, 16787264, 16799095, 16788246, 16805792, 16815349, 16838005, 16790218, 16810741, 16835257, 16804368, 16826718, 16800936, 16828297, 16820576, 16790735,
+   16801396, 16827049, 16794567, 16788012, 16797404, 16779343, 16794742, 16817678, 16819819, 16830218, 16835777, 16817000, 16814434, 16821583, 16818129, 16801436,
+   16814932, 16816896, 16806294, 16803320, 16836443, 16792094, 16797128, 16786302, 16810045, 16794534, 16790904, 16799790, 16810760, 16826027, 16819092, 16786728,
+   16813563, 16782225, 16777799, 16780440, 16838216, 16805931, 16841411, 16806731, 16822225, 16802246, 16837115, 16823581, 16837439, 16790689, 16832293, 16821933,
+   16792176, 16792977, 16792739, 16827362, 16829194, 16812139, 16803810, 16834320, 16778247, 16841249, 16828598, 16840103, 16821090, 16823383, 16784971, 16829050,
+   16821079, 16780970, 16788150, 16834639, 16840449, 16826077, 16817181, 16793211, 16840679, 16815133, 16820734, 16803601, 16837019, 16841496, 16793963, 16800872,
+   16832081, 16784095, 16833577, 16818479, 16829827, 16840637, 16818308, 16826794, 16831640, 16830793, 16828968, 16798289, 16824070, 16824347, 16802947, 16789418,
+   16797127, 16781761, 16803027, 16787072, 16840335, 16822167, 16780362, 16810636, 16832469, 16808984, 16789918, 16809886, 16802726, 16805320, 16791511, 16821502,
+   16811876, 16780167, 16778939, 16795147, 16792786, 16790645, 16830625, 16783677, 16782522, 16785763, 16809332, 16782416, 16841486, 16818643, 16789487, 16818206,
+   16790002, 16838248, 16811800, 16785482, 16783671, 16822892, 16786350, 16835007, 16787840, 16783434, 16800934, 16810869, 16837668, 16783468, 16811713, 16798767,
+   16841778, 16826444, 16782734, 16795751, 16827781, 16813109, 16813215, 16840910, 16808050, 16814258, 16820326, 16778757, 16816065, 16787587, 16808787, 16817710,
+   16831684, 16818340, 16836829, 16781570, 16808978, 16814869, 16784666, 16810934, 16798704, 16839658, 16811284, 16801064, 16826001, 16818584, 16822444, 16817260,
+   16799646, 16838986, 16791810, 16779003, 16833366, 16783038, 16828105, 16795551, 16814926, 16784692, 16778079, 16793021, 16780769, 16837964, 16816189, 16802299,
+   16784520, 16809924, 16777491, 16824215, 16807863, 16805149, 16826959, 16830923, 16801841, 16821660, 16783542, 16839097, 16805828, 16813620, 16832368, 16779639,
+   16819870, 16840876, 16811155, 16826403, 16823167, 16834353, 16790216, 16833072, 16829938, 16820118, 16805232, 16838124, 16810381, 16792934, 16834115, 16781514,
+   16784915, 16793309, 16809518, 16806830, 16812527, 16818394, 16787473, 16785852, 16816060, 16808372, 16795339, 16820503, 16778708, 16816113, 16787567, 16825333,
+   16800078, 16829239, 16816179, 16806393, 16829494, 16821477, 16778754, 16836020, 16791470, 16794260, 16786336, 16820512, 16801678, 16827455, 16789283, 16841400,
+   16777395, 16788353, 16784000, 16784356, 16795332, 16841572, 16788369, 16790072, 16803862, 16778444, 16811685, 16818342, 16789826, 16785475, 16828710, 16782710,
+   16777368, 16840984, 16789100, 16796820, 16831780, 16814363, 16788423, 16799429, 16801362, 16833991, 16808639, 16802812, 16833318, 16816598, 16785448, 16829281,
+   16823003, 16826254, 16829232, 16807523, 16827343, 16837337, 16831312, 16838472, 16799276, 16841239, 16805877, 16789175, 16819561, 16791022, 16816455, 16840978,
+   16784967, 16779988, 16840960, 16802570, 16801467, 16780418, 16821825, 16829261, 16819358, 16777914, 16781062, 16837317, 16799259, 16803960, 16803700, 16806504,
+   16813263, 16827747, 16842682, 16804271, 16816323, 16790006, 16815388, 16806280, 16840913, 16837361, 16819767, 16799832, 16836868, 16813480, 16782918, 16823817,
+   16831342, 16798215, 16794216, 16805350, 16794608, 16827020, 16821364, 16809760, 16824005, 16815069, 16778733, 16804304, 16798576, 16840551, 16808151, 16803624,
+   16825019, 16797920, 16833542, 16804506, 16809964, 16796503, 16820511, 16783700, 16797138, 16784742, 16792719, 16834020, 16842212, 16835955, 16802130, 16796143,
+   16801569, 16792419, 16834466, 16820060, 16810980, 16802795, 16824949, 16810788, 16788820, 16805346, 16824964, 16808700, 16838066, 16832793, 16840081, 16807813,
+   16777921, 16821165, 16823506, 16794958, 16812821, 16807836, 16788709, 16814210, 16822656, 16804636, 16833949, 16795606, 16810717, 16798035, 16802242, 16830881,
+   16779934, 16838155, 16819370, 16799077, 16837325, 16796046, 16829025, 16786526, 16797202, 16788565, 16778135, 16841183, 16819543, 16796626, 16784314, 16816512,
+   16795236, 16829113, 16829782, 16832124, 16841002, 16832156, 16811957, 16818739, 16778364, 16808666, 16807642, 16809899, 16842090, 16832753, 16830227, 16811674,
+   16836326, 16804611, 16787797, 16836054, 16828115, 16829737, 16794164, 16788442, 16793047, 16815283, 16828480, 16800404, 16794381, 16790231, 16779933, 16808708,
+   16807514, 16780122, 16830860, 16825137, 16820302, 16838914, 16813637, 16834006, 16798158, 16841534, 16806284, 16796157, 16842017, 16793119, 16803184, 16838306,
+   16785564, 16781452, 16801663, 16806739, 16832747, 16815415, 16817652, 16798892, 16837238, 16792275, 16829170, 16785459, 16801204, 16812618, 16832871, 16791696,
+   16832656, 16811460, 16806184, 16824143, 16777771, 16804392, 16823219, 16785001, 16811117, 16836967, 16792411, 16800045, 16779240, 16826702, 16822090, 16838307,
+   16841609, 16831918, 16778553, 16841079, 16797192, 16796549, 16816254, 16824789, 16842219, 16825667, 16792328, 16791800, 16823619, 16784786, 16811514, 16840822,
+   16783009, 16830673, 16809183, 16812867, 16826874, 16799684, 16835528, 16829293, 16781159, 16824966, 16814281, 16814753, 16842666, 16815782, 16838224, 16795614,
+   16807540, 16837527, 16838612, 16813015, 16824961, 16819990, 16825779, 16801450, 16811429, 16782349, 16804710, 16814398, 16826262, 16779032, 16839203, 16830428,
+   16789480, 16814656, 16825793, 16782817, 16780494, 16781646, 16793601, 16814421, 16840262, 16788061, 16782713, 16812093, 16800941, 16823744, 16833329, 16784189,
+   16792634, 16827437, 16810418, 16783712, 16813766, 16801915, 16814488, 16789372, 16785235, 16792133, 16816227, 16835507, 16834869, 16829131, 16805517, 16808376,
+   16805242, 16822193, 16785436, 16812411, 16814290, 16842119, 16820655, 16837059, 16786209, 16811630, 16839059, 16782985, 16798337, 16838943, 16816349, 16800128,
+   16816288, 16785321, 16838231, 16822962, 16816388, 16781702, 16829367, 16820055, 16807877, 16841938, 16808766, 16788331, 16795574, 16820027, 16792375, 16811439,
+   16791582, 16807941, 16828449, 16822302, 16809087, 16841717, 16784659, 16832427, 16813989, 16839223, 16798261, 16794138, 16824254, 16818225, 16807597, 16808774,
+   16836605, 16785287, 16792421, 16780286, 16786106, 16807674, 16813157, 16782673, 16818440, 16791300, 16809425, 16837250, 16794700, 16790086, 16778697, 16822308,
+   16824109, 16807622, 16820577, 16833790, 16840754, 16793666, 16787804, 16811161, 16821411, 16796280, 16832587, 16839680, 16835282, 16816961, 16815530, 16827944,
+   16794574, 16837812, 16820173, 16778552, 16824344, 16828892, 16835965, 16783948, 16785654, 16814929, 16801818, 16824571, 16798526, 16779618, 16822413, 16780582,
+   16838997, 16796006, 16803181, 16781967, 16829894, 16829393, 16787447, 16811844, 16778413, 16788283, 16806056, 16808643, 16814668, 16789161, 16789243, 16785073,
+   16827355, 16784856, 16826993, 16779815, 16817296, 16815604, 16799578, 16802635, 16818512, 16829526, 16836474, 16812639, 16781666, 16782826, 16829865, 16789148,
+   16802924, 16784272, 16791303, 16788696, 16789345, 16796209, 16815601, 16825747, 16842611, 16823703, 16823127, 16823841, 16794117, 16800394, 16813708, 16787924,
+   16824439, 16835409, 16841070, 16816104, 16784598, 16780109, 16839912, 16832348, 16798808, 16824952, 16795863, 16836017, 16794859, 16819372, 16795017, 16836581,
+   16795506, 16837043, 16777859, 16840153, 16804393, 16778038, 16804205, 16804375, 16800733, 16787610, 16818871, 16794557, 16838384, 16839525, 16828780, 16781198,
+   16824644, 16837912, 16816007, 16816658, 16809743, 16801097, 16826504, 16786431, 16812673, 16807334, 16814943, 16786283, 16777854, 16829880, 16786632, 16825158,
+   16841345, 16807518, 16809894, 16788228, 16832132, 16790409, 16794411, 16803662, 16794959, 16842238, 16796432, 16778785, 16837656, 16799838, 16777400, 16803948,
+   16811681, 16811725, 16803505, 16817893, 16787736, 16783669, 16820650, 16787103, 16836892, 16816269, 16816693, 16781712, 16823297, 16815761, 16836216, 16791203,
+   16800028, 16796277, 16810062, 16802986, 16808409, 16799088, 16808198, 16811163, 16841043, 16793207, 16779783, 16781776, 16812442, 16803901, 16840417, 16833375,
+   16835216, 16819095, 16838632, 16832673, 16799586, 16819842, 16784661, 16785210, 16788694, 16782721, 16778936, 16777221, 16834269, 16814552, 16795245, 16826725,
+   16832477, 16820470, 16830972, 16814518, 16806422, 16835663, 16816923, 16817084, 16797981, 16834934, 16817533, 16830382, 16780704, 16816649, 16834498, 16813094,
+   16789042, 16823366, 16827269, 16779707, 16812688, 16821967, 16800907, 16827371, 16797481, 16785115, 16820729, 16828219, 16827007, 16837595, 16793668, 16812041,
+   16820740, 16796900, 16836982, 16799519, 16821286, 16807126, 16788156, 16801822, 16807876, 16831011, 16795456, 16779111, 16803552, 16793089, 16813538, 16823013,
+   16812652, 16840079, 16799595, 16795754, 16841870, 16819669, 16813618, 16786231, 16791652, 16822598, 16837606, 16819382, 16838211, 16812133, 16812694, 16782018,
+   16835516, 16826086, 16819900, 16830916, 16794095, 16791386, 16787168, 16801260, 16837942, 16779251, 16796228, 16821276, 16832195, 16788776, 16788222, 16791279,
+   16810367, 16837251, 16840040, 16835267, 16787174, 16818821, 16821385, 16785471, 16802340, 16811788, 16777738, 16789625, 16804827, 16779541, 16803222, 16784446,
+   16787157, 16832443, 16814675, 16790090, 16800943, 16785942, 16786121, 16793932, 16821490, 16805156, 16813948, 16812014, 16789119, 16819282, 16839855, 16833861,
+   16784510, 16831013, 16811515, 16828686, 16832255, 16839776, 16796796, 16807568, 16817964, 16837563, 16779351, 16808391, 16799372, 16833613, 16832259, 16834693,
+   16842280, 16820287, 16795130, 16816395, 16806000, 16838012, 16800671, 16835620, 16821402, 16826115, 16808660, 16800375, 16803182, 16806061, 16831626, 16780259,
+   16784820, 16817745, 16802813, 16822632, 16778234, 16799010, 16779863, 16823801, 16781319, 16807133, 16831293, 16836521, 16777444, 16797171, 16784227, 16779923,
+   16824138, 16815715, 16781089, 16813745, 16785164, 16782321, 16786759, 16798953, 16792585, 16841801, 16804481, 16811847, 16807357, 16814061, 16831002, 16839312,
+   16814189, 16837772, 16790604, 16826525, 16812957, 16781915, 16833541, 16791249, 16831740, 16813067, 16795211, 16805910, 16836942, 16826084, 16840345, 16794863,
+   16836477, 16807634, 16791156, 16828679, 16777941, 16804383, 16815944, 16817627, 16812325, 16793468, 16785887, 16780028, 16830569, 16779610, 16829188, 16817332,
+   16783924, 16817856, 16824946, 16821409, 16828452, 16803806, 16816015, 16818951, 16825992, 16794826, 16836107, 16826915, 16815822, 16811032, 16777316, 16812859,
+   16782602, 16816329, 16780837, 16779219, 16813327, 16804347, 16790430, 16779722, 16777888, 16788107, 16822442, 16839333, 16797152, 16806138, 16842111, 16799494,
+   16814889, 16827650, 16832948, 16840396, 16797762, 16803740, 16799302, 16801660, 16806043, 16780869, 16839200, 16810040, 16801269, 16839632, 16787765, 16823352,
+   16817811, 16821709, 16778547, 16837740, 16785148, 16840837, 16797669, 16780646, 16782139, 16784670, 16809642, 16822439, 16783418, 16831916, 16833253, 16838322,
+   16840098, 16804820, 16842483, 16780068, 16829071, 16797992, 16795347, 16796084, 16811991, 16813813, 16792420, 16785152, 16781489, 16840862, 16806439, 16800484,
+   16804123, 16801552, 16806104, 16800495, 16818138, 16795985, 16781561, 16839399, 16782997, 16784620, 16827835, 16825672, 16840567, 16842294, 16778356, 16819797,
+   16787225, 16781909, 16784863, 16829926, 16823363, 16779681, 16833142, 16818157, 16786290, 16834185, 16831266, 16792815, 16778542, 16836770, 16781885, 16840999,
+   16805155, 16834864, 16795508, 16831718, 16830629, 16799488, 16788128, 16827510, 16793380, 16817025, 16813582, 16799761, 16825565, 16833950, 16788247, 16779374,
+   16810953, 16791546, 16810539, 16806855, 16798700, 16807249, 16787991, 16825503, 16796854, 16783464, 16828617, 16810882, 16831431, 16786612, 16791408, 16829615,
+   16789564, 16778709, 16834642, 16792532, 16800032, 16812131, 16780919, 16785237, 16838946, 16834720, 16799148, 16825979, 16783136, 16792925, 16789997, 16812875,
+   16808665, 16778344, 16811396, 16782943, 16798549, 16807756, 16818116, 16807095, 16788072, 16831089, 16841912, 16805290, 16791254, 16807802, 16834813, 16833707,
+   16830312, 16812463, 16834873, 16818210, 16810238, 16837737, 16823578, 16833484, 16838399, 16841235, 16800690, 16789510, 16812864, 16808246, 16796378, 16810391,
+   16809591, 16794149, 16805307, 16812358, 16813180, 16838966, 16800196, 16798723, 16809270, 16799379, 16827889, 16798505, 16842030, 16793359, 16781857, 16782549,
+   16828385, 16815085, 16837991, 16842023, 16781560, 16815683, 16792253, 16831750, 16802355, 16808496, 16777920, 16786216, 16827139, 16816409, 16800586, 16821743,
+   16794135, 16804250, 16802582, 16828443, 16809852, 16782062, 16827971, 16803989, 16831535, 16841376, 16799075, 16834087, 16824459, 16824799, 16777878, 16790325,
+   16806050, 16833641, 16837596, 16811924, 16783570, 16780008, 16803254, 16782229, 16798975, 16807964, 16785941, 16813610, 16785106, 16802238, 16829868, 16838432,
+   16808308, 16842530, 16796803, 16799701, 16808457, 16787772, 16803258, 16841058, 16828771, 16838583, 16809293, 16811783, 16807950, 16783018, 16812334, 16840297,
+   16828181, 16837781, 16832572, 16779053, 16794685, 16818517, 16782802, 16817294, 16825476, 16801329, 16808848, 16783316, 16777378, 16805508, 16827965, 16795322,
+   16829707, 16833174, 16816121, 16823459, 16827990, 16816379, 16806193, 16792672, 16789768, 16825556, 16828217, 16842397, 16829225, 16842304, 16830830, 16818465,
+   16822878, 16783354, 16802404, 16796999, 16834397, 16784055, 16839242, 16809859, 16815038, 16829005, 16809492, 16808272, 16778956, 16824090, 16795765, 16800358,
+   16834837, 16828036, 16825435, 16828379, 16785180, 16789955, 16832233, 16813578, 16841595, 16815766, 16838560, 16782131, 16803066, 16812817, 16812427, 16818390,
+   16834815, 16789672, 16785008, 16806785, 16812453, 16808663, 16804538, 16793554, 16821511, 16810537, 16839667, 16803728, 16838600, 16801926, 16796189, 16821287,
+   16826282, 16791258, 16784637, 16833909, 16829626, 16781041, 16840070, 16791126, 16806562, 16832522, 16813670, 16790146, 16786724, 16825796, 16783982, 16839229,
+   16804865, 16783905, 16810627, 16818694, 16815357, 16796425, 16824887, 16836207, 16832324, 16815934, 16821443, 16797628, 16794840, 16837341, 16812065, 16790323,
+   16814826, 16818185, 16820717, 16787955, 16833980, 16835080, 16778156, 16805184, 16824627, 16798828, 16804722, 16793061, 16813403, 16806838, 16803202, 16792602,
+   16792623, 16792159, 16809331, 16789718, 16801039, 16801334, 16836485, 16811838, 16839860, 16786936, 16779386, 16840805, 16829234, 16794225, 16831059, 16831563,
+   16830425, 16779763, 16827299, 16838830, 16806595, 16830112, 16821503, 16839953, 16825194, 16827680, 16801435, 16804508, 16807045, 16793721, 16784750, 16796240,
+   16834810, 16829240, 16801384, 16828428, 16838810, 16794777, 16816374, 16810399, 16821630, 16784719, 16830143, 16783433, 16795651, 16811697, 16828642, 16797223,
+   16786007, 16840704, 16799657, 16834084, 16789800, 16783987, 16784127, 16822548, 16819457, 16820685, 16825731, 16794831, 16791835, 16841285, 16821534, 16829197,
+   16800192, 16809582, 16798252, 16842097, 16825790, 16812033, 16805809, 16841084, 16785931, 16800033, 16812964, 16800996, 16837144, 16804380, 16808562, 16803236,
+   16811843, 16777449, 16839498, 16789147, 16838187, 16797681, 16841832, 16797225, 16822471, 16841270, 16779676, 16829553, 16834458, 16783368, 16798263, 16825772,
+   16783526, 16786467, 16777366, 16797057, 16827277, 16784447, 16795395, 16838065, 16838608, 16781533, 16783992, 16782245, 16828662, 16811109, 16821953, 16778288,
+   16807630, 16831496, 16794254, 16791736, 16804032, 16794815, 16822525, 16817242, 16777527, 16800695, 16838704, 16837647, 16820352, 16778613, 16780114, 16801594,
+   16801146, 16782141, 16831836, 16829969, 16792931, 16816682, 16805229, 16803436, 16782193, 16783230, 16798343, 16837224, 16783506, 16820703, 16780266, 16804920,
+   16836411, 16814775, 16808983, 16799618, 16831285, 16817438, 16840550, 16793655, 16803154, 16788748, 16805542, 16802814, 16827462, 16800516, 16793837, 16841253,
+   16806660, 16807229, 16789006, 16778938, 16780631, 16830469, 16797764, 16791690, 16813543, 16799278, 16833897, 16809157, 16788452, 16821905, 16838126, 16786457,
+   16786537, 16791051, 16796067, 16813808, 16785078, 16841129, 16830003, 16784425, 16809519, 16829078, 16839868, 16833039, 16824702, 16811184, 16791170, 16781211,
+   16786859, 16813906, 16812043, 16835835, 16833270, 16788317, 16805086, 16834434, 16818523, 16840945, 16832894, 16785306, 16827929, 16789015, 16777462, 16794137,
+   16818738, 16825749, 16835452, 16804799, 16779312, 16786937, 16811950, 16839575, 16798235, 16796025, 16788209, 16841951, 16780474, 16822743, 16821785, 16826649,
+   16818934, 16793205, 16828014, 16791091, 16826901, 16788982, 16840784, 16791527, 16780761, 16794277, 16829469, 16829326, 16778899, 16822351, 16823148, 16791261,
+   16779134, 16818016, 16818371, 16838906, 16815362, 16798784, 16809431, 16819545, 16785217, 16788593, 16791996, 16824843, 16805996, 16798413, 16780398, 16789428,
+   16810736, 16780564, 16822078, 16811270, 16786684, 16784981, 16832825, 16813087, 16779698, 16816033, 16823965, 16802890, 16828321, 16780733, 16788410, 16788994,
+   16797320, 16790748, 16810431, 16795961, 16786760, 16786072, 16793768, 16836434, 16839955, 16803938, 16821948, 16785512, 16834855, 16838693, 16811913, 16817342,
+   16839149, 16827865, 16827115, 16796250, 16802728, 16785726, 16818205, 16819826, 16783502, 16835415, 16823946, 16809544, 16814250, 16833475, 16794886, 16832472,
+   16828648, 16784943, 16821301, 16788859, 16840083, 16798752, 16801535, 16778016, 16831953, 16790761, 16805004, 16830975, 16817718, 16800019, 16798800, 16812063,
+   16803277, 16780288, 16836712, 16811804, 16829489, 16816178, 16778429, 16791243, 16839474, 16825378, 16818971, 16813524, 16825110, 16793534, 16832584, 16783042,
+   16818054, 16824054, 16827059, 16793892, 16805636, 16807811, 16806264, 16820628, 16842494, 16833034, 16777793, 16812827, 16826608, 16781601, 16828050, 16784828,
+   16820464, 16818591, 16780484, 16785826, 16798996, 16824937, 16824388, 16828362, 16781297, 16833938, 16787938, 16832563, 16807253, 16818136, 16785541, 16810359,
+   16833466, 16802455, 16805088, 16783247, 16789343, 16814777, 16779157, 16783979, 16815018, 16819064, 16795039, 16817803, 16833461, 16824423, 16841528, 16809596,
+   16782551, 16785625, 16792695, 16833477, 16828986, 16824666, 16823343, 16787448, 16837848, 16839501, 16839275, 16840138, 16829147, 16841241, 16826618, 16836964,
+   16825475, 16795771, 16818338, 16807016, 16806483, 16789086, 16807199, 16780142, 16787533, 16798778, 16781172, 16782643, 16832806, 16805848, 16822172, 16813923,
+   16820024, 16835964, 16831405, 16830509, 16799272, 16814060, 16805960, 16842104, 16816347, 16828634, 16827932, 16815749, 16818791, 16828025, 16806811, 16808395,
+   16789643, 16784416, 16781012, 16814555, 16819840, 16793969, 16841473, 16798617, 16791265, 16799571, 16805005, 16808657, 16820067, 16834958, 16839806, 16808752,
+   16797792, 16789606, 16813572, 16828034, 16813588, 16829400, 16796885, 16782726, 16793920, 16814380, 16800939, 16793885, 16781518, 16793717, 16804923, 16820239,
+   16836878, 16842262, 16831554, 16838486, 16835117, 16816588, 16797328, 16834204, 16838934, 16842695, 16826948, 16835614, 16796622, 16801190, 16831522, 16840871,
+   16842125, 16837410, 16781923, 16807565, 16823546, 16788251, 16786044, 16836476, 16785562, 16781852, 16777742, 16810594, 16832240, 16806391, 16838753, 16820860,
+   16804055, 16780391, 16821764, 16823983, 16796220, 16810056, 16795541, 16828489, 16809440, 16794134, 16839930, 16806644, 16777853, 16829090, 16802466, 16790351,
+   16778342, 16806030, 16836886, 16814793, 16788323, 16791934, 16824670, 16782858, 16822710, 16828173, 16782198, 16782223, 16790040, 16837732, 16806377, 16796048,
+   16821689, 16799885, 16836101, 16831443, 16798765, 16828236, 16816472, 16821128, 16804267, 16825109, 16832850, 16790541, 16827695, 16819641, 16790570, 16793759,
+   16795925, 16836003, 16824383, 16777392, 16798191, 16827775, 16796635, 16801539, 16799744, 16790864, 16826469, 16813679, 16790450, 16799133, 16809196, 16833213,
+   16830384, 16819965, 16803957, 16801620, 16811524, 16800719, 16840324, 16826112, 16777497, 16788840, 16799728, 16818987, 16779845, 16810982, 16785044, 16829697,
+   16812349, 16778865, 16827696, 16816509, 16802080, 16829414, 16810334, 16809094, 16821612, 16801769, 16781569, 16823692, 16830530, 16810728, 16820168, 16814144,
+   16799475, 16812246, 16822794, 16817249, 16837468, 16811488, 16799901, 16839664, 16819023, 16829103, 16788918, 16783310, 16793387, 16821193, 16791419, 16809772,
+   16841773, 16813187, 16798507, 16791754, 16830335, 16831032, 16791799, 16838288, 16791456, 16819659, 16800391, 16778489, 16823660, 16839624, 16789416, 16837445,
+   16809204, 16778749, 16798856, 16806068, 16777547, 16797745, 16791377, 16785705, 16838283, 16807800, 16782833, 16802227, 16790519, 16781975, 16830567, 16825010,
+   16796484, 16780428, 16806639, 16786407, 16826285, 16835268, 16828447, 16825761, 16784448, 16837941, 16814416, 16811140, 16835014, 16837837, 16778589, 16783706,
+   16836979, 16799695, 16779496, 16810266, 16805562, 16821326, 16778802, 16805303, 16833341, 16796375, 16783535, 16796393, 16815691, 16778998, 16806323, 16787006,
+   16796828, 16840690, 16799952, 16806465, 16807400, 16833971, 16815671, 16819096, 16790929, 16802752, 16838590, 16781618, 16808972, 16785875, 16796972, 16818270,
+   16834297, 16826378, 16830831, 16817911, 16837961, 16786017, 16781129, 16836502, 16810362, 16842343, 16792846, 16788412, 16833420, 16806708, 16809650, 16819001,
+   16796838, 16820691, 16810849, 16807223, 16803083, 16823850, 16808317, 16812871, 16828578, 16780205, 16815909, 16788872, 16811021, 16840607, 16789274, 16797513,
+   16799029, 16831877, 16842128, 16827200, 16825913, 16802553, 16825351, 16823369, 16808011, 16801742, 16810948, 16809978, 16785260, 16807315, 16842268, 16838706,
+   16789968, 16841092, 16827492, 16824757, 16837155, 16831327, 16782511, 16827039, 16807959, 16819609, 16830760, 16817700, 16791025, 16836564, 16840403, 16786682,
+   16792499, 16802058, 16797976, 16787000, 16777420, 16799613, 16811173, 16805145, 16824232, 16829575, 16840390, 16829317, 16833063, 16825139, 16836285, 16784628,
+   16792371, 16785489, 16820123, 16779192, 16813451, 16837056, 16817061, 16829006, 16808707, 16796179, 16798918, 16828535, 16821827, 16822700, 16838007, 16814875,
+   16823376, 16837936, 16802653, 16783005, 16794468, 16800052, 16794931, 16826317, 16792888, 16780234, 16818450, 16795381, 16840518, 16816175, 16825915, 16803598,
+   16794934, 16803048, 16786478, 16786944, 16780666, 16804184, 16817455, 16832952, 16792464, 16795120, 16808353, 16790185, 16782014, 16826161, 16802160, 16814095,
+   16825881, 16806388, 16814460, 16804101, 16779814, 16821406, 16822821, 16809013, 16792876, 16804186, 16813930, 16813847, 16779701, 16830310, 16813474, 16839928,
+   16810861, 16793101, 16806853, 16785392, 16778198, 16781463, 16821731, 16794936, 16806163, 16791175, 16801532, 16786104, 16826578, 16816403, 16821061, 16792217,
+   16786611, 16819379, 16832102, 16809114, 16834801, 16817672, 16811383, 16828498, 16820172, 16817104, 16788864, 16810895, 16803380, 16796383, 16782558, 16791744,
+   16806661, 16800810, 16820476, 16781381, 16822235, 16840307, 16821771, 16784881, 16836900, 16836871, 16807424, 16777952, 16818082, 16813852, 16802318, 16806835,
+   16822470, 16806904, 16821123, 16805058, 16802489, 16782633, 16779640, 16806788, 16786395, 16782961, 16798968, 16806617, 16806690, 16803873, 16825742, 16834102,
+   16793269, 16816333, 16783505, 16837982, 16840415, 16777220, 16807928, 16842579, 16833192, 16807033, 16833785, 16781184, 16838863, 16786651, 16804597, 16785940,
+   16783612, 16808922, 16832402, 16793174, 16793172, 16783332, 16819643, 16841627, 16799853, 16802708, 16818864, 16780601, 16807091, 16834706, 16834645, 16802485,
+   16828141, 16838301, 16830525, 16812965, 16840571, 16819180, 16836429, 16810320, 16805226, 16780928, 16835100, 16842573, 16840393, 16802005, 16792170, 16842685,
+   16828269, 16816404, 16787060, 16782776, 16803271, 16825067, 16793690, 16839314, 16787622, 16783868, 16820652, 16819436, 16813110, 16831668, 16807594, 16817423,
+   16788743, 16808420, 16826684, 16827291, 16817804, 16814937, 16784903, 16813533, 16823402, 16798637, 16795409, 16828754, 16830135, 16815870, 16820198, 16792608,
+   16779350, 16840033, 16831019, 16805494, 16797647, 16825095, 16792592, 16829537, 16802039, 16837542, 16811484, 16826607, 16837684, 16816716, 16811549, 16794879,
+   16777603, 16800718, 16810835, 16794555, 16830783, 16780254, 16829572, 16828026, 16802073, 16832534, 16807263, 16779821, 16779025, 16841675, 16808400, 16809181,
+   16796784, 16824791, 16799345, 16818950, 16824774, 16806059, 16814577, 16788798, 16816924, 16799644, 16815647, 16809657, 16821369, 16804245, 16820966, 16794275,
+   16796255, 16784450, 16797809, 16825657, 16819654, 16812928, 16808361, 16812687, 16815373, 16818346, 16797748, 16815148, 16831222, 16840492, 16839481, 16818593,
+   16805820, 16779438, 16783219, 16817966, 16823365, 16837624, 16827316, 16790615, 16800717, 16803306, 16809905, 16814017, 16838650, 16804433, 16786619, 16803253,
+   16835906, 16782570, 16794620, 16802608, 16820179, 16804402, 16806810, 16813565, 16812032, 16788510, 16813982, 16836730, 16819813, 16794199, 16822657, 16821041,
+   16816594, 16831552, 16818712, 16786837, 16781806, 16790837, 16837088, 16787405, 16781764, 16834799, 16786841, 16809545, 16787558, 16802943, 16807890, 16824478,
+   16837499, 16786454, 16778968, 16842508, 16837457, 16778529, 16786484, 16831999, 16822654, 16813892, 16789975, 16828938, 16795375, 16832813, 16777356, 16842466,
+   16801331, 16779126, 16830325, 16838768, 16821283, 16838817, 16815333, 16794597, 16814050, 16833524, 16799605, 16808541, 16839534, 16800334, 16829339, 16838674,
+   16815044, 16841643, 16832868, 16821244, 16777812, 16809808, 16823335, 16811013, 16781351, 16785182, 16781883, 16808191, 16834788, 16835808, 16817929, 16820599,
+   16800190, 16826431, 16815745, 16785084, 16823521, 16801320, 16815227, 16784578, 16835163, 16791544, 16829640, 16787230, 16817340, 16789116, 16815797, 16805215,
+   16808891, 16813515, 16833254, 16813385, 16841130, 16779796, 16815893, 16833241, 16811480, 16818588, 16785269, 16790359, 16796244, 16831625, 16797200, 16823552,
+   16799994, 16801784, 16791075, 16800775, 16816308, 16834646, 16800109, 16784009, 16810049, 16830120, 16808994, 16809131, 16790991, 16815098, 16827467, 16831211,
+   16836656, 16783045, 16816994, 16808277, 16799432, 16815614, 16797698, 16812804, 16798291, 16801578, 16837169, 16828389, 16797690, 16805741, 16804750, 16833419,
+   16839990, 16818925, 16811425, 16808805, 16795255, 16840603, 16797116, 16837802, 16827120, 16831221, 16780190, 16784974, 16802690, 16822114, 16782314, 16812940,
+   16811936, 16814975, 16804097, 16780343, 16842462, 16790654, 16826347, 16833377, 16801019, 16804016, 16824382, 16832035, 16834146, 16830014, 16814630, 16826839,
+   16827584, 16809224, 16794345, 16780264, 16789126, 16781642, 16809166, 16820497, 16825416, 16818396, 16820030, 16781994, 16819645, 16779081, 16828525, 16783372,
+   16842636, 16789788, 16794243, 16837515, 16838937, 16792296, 16834595, 16835156, 16782914, 16822096, 16798914, 16777488, 16839581, 16795030, 16816730, 16818730,
+   16796547, 16825046, 16824043, 16815408, 16829795, 16824890, 16817824, 16830894, 16803741, 16826105, 16777685, 16819278, 16836883, 16787169, 16836078, 16831799,
+   16807027, 16834887, 16818141, 16780387, 16817353, 16816213, 16808603, 16805288, 16822149, 16811103, 16823493, 16799203, 16828509, 16794916, 16777902, 16782206,
+   16828169, 16789210, 16835958, 16827038, 16783965, 16791274, 16799453, 16839070, 16840355, 16807224, 16827401, 16837526, 16802478, 16809473, 16836033, 16788211,
+   16792204, 16811930, 16820156, 16829254, 16783926, 16811634, 16829941, 16841866, 16834612, 16783648, 16836349, 16828849, 16831145, 16841001, 16806062, 16780583,
+   16830322, 16778163, 16810470, 16783019, 16789088, 16792615, 16813895, 16807297, 16823357, 16806998, 16808592, 16780629, 16799136, 16802494, 16777435, 16839590,
+   16826692, 16788120, 16823597, 16806287, 16791064, 16814496, 16800420, 16778551, 16813965, 16801570, 16783613, 16806573, 16832526, 16781209, 16817916, 16792465,
+   16805761, 16841102, 16787085, 16807395, 16804624, 16840251, 16809842, 16792199, 16811568, 16818509, 16841733, 16817632, 16780732, 16777629, 16805032, 16794188,
+   16789563, 16838416, 16814874, 16794383, 16824425, 16798898, 16824219, 16836303, 16788903, 16800665, 16816555, 16783069, 16835541, 16803143, 16819511, 16788544,
+   16785785, 16788575, 16826808, 16779361, 16823563, 16796290, 16833936, 16825085, 16833479, 16836796, 16815212, 16804612, 16841964, 16812736, 16789028, 16819777,
+   16801049, 16834858, 16786604, 16818546, 16827154, 16809045, 16840238, 16817925, 16819136, 16829816, 16797306, 16788811, 16834726, 16836903, 16789618, 16824134,
+   16814219, 16810937, 16777736, 16837215, 16791320, 16786579, 16810757, 16821221, 16813527, 16824557, 16832904, 16780269, 16785648, 16783978, 16799062, 16781276,
+   16795993, 16804661, 16830898, 16778778, 16800060, 16815973, 16804227, 16782557, 16838682, 16832247, 16780563, 16784151, 16835119, 16815894, 16820569, 16842732,
+   16838473, 16794703, 16809869, 16817526, 16839325, 16787235, 16794489, 16817673, 16821782, 16825217, 16818139, 16789805, 16825618, 16817769, 16806547, 16808929,
+   16800051, 16822775, 16831362, 16781401, 16782495, 16810183, 16797266, 16800964, 16782691, 16820990, 16804064, 16829200, 16816773, 16841212, 16787906, 16815483,
+   16797183, 16835089, 16787287, 16799639, 16791259, 16796754, 16840457, 16788836, 16777950, 16788114, 16827563, 16828015, 16797535, 16791477, 16778257, 16842747,
+   16826910, 16795487, 16816557, 16837761, 16789009, 16827064, 16792010, 16783554, 16790226, 16831833, 16807818, 16807331, 16784748, 16790106, 16841564, 16814582,
+   16787442, 16778575, 16789012, 16783366, 16821209, 16798369, 16836914, 16806701, 16788629, 16800623, 16831630, 16797759, 16821288, 16785031, 16784880, 16817605,
+   16841379, 16816292, 16817195, 16831777, 16788302, 16833642, 16798474, 16791906, 16806911, 16790834, 16798071, 16789868, 16808833, 16803414, 16804060, 16840692,
+   16786751, 16796032, 16789507, 16830945, 16779120, 16838004, 16824684, 16841026, 16794985, 16779592, 16832362, 16808859, 16827807, 16831161, 16829464, 16784558,
+   16793250, 16784518, 16787829, 16840494, 16830742, 16823944, 16839783, 16800865, 16818031, 16830392, 16797638, 16831870, 16792736, 16794314, 16788250, 16818506,
+   16821153, 16793869, 16809488, 16821775, 16838157, 16828605, 16842225, 16807939, 16818207, 16821238, 16807660, 16838601, 16810657, 16806256, 16795258, 16813554,
+   16786409, 16824170, 16814544, 16842596, 16808649, 16836490, 16809993, 16835887, 16807148, 16788654, 16816090, 16803827, 16796596, 16840744, 16784327, 16808860,
+   16828021, 16823313, 16806489, 16786878, 16787420, 16834428, 16814517, 16802219, 16837182, 16797561, 16820773, 16821838, 16831357, 16809225, 16794803, 16818337,
+   16818858, 16785810, 16797574, 16841065, 16785244, 16793626, 16828185, 16782241, 16839761, 16808033, 16826114, 16786686, 16783636, 16827793, 16796152, 16837683,
+   16836940, 16822464, 16794490, 16828244, 16842532, 16792136, 16838188, 16841335, 16795946, 16816290, 16781680, 16835431, 16824173, 16806425, 16829845, 16842248,
+   16842041, 16810310, 16822463, 16827078, 16840980, 16827716, 16779407, 16819463, 16780784, 16797298, 16778255, 16815371, 16829647, 16789808, 16834765, 16804775,
+   16821498, 16787177, 16811363, 16832306, 16795218, 16826643, 16804356, 16803491, 16834107, 16816218, 16782917, 16796659, 16819699, 16807412, 16782316, 16833272,
+   16796651, 16797327, 16825846, 16826056, 16784843, 16804546, 16838228, 16789332, 16823770, 16800792, 16783096, 16790497, 16811619, 16832013, 16786334, 16821724,
+   16840839, 16801844, 16823480, 16787530, 16823809, 16782573, 16807335, 16805490, 16797846, 16794334, 16779169, 16835357, 16779642, 16822526, 16834779, 16810678,
+   16816005, 16822071, 16835868, 16794029, 16831367, 16814617, 16806955, 16835420, 16787748, 16790755, 16802612, 16781182, 16805785, 16788517, 16825478, 16839350,
+   16831136, 16800217, 16825568, 16832462, 16793330, 16801960, 16786134, 16804183, 16836087, 16826080, 16837218, 16821974, 16819351, 16791184, 16831736, 16803471,
+   16800580, 16797836, 16808287, 16806536, 16829347, 16831303, 16812095, 16803373, 16822101, 16822868, 16801340, 16788770, 16777380, 16782850, 16833391, 16814948,
+   16781125, 16787679, 16787616, 16833985, 16821521, 16834190, 16824199, 16777357, 16831609, 16821182, 16824029, 16835294, 16834667, 16828152, 16834083, 16817692,
+   16833984, 16816987, 16831896, 16814331, 16831601, 16838821, 16814225, 16834514, 16836077, 16791983, 16818503, 16804216, 16777482, 16782742, 16805531, 16789003,
+   16818753, 16838303, 16826877, 16815880, 16841076, 16802918, 16801658, 16789442, 16787651, 16787646, 16799104, 16831208, 16786992, 16826871, 16793297, 16800669,
+   16787378, 16834036, 16825340, 16802879, 16800867, 16827236, 16806721, 16802778, 16792970, 16840857, 16780202, 16778036, 16811238, 16807978, 16816354, 16801015,
+   16801928, 16795372, 16829419, 16834048, 16832425, 16792621, 16828641, 16816337, 16807064, 16836088, 16832118, 16837948, 16819490, 16831386, 16801420, 16794528,
+   16806476, 16787995, 16838740, 16841396, 16811106, 16787698, 16816463, 16804488, 16797023, 16777381, 16821968, 16816259, 16834402, 16827266, 16825270, 16784328,
+   16829621, 16812528, 16790763, 16820105, 16840989, 16841016, 16817882, 16785204, 16786050, 16822959, 16801907, 16834014, 16792548, 16777416, 16804478, 16817656,
+   16803041, 16838118, 16840814, 16780297, 16795482, 16818938, 16798094, 16823647, 16833518, 16822896, 16798112, 16823720, 16831347, 16813317, 16839980, 16803764,
+   16833289, 16838971, 16830806, 16815304, 16801783, 16783510, 16800089, 16802501, 16823144, 16802831, 16806572, 16835500, 16838892, 16783604, 16797718, 16833209,
+   16840336, 16778338, 16810393, 16790550, 16778492, 16826299, 16778513, 16836425, 16821590, 16812256, 16802274, 16788855, 16812650, 16825933, 16798960, 16832525,
+   16823378, 16824419, 16807062, 16842451, 16807355, 16797459, 16803758, 16789636, 16807115, 16807680, 16820969, 16777498, 16784114, 16784693, 16827659, 16828004,
+   16792050, 16840102, 16839931, 16792706, 16814239, 16835441, 16801289, 16838035, 16838750, 16813168, 16822032, 16829120, 16817643, 16818050, 16828992, 16789689,
+   16777644, 16824067, 16790441, 16779831, 16835592, 16816540, 16781436, 16829427, 16806381, 16785288, 16838385, 16807595, 16796294, 16825897, 16832613, 16792188,
+   16839302, 16821248, 16808450, 16838874, 16836404, 16796872, 16818037, 16783022, 16822891, 16812963, 16815612, 16808221, 16831248, 16782718, 16836006, 16800243,
+   16822163, 16837862, 16787376, 16804095, 16841584, 16786248, 16789660, 16794773, 16833350, 16796453, 16837638, 16827701, 16816851, 16781563, 16828603, 16797330,
+   16813433, 16801579, 16788332, 16808114, 16824714, 16785519, 16780052, 16821387, 16838715, 16814745, 16804987, 16785944, 16790885, 16837993, 16814699, 16800314,
+   16819326, 16816985, 16840610, 16830190, 16783383, 16820727, 16779323, 16830092, 16808168, 16799926, 16804617, 16835188, 16828721, 16790863, 16813735, 16780366,
+   16805567, 16824281, 16838698, 16829207, 16813879, 16797505, 16810123, 16820974, 16790820, 16804810, 16801944, 16791464, 16830825, 16801433, 16787805, 16815787,
+   16816459, 16811188, 16806945, 16803691, 16805616, 16792865, 16833940, 16799895, 16783745, 16841277, 16787122, 16841478, 16784255, 16811404, 16807474, 16800757,
+   16791324, 16785553, 16832444, 16794402, 16795832, 16782061, 16828317, 16800539, 16784528, 16803050, 16840729, 16781568, 16779761, 16797358, 16794724, 16780840,
+   16821584, 16785669, 16779020, 16783735, 16801689, 16818125, 16806494, 16816184, 16788296, 16787944, 16838504, 16795360, 16781800, 16800338, 16828092, 16791617,
+   16813054, 16785971, 16817523, 16832715, 16817354, 16831101, 16841113, 16787059, 16830450, 16806836, 16823526, 16813294, 16804345, 16828249, 16836469, 16788624,
+   16824584, 16816822, 16803296, 16802938, 16834013, 16785963, 16800714, 16827445, 16794538, 16814761, 16831907, 16797732, 16788321, 16795115, 16780309, 16784245,
+   16793026, 16789183, 16779377, 16819761, 16811178, 16829067, 16796329, 16808827, 16836923, 16803511, 16841439, 16794328, 16778567, 16791636, 16778847, 16805219,
+   16788831, 16805473, 16822155, 16812566, 16788771, 16816971, 16792987, 16807338, 16835472, 16836950, 16833361, 16781149, 16782991, 16806940, 16831869, 16805324,
+   16800879, 16807730, 16840118, 16829323, 16811469, 16834909, 16781166, 16830846, 16813607, 16802474, 16800918, 16840364, 16794900, 16841203, 16838552, 16819166,
+   16803162, 16826716, 16793396, 16794368, 16834687, 16785791, 16781995, 16781516, 16791201, 16805588, 16840503, 16794830, 16784453, 16810774, 16826530, 16837650,
+   16789746, 16808017, 16803706, 16817213, 16830574, 16826650, 16825581, 16786578, 16827764, 16817815, 16782600, 16806283, 16829477, 16826491, 16794173, 16810190,
+   16819817, 16787583, 16781767, 16837288, 16819594, 16815983, 16818212, 16784663, 16782905, 16816508, 16819820, 16841750, 16787767, 16841577, 16830299, 16814327,
+   16792922, 16781056, 16790623, 16794920, 16777844, 16810441, 16812128, 16824165, 16784232, 16812331, 16791191, 16818507, 16826884, 16781027, 16790486, 16835957,
+   16792565, 16788794, 16817686, 16793973, 16784163, 16801078, 16823155, 16823864, 16828391, 16824321, 16814870, 16779694, 16822278, 16800630, 16814089, 16838837,
+   16782011, 16826587, 16806729, 16792563, 16793230, 16782880, 16819991, 16809411, 16826220, 16789952, 16840446, 16781895, 16820748, 16783399, 16788849, 16837712,
+   16823111, 16827857, 16781006, 16778654, 16786157, 16832575, 16832827, 16794902, 16829914, 16800799, 16799412, 16833069, 16781216, 16802871, 16786528, 16799028,
+   16811618, 16797357, 16809530, 16828396, 16807972, 16780829, 16778514, 16827690, 16805339, 16808867, 16783220, 16781135, 16832140, 16821671, 16825721, 16794124,
+   16800492, 16819629, 16788783, 16792764, 16830492, 16830746, 16815927, 16779762, 16789652, 16815544, 16786683, 16818230, 16780455, 16825050, 16828374, 16821271,
+   16778722, 16825988, 16829246, 16840189, 16841107, 16834901, 16838254, 16824835, 16815554, 16832338, 16828136, 16834951, 16808456, 16801239, 16789420, 16813569,
+   16804983, 16821485, 16824604, 16826155, 16829041, 16805708, 16817379, 16814822, 16825910, 16792824, 16790175, 16833223, 16833752, 16828611, 16839241, 16824888,
+   16808116, 16812501, 16811379, 16825865, 16788422, 16826679, 16808042, 16816480, 16832065, 16831912, 16838454, 16783149, 16792619, 16812716, 16805503, 16782739,
+   16801656, 16799602, 16820413, 16778045, 16785119, 16785052, 16798990, 16829875, 16828764, 16788174, 16794708, 16823982, 16835146, 16830313, 16783891, 16829325,
+   16807226, 16831788, 16828296, 16796856, 16804672, 16805918, 16811453, 16790968, 16834970, 16788085, 16836739, 16779064, 16785433, 16829470, 16832268, 16777657,
+   16783461, 16829106, 16788182, 16816704, 16815957, 16829781, 16781284, 16832313, 16792856, 16790130, 16809710, 16788792, 16789931, 16783785, 16833493, 16804834,
+   16841799, 16830169, 16798541, 16792509, 16823238, 16781847, 16828203, 16831223, 16828705, 16835111, 16831558, 16804400, 16805853, 16840074, 16805387, 16833982,
+   16837880, 16797736, 16807397, 16817082, 16785143, 16789208, 16787758, 16809207, 16790546, 16782919, 16836759, 16815412, 16790591, 16835028, 16807528, 16806201,
+   16801350, 16841693, 16842416, 16780054, 16836577, 16811612, 16841196, 16827796, 16788298, 16801007, 16821257, 16809020, 16802965, 16779548, 16838141, 16802416,
+   16838255, 16793394, 16803023, 16802423, 16814170, 16831565, 16796785, 16829600, 16814612, 16778677, 16802934, 16827766, 16806584, 16815112, 16809929, 16831905,
+   16837616, 16836132, 16822633, 16832422, 16837989, 16800276, 16838174, 16808834, 16818321, 16799305, 16799705, 16833340, 16809709, 16829850, 16820981, 16814090,
+   16801734, 16785328, 16813468, 16831714, 16795414, 16788471, 16841839, 16816451, 16810530, 16795434, 16801126, 16830256, 16831885, 16834280, 16793473, 16819907,
+   16822002, 16810029, 16821507, 16802914, 16815511, 16810115, 16798110, 16795467, 16782252, 16823191, 16793104, 16799356, 16784927, 16798168, 16820177, 16809151,
+   16835742, 16805047, 16821992, 16809346, 16782811, 16813926, 16811142, 16793958, 16835277, 16807744, 16777350, 16813292, 16819838, 16835813, 16837454, 16840401,
+   16817997, 16834715, 16830884, 16813420, 16835934, 16829352, 16808381, 16801702, 16817903, 16833860, 16828664, 16812076, 16780644, 16831827, 16818765, 16807734,
+   16805480, 16783552, 16798312, 16798270, 16826995, 16826156, 16783012, 16813325, 16837691, 16789691, 16788033, 16814787, 16777297, 16791966, 16788301, 16785430,
+   16786566, 16834624, 16780016, 16794385, 16835193, 16777302, 16794729, 16806137, 16778262, 16813277, 16778800, 16779579, 16840902, 16804343, 16780312, 16802351,
+   16841401, 16821279, 16777590, 16827157, 16832654, 16815578, 16782460, 16841567, 16814404, 16827820, 16780690, 16816320, 16777431, 16831781, 16777443, 16794015},
+  {16831176, 16818417, 16793595, 16841891, 16824249, 16835051, 16829250, 16807710, 16819972, 16810927, 16798188, 16831008, 16780647, 16814325, 16784538, 16818210,
+   16824093, 16799286, 16789677, 16790721, 16794631, 16813987, 16782745, 16830445, 16814152, 16818968, 16816082, 16799669, 16784777, 16819980, 16803026, 16787913,
+   16818400, 16778580, 16819047, 16807020, 16814667, 16809189, 16826087, 16831141, 16822181, 16837510, 16782440, 16809503, 16788297, 16806622, 16809139, 16811714,
+   16787746, 16779165, 16788922, 16793807, 16812917, 16794039, 16819751, 16815927, 16781495, 16807845, 16827868, 16841441, 16821545, 16792448, 16786805, 16813499,
+   16821632, 16777543, 16819295, 16809231, 16817314, 16781992, 16822769, 16783998, 16826332, 16794606, 16814878, 16812964, 16836096, 16817517, 16796890, 16799136,
+   16829683, 16789236, 16802851, 16813302, 16841316, 16793765, 16784654, 16798866, 16827623, 16791812, 16840810, 16809972, 16835957, 16788726, 16780307, 16781946,
+   16826267, 16800375, 16788560, 16786635, 16835017, 16819079, 16830679, 16816391, 16795233, 16781137, 16818574, 16792953, 16809315, 16801358, 16795456, 16832461,
+   16826556, 16826012, 16808557, 16824232, 16827909, 16816185, 16791016, 16790208, 16778796, 16813308, 16817285, 16800975, 16795538, 16814983, 16840393, 16818638,
+   16792339, 16822795, 16812694, 16777216, 16814873, 16786036, 16817149, 16842027, 16815228, 16796020, 16780005, 16807687, 16801371, 16784721, 16839249, 16794904,
+   16839969, 16784545, 16829021, 16810981, 16838629, 16779448, 16805820, 16791190, 16825854, 16840417, 16830340, 16828104, 16806188, 16826387, 16796906, 16816719,
+   16805665, 16778980, 16817047, 16805473, 16798648, 16822215, 16829974, 16838152, 16779841, 16779232, 16795472, 16834530, 16812274, 16817846, 16807197, 16788813,
+   16834289, 16787615, 16802981, 16818673, 16828920, 16841192, 16832590, 16830536, 16829128, 16819602, 16801428, 16813172, 16799430, 16786554, 16805461, 16839443,
+   16824270, 16803329, 16839976, 16798708, 16821842, 16782490, 16814293, 16796039, 16800564, 16780393, 16828585, 16826952, 16813761, 16778220, 16804953, 16802685,
+   16792802, 16807629, 16813154, 16815276, 16799707, 16840508, 16816028, 16788170, 16805132, 16806415, 16783829, 16805525, 16821208, 16786826, 16834360, 16794776,
+   16810859, 16821354, 16802974, 16777655, 16817330, 16834011, 16825646, 16831081, 16807560, 16829367, 16805503, 16784576, 16801863, 16827841, 16819126, 16824755,
+   16815114, 16787667, 16829093, 16801151, 16782980, 16798917, 16808995, 16804242, 16780129, 16820439, 16781439, 16815045, 16786844, 16839445, 16812201, 16833137,
+   16825105, 16828271, 16832206, 16803408, 16779003, 16837809, 16830090, 16827133, 16820253, 16822727, 16828730, 16825440, 16809544, 16841877, 16808436, 16807239,
+   16795710, 16828518, 16806414, 16785941, 16784147, 16831002, 16824167, 16807981, 16792035, 16777788, 16804409, 16784071, 16830956, 16838485, 16808404, 16801061,
+   16825938, 16840137, 16818302, 16821395, 16803334, 16833129, 16840591, 16812428, 16820303, 16782157, 16790969, 16817075, 16811393, 16819036, 16837756, 16801962,
+   16796075, 16786873, 16837850, 16809785, 16806430, 16818229, 16781704, 16805020, 16808276, 16831455, 16808588, 16826072, 16833151, 16806101, 16799312, 16826237,
+   16830678, 16842297, 16812700, 16781069, 16842548, 16840522, 16801617, 16815899, 16823023, 16800091, 16834068, 16793408, 16804625, 16803316, 16788913, 16803517,
+   16807056, 16814173, 16825548, 16803953, 16816452, 16822959, 16800334, 16809847, 16778597, 16819971, 16789500, 16832894, 16794711, 16790615, 16831267, 16794282,
+   16785088, 16812718, 16824461, 16780886, 16811120, 16828165, 16820817, 16799071, 16821894, 16839322, 16799636, 16802959, 16784030, 16800308, 16818203, 16822693,
+   16826327, 16804608, 16840593, 16833167, 16824748, 16842449, 16820982, 16807331, 16834643, 16818736, 16780214, 16793501, 16816996, 16811567, 16783164, 16817259,
+   16827645, 16831605, 16831084, 16806639, 16781518, 16814283, 16781749, 16787703, 16794743, 16802250, 16808367, 16829009, 16815021, 16778806, 16837609, 16824615,
+   16838144, 16824426, 16780045, 16807156, 16798824, 16839256, 16818264, 16815244, 16789771, 16819008, 16789051, 16835345, 16804613, 16779734, 16802421, 16831643,
+   16791407, 16778944, 16783933, 16839466, 16816375, 16817423, 16835171, 16837746, 16832040, 16832295, 16777907, 16803861, 16778111, 16795361, 16810320, 16798770,
+   16815894, 16832625, 16789760, 16806109, 16794759, 16796993, 16793938, 16785699, 16832755, 16787565, 16799099, 16795386, 16804211, 16835482, 16832501, 16808348,
+   16823067, 16819715, 16831678, 16823007, 16841100, 16802403, 16820095, 16831100, 16819666, 16780395, 16827548, 16821950, 16807914, 16800242, 16825472, 16827688,
+   16837667, 16822515, 16821641, 16787038, 16800282, 16841034, 16831064, 16837328, 16787243, 16815394, 16806252, 16801000, 16832200, 16794370, 16802554, 16835298,
+   16785287, 16793875, 16825906, 16786829, 16810673, 16780545, 16790347, 16813842, 16800293, 16830192, 16807918, 16814602, 16810822, 16792821, 16805670, 16832371,
+   16831504, 16817440, 16802108, 16808045, 16803512, 16791360, 16826649, 16818512, 16837333, 16798361, 16835163, 16839565, 16789226, 16804039, 16779562, 16829862,
+   16777604, 16813527, 16806225, 16791036, 16841547, 16805895, 16791077, 16779024, 16837073, 16837628, 16781781, 16842616, 16814046, 16838398, 16825200, 16809175,
+   16792391, 16814112, 16831543, 16805259, 16801198, 16792512, 16810778, 16793547, 16813735, 16795824, 16840656, 16827595, 16784897, 16825833, 16805275, 16810190,
+   16796004, 16815520, 16785363, 16830487, 16782567, 16803660, 16806832, 16786413, 16833836, 16841120, 16800266, 16796412, 16794255, 16805017, 16786323, 16825382,
+   16801015, 16800398, 16827320, 16817581, 16828185, 16821153, 16825154, 16823784, 16809715, 16791432, 16801632, 16807292, 16838421, 16799189, 16821155, 16825491,
+   16809133, 16786915, 16825633, 16782177, 16780457, 16821334, 16799914, 16819674, 16821250, 16817563, 16789028, 16833062, 16822694, 16820204, 16812988, 16804084,
+   16801272, 16811038, 16789505, 16791863, 16820185, 16832379, 16810884, 16809494, 16816601, 16801449, 16824306, 16819018, 16793530, 16799471, 16785627, 16812302,
+   16837869, 16788977, 16807438, 16803485, 16806003, 16830785, 16786966, 16796809, 16820293, 16821638, 16787726, 16796515, 16817640, 16785411, 16832665, 16838001,
+   16827794, 16837238, 16816100, 16786351, 16833814, 16811034, 16824976, 16833401, 16827912, 16786106, 16823869, 16798898, 16822939, 16807325, 16798681, 16788384,
+   16804767, 16788305, 16818563, 16802797, 16824189, 16812334, 16795787, 16799078, 16815003, 16827826, 16818791, 16799204, 16795111, 16813550, 16778971, 16807254,
+   16812783, 16809788, 16792849, 16817707, 16809545, 16808282, 16813103, 16799115, 16822953, 16838964, 16830282, 16826479, 16841957, 16789114, 16781891, 16798881,
+   16826853, 16835777, 16786667, 16799927, 16805041, 16842163, 16804027, 16778752, 16837249, 16811377, 16837595, 16799827, 16823894, 16813888, 16831004, 16831366,
+   16788158, 16791315, 16800935, 16807404, 16817898, 16798631, 16790636, 16782046, 16797488, 16777400, 16832578, 16821853, 16809279, 16830448, 16777893, 16826214,
+   16803555, 16828668, 16830473, 16830620, 16836887, 16795497, 16820497, 16806029, 16820085, 16797179, 16782031, 16812011, 16780649, 16795876, 16796831, 16824747,
+   16809369, 16809427, 16801656, 16820814, 16783773, 16822211, 16828927, 16808514, 16828842, 16836356, 16826834, 16780298, 16832060, 16820341, 16830599, 16788283,
+   16841831, 16818676, 16795813, 16819884, 16816952, 16814442, 16817576, 16839590, 16778803, 16825777, 16787451, 16784018, 16827452, 16777806, 16816513, 16825652,
+   16803893, 16825575, 16778708, 16785550, 16780510, 16799247, 16793572, 16801136, 16782630, 16812368, 16795940, 16790688, 16797611, 16787294, 16792025, 16838389,
+   16842443, 16828855, 16817222, 16792557, 16841508, 16785844, 16805625, 16777853, 16783237, 16831907, 16828679, 16805366, 16780719, 16808684, 16820778, 16786971,
+   16827068, 16813279, 16785681, 16788163, 16841169, 16817419, 16829406, 16828699, 16785433, 16782199, 16825423, 16822225, 16798434, 16812875, 16804171, 16826272,
+   16781532, 16809248, 16823542, 16783111, 16821736, 16806093, 16818378, 16841371, 16804825, 16838537, 16794934, 16826436, 16825314, 16815597, 16823713, 16782206,
+   16783053, 16830425, 16809955, 16809916, 16809908, 16818428, 16789749, 16793536, 16786946, 16829610, 16803413, 16807817, 16801130, 16837878, 16805954, 16791200,
+   16815782, 16784870, 16809461, 16796770, 16791251, 16805813, 16814388, 16839203, 16824198, 16829941, 16782601, 16831045, 16793025, 16779201, 16806851, 16833990,
+   16830854, 16793734, 16787469, 16793568, 16819510, 16801490, 16797397, 16842359, 16784239, 16778503, 16785512, 16783462, 16795389, 16803604, 16813896, 16809181,
+   16789787, 16826359, 16833607, 16777818, 16810079, 16818483, 16787679, 16833090, 16820724, 16813052, 16842439, 16822255, 16783897, 16830084, 16788264, 16831736,
+   16825269, 16838099, 16826551, 16837197, 16830548, 16795911, 16801485, 16801892, 16790687, 16778444, 16842209, 16802915, 16820291, 16835458, 16824935, 16825196,
+   16787053, 16833222, 16823675, 16817890, 16798524, 16798020, 16832055, 16827680, 16820115, 16779364, 16831219, 16781995, 16831910, 16815930, 16836754, 16798540,
+   16794955, 16837718, 16797812, 16833544, 16836283, 16828650, 16777768, 16833604, 16824383, 16838649, 16833064, 16823113, 16817835, 16812523, 16803847, 16794336,
+   16822765, 16815407, 16814885, 16782189, 16800235, 16778258, 16818078, 16808910, 16805332, 16786665, 16802643, 16800101, 16834298, 16836797, 16835824, 16783104,
+   16796568, 16780569, 16808629, 16802127, 16801670, 16837472, 16805957, 16820525, 16830720, 16815325, 16807121, 16820518, 16840326, 16816940, 16836872, 16830613,
+   16815648, 16779687, 16821206, 16806207, 16778012, 16779987, 16803036, 16830005, 16800808, 16803900, 16802614, 16814143, 16800331, 16835248, 16814516, 16793896,
+   16829454, 16828231, 16820091, 16835473, 16838870, 16790379, 16810790, 16799176, 16796068, 16783916, 16805828, 16816985, 16793748, 16784987, 16826491, 16806620,
+   16786789, 16803099, 16798580, 16812916, 16781479, 16805698, 16777313, 16825754, 16826108, 16791625, 16788953, 16826939, 16780043, 16817873, 16801074, 16828686,
+   16821999, 16799088, 16800786, 16780790, 16807157, 16814867, 16831606, 16816153, 16817805, 16787782, 16833326, 16804203, 16822132, 16794852, 16788847, 16836217,
+   16790225, 16841024, 16819518, 16781255, 16790213, 16796969, 16841184, 16824894, 16801710, 16827726, 16805562, 16823936, 16839500, 16798675, 16834114, 16786699,
+   16823241, 16785539, 16830939, 16826058, 16822843, 16792199, 16801675, 16784345, 16813925, 16838703, 16816304, 16821239, 16836425, 16792288, 16799435, 16790129,
+   16828913, 16798157, 16781446, 16819868, 16830848, 16782203, 16806799, 16822928, 16810124, 16820142, 16832757, 16842520, 16785469, 16802515, 16804248, 16788511,
+   16790631, 16795562, 16801561, 16783736, 16827285, 16791119, 16820120, 16809965, 16794484, 16796198, 16806672, 16821088, 16794466, 16803663, 16779424, 16801236,
+   16806999, 16818431, 16814445, 16816289, 16826121, 16790664, 16821336, 16806981, 16839640, 16795082, 16792666, 16838345, 16836684, 16794437, 16815518, 16832725,
+   16789867, 16777428, 16838850, 16825566, 16812022, 16826808, 16816660, 16834371, 16778675, 16788513, 16805010, 16792098, 16834700, 16781834, 16790353, 16810337,
+   16840287, 16801523, 16788925, 16810348, 16781986, 16817273, 16838755, 16809366, 16794664, 16822200, 16800520, 16790952, 16809877, 16826618, 16840579, 16825999,
+   16820729, 16817016, 16793643, 16829748, 16834549, 16829657, 16823678, 16796357, 16778325, 16830454, 16803650, 16814995, 16827955, 16831528, 16838505, 16812359,
+   16815023, 16802450, 16825307, 16829568, 16804453, 16835676, 16835071, 16823051, 16801414, 16806291, 16813916, 16784537, 16796296, 16819566, 16822785, 16809232,
+   16805598, 16794881, 16826228, 16813196, 16824829, 16802353, 16838736, 16812614, 16795515, 16810683, 16786723, 16825497, 16831569, 16833204, 16830866, 16792752,
+   16808798, 16823075, 16828517, 16793491, 16838820, 16792296, 16838897, 16834661, 16811667, 16790513, 16794707, 16798311, 16820697, 16800320, 16821067, 16800620,
+   16782685, 16838685, 16833317, 16806031, 16836457, 16784780, 16804401, 16834443, 16800132, 16820130, 16782740, 16818406, 16828513, 16780651, 16826043, 16800920,
+   16807009, 16798914, 16791334, 16818642, 16822494, 16777516, 16798159, 16779128, 16827926, 16786159, 16807637, 16798220, 16791448, 16811906, 16811987, 16805932,
+   16785208, 16825640, 16814769, 16778641, 16818352, 16779964, 16836688, 16783936, 16805108, 16833587, 16793435, 16829601, 16794167, 16836451, 16787638, 16802687,
+   16830985, 16822968, 16807542, 16801625, 16834426, 16832680, 16784784, 16799629, 16781346, 16831160, 16807799, 16825734, 16825160, 16809900, 16787545, 16819610,
+   16788298, 16785086, 16822686, 16807526, 16795577, 16832992, 16800112, 16830996, 16798462, 16837586, 16786843, 16841012, 16792928, 16802396, 16792380, 16824956,
+   16779846, 16790427, 16809668, 16800775, 16831772, 16826095, 16792497, 16814765, 16790040, 16829565, 16790033, 16822165, 16835087, 16831977, 16834833, 16787094,
+   16805496, 16812914, 16820614, 16840758, 16802216, 16817065, 16777760, 16786492, 16838925, 16823712, 16798715, 16797764, 16780548, 16782678, 16783185, 16826388,
+   16802878, 16820459, 16829456, 16813443, 16839548, 16812804, 16831912, 16822099, 16842219, 16803944, 16814618, 16825474, 16831953, 16817082, 16840339, 16813968,
+   16820232, 16803797, 16787835, 16837852, 16795924, 16828148, 16798171, 16794030, 16793994, 16825669, 16826385, 16823253, 16797669, 16802635, 16786783, 16817779,
+   16828114, 16827800, 16838797, 16841266, 16837097, 16829309, 16841009, 16794726, 16834889, 16802887, 16802820, 16783255, 16829930, 16836258, 16791499, 16826993,
+   16828828, 16826958, 16826543, 16828578, 16827996, 16810540, 16790752, 16810424, 16811690, 16791708, 16794435, 16777567, 16807024, 16785004, 16803024, 16833706,
+   16816893, 16806105, 16826745, 16829147, 16792514, 16799414, 16796389, 16791012, 16784087, 16824130, 16825009, 16821724, 16796964, 16836617, 16810952, 16802678,
+   16825265, 16811476, 16807837, 16803242, 16797408, 16785235, 16824430, 16802593, 16838961, 16823057, 16831724, 16782039, 16826041, 16831447, 16835688, 16791409,
+   16794789, 16838419, 16815842, 16801207, 16794499, 16825787, 16833598, 16818578, 16777335, 16838655, 16801848, 16841041, 16810369, 16816634, 16782505, 16831235,
+   16779223, 16838578, 16795514, 16814889, 16785019, 16808250, 16796986, 16784156, 16839086, 16823169, 16811970, 16784781, 16812844, 16828985, 16802118, 16795235,
+   16780782, 16822788, 16822571, 16781470, 16794258, 16795784, 16809303, 16793614, 16806542, 16779110, 16802896, 16812285, 16842061, 16834578, 16821650, 16795188,
+   16777607, 16833854, 16815878, 16792424, 16841417, 16821919, 16801117, 16821654, 16821546, 16839326, 16802146, 16834415, 16792487, 16790422, 16831675, 16834149,
+   16793122, 16838976, 16816483, 16781072, 16777931, 16785298, 16836893, 16791265, 16813942, 16777544, 16818167, 16792488, 16840108, 16816937, 16822398, 16794567,
+   16823374, 16799721, 16795310, 16777406, 16840126, 16806985, 16830952, 16784989, 16814423, 16838726, 16820455, 16815808, 16813873, 16834500, 16820727, 16840365,
+   16830075, 16828060, 16798849, 16834136, 16808265, 16809809, 16784743, 16822512, 16794754, 16799944, 16826374, 16807487, 16815964, 16812474, 16795542, 16810492,
+   16797599, 16807473, 16778730, 16824296, 16839963, 16786508, 16832255, 16813664, 16817521, 16817251, 16796765, 16812480, 16805518, 16800302, 16810070, 16808518,
+   16821737, 16803018, 16828535, 16792181, 16814662, 16799173, 16836819, 16780872, 16786145, 16808074, 16806459, 16823056, 16836869, 16783661, 16807184, 16824178,
+   16838845, 16785526, 16808155, 16778818, 16805683, 16796186, 16820794, 16818824, 16796963, 16810331, 16804672, 16781675, 16836032, 16805405, 16779576, 16800757,
+   16803912, 16813662, 16803246, 16841301, 16813216, 16799842, 16794212, 16793218, 16784980, 16822258, 16832075, 16822045, 16804603, 16817692, 16829161, 16782194,
+   16835680, 16822510, 16794673, 16827314, 16817975, 16821211, 16816458, 16824063, 16799298, 16835286, 16838669, 16828409, 16823085, 16780575, 16800251, 16788668,
+   16812514, 16820773, 16782191, 16784934, 16842736, 16783170, 16791988, 16822632, 16808756, 16797345, 16797321, 16811603, 16836281, 16841099, 16808977, 16811353,
+   16821496, 16796999, 16804068, 16806131, 16790461, 16791076, 16842372, 16790214, 16814605, 16783932, 16824548, 16831814, 16806260, 16795855, 16801293, 16826611,
+   16841138, 16836991, 16795556, 16818945, 16839157, 16828143, 16797489, 16789429, 16779217, 16799844, 16791469, 16813323, 16779675, 16795550, 16798182, 16777491,
+   16801946, 16828132, 16796594, 16804681, 16828435, 16822071, 16816603, 16796599, 16785475, 16779903, 16830520, 16784529, 16778205, 16803325, 16804127, 16793608,
+   16796356, 16780714, 16793267, 16835042, 16794693, 16835595, 16799537, 16822797, 16796846, 16814645, 16794868, 16817559, 16792403, 16819247, 16819565, 16817231,
+   16793179, 16777518, 16835037, 16823930, 16815285, 16795062, 16794165, 16790538, 16787000, 16820571, 16789919, 16828509, 16791439, 16805327, 16783624, 16780117,
+   16792278, 16826478, 16786683, 16818373, 16804394, 16810684, 16781665, 16813813, 16781102, 16792675, 16800937, 16790542, 16833812, 16812049, 16830513, 16814488,
+   16827940, 16825153, 16817941, 16793477, 16780820, 16842467, 16805470, 16808233, 16841076, 16825148, 16832146, 16789217, 16787959, 16791389, 16834467, 16828421,
+   16801065, 16837166, 16831469, 16827888, 16780269, 16802903, 16785969, 16788764, 16777837, 16792397, 16789103, 16788504, 16780845, 16779696, 16837167, 16812319,
+   16830949, 16813073, 16806841, 16805512, 16828714, 16797464, 16783082, 16808075, 16817306, 16835609, 16835930, 16780764, 16815686, 16802668, 16788566, 16818228,
+   16831515, 16833450, 16835951, 16793402, 16780517, 16787161, 16830743, 16794236, 16816262, 16803293, 16831706, 16826635, 16782258, 16798901, 16787591, 16789501,
+   16816025, 16837289, 16793113, 16818812, 16818505, 16825550, 16804525, 16839053, 16785499, 16837971, 16818937, 16802167, 16840199, 16804590, 16823117, 16787074,
+   16799248, 16797405, 16812306, 16807746, 16785020, 16808680, 16840829, 16807798, 16820465, 16832515, 16838079, 16810303, 16804817, 16833766, 16832465, 16818623,
+   16829203, 16792942, 16833725, 16790364, 16812683, 16831301, 16792218, 16825286, 16841709, 16829992, 16797417, 16823663, 16824233, 16803822, 16804629, 16797767,
+   16787458, 16821180, 16788134, 16820435, 16840380, 16802847, 16796284, 16781903, 16812363, 16814518, 16822895, 16817195, 16830748, 16812326, 16805925, 16822954,
+   16781551, 16789437, 16826249, 16780974, 16828127, 16818068, 16827798, 16829071, 16779028, 16816564, 16841963, 16833982, 16820481, 16837854, 16816128, 16815936,
+   16813111, 16801875, 16797583, 16782253, 16789462, 16801765, 16836345, 16814925, 16829362, 16780971, 16817351, 16803439, 16812723, 16841940, 16779621, 16787773,
+   16840204, 16792552, 16818969, 16809342, 16778794, 16841738, 16824710, 16825844, 16837270, 16803849, 16785209, 16827872, 16796676, 16834303, 16791808, 16789377,
+   16791666, 16815378, 16835935, 16788860, 16787751, 16800608, 16831276, 16829524, 16777921, 16780984, 16805314, 16826648, 16831083, 16788217, 16830029, 16804920,
+   16827300, 16822395, 16791276, 16830540, 16796181, 16823401, 16830437, 16783570, 16797586, 16842100, 16797866, 16787233, 16821676, 16793175, 16833239, 16779117,
+   16797018, 16821715, 16813015, 16838908, 16841052, 16808384, 16838193, 16778789, 16816341, 16810396, 16807661, 16836517, 16813627, 16804106, 16821101, 16830156,
+   16817932, 16805083, 16820019, 16799758, 16811901, 16819057, 16798984, 16777915, 16806725, 16795675, 16795172, 16797450, 16787778, 16809630, 16832653, 16803902,
+   16838359, 16793965, 16839966, 16794154, 16784122, 16803685, 16806772, 16802187, 16836999, 16834391, 16830916, 16813967, 16807401, 16784500, 16822235, 16782073,
+   16825227, 16828995, 16836802, 16820431, 16777800, 16794543, 16777267, 16784140, 16818562, 16793158, 16815493, 16813868, 16817158, 16799853, 16814117, 16780201,
+   16836228, 16819685, 16809370, 16781145, 16782541, 16835986, 16825360, 16798538, 16820658, 16827907, 16822287, 16827803, 16784749, 16826481, 16824058, 16813376,
+   16800453, 16785095, 16782147, 16830256, 16789486, 16787646, 16798634, 16832343, 16805990, 16837776, 16788361, 16802160, 16830706, 16783244, 16782916, 16835836,
+   16816268, 16778554, 16836304, 16837457, 16832559, 16790883, 16825063, 16836708, 16827580, 16826950, 16801072, 16799896, 16799888, 16804413, 16810573, 16823370,
+   16841745, 16823582, 16832660, 16835733, 16811011, 16788451, 16777381, 16783827, 16798222, 16791294, 16786153, 16801148, 16822000, 16835485, 16824974, 16810992,
+   16822604, 16787961, 16803744, 16825284, 16813936, 16822817, 16802241, 16783155, 16830819, 16836607, 16842572, 16799279, 16778862, 16806749, 16835959, 16813790,
+   16778109, 16785142, 16814302, 16834942, 16818790, 16825954, 16842729, 16807305, 16786691, 16806757, 16802918, 16806045, 16807572, 16796523, 16824507, 16783246,
+   16838795, 16804396, 16798350, 16778059, 16827643, 16813285, 16828327, 16829283, 16818643, 16810455, 16794788, 16788168, 16778064, 16792943, 16792402, 16826523,
+   16782585, 16787264, 16821701, 16830374, 16831705, 16831271, 16821634, 16810923, 16787731, 16833027, 16815692, 16815600, 16805663, 16822282, 16806405, 16804933,
+   16784673, 16821210, 16786800, 16806116, 16813141, 16829799, 16827364, 16781301, 16802601, 16797702, 16810560, 16823865, 16798173, 16812481, 16788208, 16814724,
+   16808459, 16790480, 16783809, 16816131, 16820145, 16827937, 16797035, 16797623, 16832264, 16808012, 16792970, 16788598, 16814214, 16800690, 16818501, 16795788,
+   16787277, 16785425, 16818392, 16838902, 16816127, 16823069, 16837276, 16830041, 16780347, 16793392, 16791481, 16812507, 16839682, 16831424, 16785888, 16793210,
+   16837710, 16814409, 16821916, 16808210, 16806089, 16842198, 16836107, 16826082, 16824969, 16816207, 16794280, 16783284, 16828805, 16815596, 16777393, 16782134,
+   16813616, 16824849, 16832136, 16830197, 16830040, 16842124, 16828612, 16789948, 16800428, 16779608, 16823376, 16799466, 16787443, 16842368, 16784686, 16801951,
+   16798535, 16808896, 16791530, 16829442, 16829923, 16829842, 16778678, 16818168, 16814040, 16810467, 16805891, 16832492, 16823684, 16808228, 16805798, 16839201,
+   16805240, 16810816, 16781857, 16834457, 16795668, 16814876, 16824008, 16822213, 16818771, 16837486, 16805699, 16792506, 16812623, 16807008, 16831641, 16837044,
+   16808449, 16791312, 16805220, 16806133, 16777898, 16842283, 16829450, 16781364, 16789167, 16838182, 16815058, 16842588, 16836017, 16800301, 16810987, 16810247,
+   16791028, 16833145, 16792152, 16782211, 16787840, 16812186, 16792767, 16829466, 16789019, 16785379, 16823145, 16821344, 16823287, 16787428, 16789988, 16800853,
+   16791629, 16816214, 16785540, 16823335, 16785800, 16836834, 16797944, 16821157, 16830966, 16806251, 16798245, 16824356, 16797086, 16840297, 16818697, 16820529,
+   16784359, 16825443, 16816183, 16838355, 16783565, 16787274, 16820598, 16784463, 16797981, 16820860, 16809591, 16828211, 16799621, 16817391, 16834370, 16792073,
+   16832543, 16840875, 16823763, 16822627, 16786970, 16827819, 16829622, 16786544, 16840727, 16820900, 16813475, 16819303, 16778334, 16812947, 16782668, 16791342,
+   16803505, 16781938, 16837439, 16782370, 16835028, 16833839, 16796245, 16841694, 16790132, 16814243, 16814298, 16789404, 16792018, 16807170, 16839414, 16798943,
+   16811578, 16831292, 16806758, 16803892, 16785963, 16781500, 16811354, 16815574, 16841172, 16794740, 16796398, 16832719, 16810410, 16804365, 16831938, 16828816,
+   16836762, 16833289, 16811535, 16800593, 16786475, 16810002, 16797063, 16801229, 16799803, 16783394, 16806347, 16838318, 16781613, 16807537, 16783874, 16839317,
+   16812573, 16785763, 16842212, 16778540, 16824990, 16795826, 16805170, 16825030, 16824625, 16784486, 16791528, 16804061, 16823310, 16807905, 16810697, 16837368,
+   16832078, 16802902, 16798128, 16777809, 16795659, 16817935, 16821721, 16778423, 16838635, 16789734, 16824822, 16833111, 16802445, 16831068, 16813204, 16790101,
+   16811492, 16811057, 16788497, 16788612, 16804815, 16829572, 16829195, 16790017, 16825799, 16784109, 16811376, 16795025, 16824907, 16835922, 16787983, 16839421,
+   16811460, 16790269, 16791569, 16797795, 16820417, 16812149, 16799042, 16812490, 16837678, 16778684, 16817998, 16793326, 16819964, 16818491, 16809007, 16806686,
+   16819054, 16808782, 16796220, 16818782, 16820622, 16827550, 16786199, 16831930, 16787817, 16806682, 16801045, 16798039, 16838426, 16810341, 16818974, 16789143,
+   16777855, 16779714, 16805673, 16835212, 16777344, 16805742, 16840394, 16800951, 16799981, 16835200, 16798320, 16836790, 16821967, 16817738, 16797927, 16838218,
+   16823731, 16828562, 16833201, 16817443, 16785973, 16809707, 16822249, 16816911, 16803616, 16822545, 16780815, 16822603, 16781014, 16810856, 16837348, 16834217,
+   16812020, 16796896, 16784210, 16813623, 16833810, 16839777, 16829485, 16840707, 16840428, 16826168, 16820151, 16792351, 16841174, 16817712, 16804759, 16809053,
+   16824557, 16790018, 16796071, 16795265, 16799048, 16820269, 16810829, 16836009, 16831799, 16804934, 16815264, 16821837, 16795331, 16788607, 16837810, 16800981,
+   16790492, 16800254, 16803725, 16822850, 16828180, 16832971, 16793266, 16839761, 16797046, 16803931, 16830281, 16842276, 16787982, 16779484, 16840538, 16796116,
+   16835451, 16817529, 16831704, 16800958, 16788816, 16794243, 16811981, 16836173, 16817605, 16819581, 16798624, 16795863, 16833414, 16799777, 16822640, 16833838,
+   16839100, 16789720, 16792912, 16809141, 16790567, 16811072, 16814483, 16811883, 16811176, 16821618, 16795249, 16832615, 16838924, 16825177, 16822544, 16841811,
+   16794339, 16786375, 16809333, 16789641, 16806442, 16842021, 16794305, 16797147, 16794263, 16815985, 16803273, 16778817, 16815685, 16779976, 16787838, 16791329,
+   16839824, 16786125, 16777550, 16816862, 16796309, 16812747, 16828981, 16835849, 16797800, 16829075, 16806094, 16782720, 16830549, 16830427, 16827372, 16802987,
+   16799278, 16788329, 16789728, 16806118, 16827715, 16809954, 16801482, 16838427, 16811306, 16839726, 16781186, 16815946, 16793619, 16801450, 16795224, 16820853,
+   16826253, 16796037, 16824756, 16799411, 16807703, 16801468, 16818433, 16837414, 16797494, 16785163, 16806843, 16792646, 16784978, 16803789, 16830359, 16813892,
+   16783611, 16839140, 16833761, 16806099, 16806023, 16821563, 16826140, 16802041, 16816883, 16817239, 16797617, 16840613, 16785852, 16781684, 16807342, 16823246,
+   16806618, 16826796, 16802274, 16786366, 16816899, 16784011, 16811436, 16835745, 16798530, 16839444, 16815202, 16810216, 16839351, 16810949, 16780112, 16780128,
+   16795756, 16782510, 16806435, 16777390, 16782968, 16809952, 16816497, 16777319, 16831403, 16838645, 16790217, 16800601, 16778877, 16827619, 16825931, 16778984,
+   16816254, 16784815, 16799513, 16788205, 16817689, 16838147, 16778881, 16777437, 16812959, 16789409, 16778576, 16788149, 16777953, 16832853, 16832099, 16806036,
+   16786992, 16778174, 16782766, 16784697, 16782512, 16842338, 16786784, 16813931, 16811834, 16778398, 16827526, 16791155, 16817088, 16820169, 16816942, 16826468,
+   16819429, 16805168, 16827966, 16811287, 16810612, 16834777, 16782559, 16822838, 16836675, 16805658, 16809980, 16831519, 16800456, 16809937, 16795385, 16835219,
+   16829943, 16811688, 16801359, 16814924, 16823665, 16788923, 16778896, 16779025, 16788406, 16813244, 16796517, 16836316, 16799363, 16812243, 16828833, 16818026,
+   16783114, 16800170, 16778790, 16783503, 16795528, 16781297, 16841742, 16795881, 16801890, 16790668, 16788140, 16784470, 16788311, 16837573, 16819612, 16781322,
+   16793182, 16790991, 16777507, 16795588, 16781798, 16796129, 16838076, 16779997, 16783129, 16824485, 16789117, 16786280, 16836025, 16779808, 16806651, 16815313,
+   16839280, 16813614, 16828975, 16828733, 16822747, 16781833, 16814338, 16788538, 16813998, 16837003, 16830781, 16797442, 16835997, 16798855, 16842236, 16796854,
+   16819882, 16828676, 16838382, 16834085, 16837991, 16840984, 16784422, 16808965, 16815131, 16790501, 16833981, 16803693, 16793271, 16790166, 16781231, 16821585,
+   16818186, 16797354, 16798424, 16803440, 16817838, 16804493, 16794589, 16808829, 16796700, 16835061, 16818869, 16786367, 16817906, 16784943, 16808260, 16805505,
+   16800813, 16783775, 16839481, 16778424, 16797602, 16810694, 16837239, 16830248, 16783701, 16781021, 16804662, 16778879, 16802570, 16837086, 16800943, 16824800,
+   16819292, 16839553, 16821140, 16826813, 16838305, 16791034, 16840099, 16798334, 16831329, 16804414, 16823192, 16811447, 16792111, 16796751, 16815349, 16809529,
+   16839372, 16800599, 16792857, 16812079, 16779341, 16829341, 16818418, 16780162, 16779722, 16836736, 16838014, 16780582, 16831637, 16841059, 16812076, 16833855,
+   16820401, 16806819, 16829561, 16838633, 16809858, 16826268, 16792714, 16816380, 16812341, 16839988, 16782527, 16834714, 16841983, 16788618, 16822163, 16814194,
+   16795874, 16804842, 16806038, 16834729, 16785099, 16812679, 16793016, 16814979, 16779777, 16820281, 16814284, 16842543, 16790114, 16795549, 16778279, 16813876,
+   16839518, 16782334, 16814980, 16800104, 16795950, 16782862, 16831070, 16789765, 16833411, 16779349, 16809269, 16832708, 16808145, 16813823, 16806647, 16829228,
+   16806580, 16783900, 16811417, 16832223, 16790869, 16805299, 16817060, 16791316, 16789711, 16801005, 16803162, 16814156, 16828454, 16805757, 16814936, 16811600,
+   16791488, 16784452, 16837351, 16820263, 16784278, 16797334, 16842000, 16785836, 16797103, 16818841, 16791951, 16786307, 16840218, 16829914, 16839267, 16783083,
+   16780985, 16831761, 16780394, 16811407, 16838319, 16828349, 16791667, 16833820, 16780366, 16791331, 16811043, 16821249, 16827500, 16816926, 16823292, 16804305,
+   16809116, 16810463, 16809985, 16819836, 16820953, 16820405, 16810295, 16794717, 16805048, 16790021, 16791651, 16819552, 16839878, 16811280, 16824933, 16821074,
+   16810120, 16802384, 16812680, 16806621, 16799567, 16815704, 16818543, 16824159, 16790292, 16823045, 16837021, 16804931, 16840913, 16782666, 16807429, 16784930,
+   16780858, 16834226, 16809555, 16829713, 16784189, 16826754, 16817771, 16807398, 16787191, 16794002, 16807104, 16787110, 16833709, 16835306, 16803596, 16806740,
+   16790622, 16796498, 16778329, 16806327, 16840998, 16826169, 16839552, 16826630, 16814074, 16839599, 16824473, 16794229, 16821741, 16824335, 16816604, 16805039,
+   16806389, 16842612, 16796461, 16783103, 16782068, 16807772, 16800787, 16818445, 16831096, 16818929, 16792781, 16779801, 16816305, 16799006, 16793232, 16820172,
+   16784547, 16778573, 16832340, 16801671, 16829000, 16815529, 16825168, 16791374, 16819464, 16831168, 16828040, 16808010, 16833979, 16820302, 16835247, 16822849,
+   16788515, 16779491, 16824193, 16833154, 16803790, 16841058, 16841181, 16793893, 16816440, 16791638, 16824991, 16829878, 16800171, 16831571, 16786590, 16831599,
+   16784658, 16809394, 16826375, 16817680, 16817457, 16806755, 16784096, 16797873, 16831380, 16805493, 16837534, 16827306, 16824427, 16841565, 16814281, 16808890,
+   16787503, 16811361, 16826877, 16790693, 16808018, 16798713, 16796628, 16801487, 16795467, 16801029, 16829157, 16842154, 16788800, 16826942, 16808281, 16838405,
+   16810936, 16810535, 16805002, 16801030, 16796613, 16789555, 16808332, 16785248, 16786597, 16794192, 16800754, 16832863, 16806234, 16786510, 16803017, 16787905,
+   16815537, 16782557, 16831710, 16832151, 16785487, 16809147, 16812572, 16828257, 16794316, 16799946, 16811632, 16840337, 16818265, 16808128, 16830236, 16820576,
+   16837022, 16813129, 16781875, 16781256, 16789761, 16828574, 16808006, 16781584, 16783717, 16831609, 16820960, 16830492, 16831840, 16792436, 16783236, 16781282,
+   16838446, 16821048, 16814644, 16817783, 16788995, 16823035, 16826032, 16790928, 16840140, 16815449, 16838751, 16802827, 16839150, 16817654, 16840262, 16815588,
+   16815284, 16806997, 16841490, 16828672, 16781123, 16812732, 16805062, 16790562, 16781596, 16797587, 16800378, 16815483, 16833516, 16799881, 16817984, 16794490,
+   16810997, 16786730, 16800498, 16826838, 16829031, 16797956, 16834568, 16800451, 16838515, 16784490, 16790308, 16797024, 16836265, 16834850, 16778371, 16827502,
+   16832287, 16785529, 16809276, 16803716, 16812355, 16818868, 16783413, 16781651, 16823092, 16829547, 16838517, 16793732, 16810738, 16820983, 16811574, 16819541,
+   16803020, 16803102, 16828910, 16783500, 16797022, 16831728, 16828815, 16798573, 16821252, 16820424, 16804775, 16829690, 16794219, 16780324, 16839626, 16808169,
+   16789301, 16822233, 16819613, 16793230, 16784714, 16825868, 16810148, 16833063, 16835880, 16800512, 16828344, 16784055, 16802178, 16839148, 16825434, 16811984,
+   16801648, 16800371, 16798615, 16788159, 16818626, 16778196, 16802615, 16804648, 16833426, 16839732, 16824298, 16782796, 16800682, 16798882, 16783409, 16779631,
+   16813918, 16808699, 16787122, 16835993, 16830307, 16780048, 16840596, 16798947, 16779355, 16809381, 16798752, 16799162, 16828804, 16788491, 16787513, 16784734,
+   16793142, 16785190, 16783662, 16800669, 16809296, 16801619, 16787319, 16809792, 16831906, 16789876, 16819188, 16828983, 16840698, 16826954, 16821642, 16787018,
+   16794937, 16781692, 16810700, 16828899, 16777793, 16803126, 16797220, 16789600, 16820821, 16779138, 16787287, 16786268, 16836007, 16830831, 16826752, 16781463,
+   16838406, 16832792, 16798356, 16824428, 16799862, 16809889, 16777539, 16794738, 16783971, 16791209, 16780270, 16792967, 16784068, 16840911, 16779740, 16781743,
+   16810461, 16802884, 16814926, 16805322, 16807132, 16793009, 16823121, 16816903, 16778027, 16777976, 16825353, 16786427, 16789096, 16820282, 16787518, 16818696,
+   16834754, 16831657, 16795065, 16839292, 16812885, 16823788, 16831841, 16831353, 16837069, 16821126, 16814061, 16829731, 16802033, 16829981, 16825986, 16817464,
+   16815269, 16782347, 16794126, 16786857, 16800865, 16785153, 16828229, 16817634, 16791143, 16797675, 16822922, 16827429, 16829809, 16797164, 16797124, 16817026,
+   16781661, 16780257, 16809852, 16837960, 16788002, 16779969, 16779522, 16813750, 16831624, 16835714, 16832629, 16797864, 16827040, 16815982, 16833249, 16799396,
+   16824766, 16805040, 16821415, 16812563, 16805350, 16817506, 16814982, 16781492, 16792485, 16798942, 16796647, 16841132, 16787550, 16837162, 16792866, 16838830,
+   16793342, 16806158, 16827509, 16801785, 16838796, 16794171, 16779958, 16813546, 16801430, 16792462, 16821753, 16838589, 16787358, 16791490, 16792084, 16797297,
+   16787437, 16800025, 16821263, 16796508, 16787414, 16800483, 16790272, 16838972, 16839432, 16799899, 16821479, 16777919, 16838773, 16803602, 16795501, 16840211,
+   16789394, 16829534, 16795365, 16840811, 16813561, 16806763, 16838016, 16794089, 16839947, 16833960, 16839489, 16835108, 16798505, 16801846, 16837247, 16803461,
+   16787602, 16815120, 16781120, 16818444, 16802562, 16826426, 16817496, 16804617, 16778375, 16797834, 16834200, 16793390, 16814010, 16814909, 16842514, 16806614,
+   16804366, 16836145, 16831957, 16780311, 16839099, 16803932, 16834668, 16786955, 16813494, 16808820, 16834036, 16826805, 16779561, 16839769, 16835438, 16831618,
+   16806122, 16836235, 16814332, 16789533, 16790548, 16818955, 16818545, 16785999, 16822514, 16803723, 16838566, 16813158, 16783544, 16802693, 16782966, 16799901,
+   16789115, 16805386, 16828034, 16823547, 16805439, 16806961, 16789306, 16782087, 16830509, 16792784, 16839997, 16826056, 16821268, 16807876, 16806025, 16835725,
+   16781318, 16817408, 16786346, 16787830, 16808136, 16830064, 16798022, 16805359, 16808526, 16809168, 16832727, 16795055, 16802724, 16782818, 16815434, 16835525,
+   16817568, 16799841, 16807233, 16790653, 16816768, 16782255, 16777265, 16783302, 16803278, 16795396, 16820599, 16816881, 16782599, 16787826, 16829326, 16829776,
+   16839765, 16792831, 16817787, 16797480, 16810058, 16791885, 16780673, 16825717, 16821203, 16777638, 16777505, 16832769, 16798195, 16780145, 16827193, 16840282,
+   16808864, 16793101, 16804532, 16794985, 16779573, 16832452, 16834912, 16834334, 16820127, 16778471, 16838203, 16829107, 16795095, 16841737, 16795831, 16822590,
+   16837598, 16786472, 16790244, 16821635, 16797267, 16836898, 16780451, 16800004, 16811800, 16784382, 16811461, 16819135, 16815024, 16789015, 16789980, 16806021,
+   16828825, 16789006, 16806338, 16832596, 16833538, 16828222, 16806825, 16836118, 16806861, 16777941, 16793866, 16840425, 16833518, 16803826, 16807714, 16794246,
+   16818954, 16787542, 16794806, 16784835, 16812337, 16782198, 16791149, 16801024, 16815166, 16837926, 16810151, 16829451, 16835585, 16832594, 16821534, 16823402,
+   16808445, 16822412, 16836638, 16795380, 16812339, 16804154, 16823344, 16825392, 16786671, 16825823, 16816425, 16791161, 16817946, 16806837, 16784215, 16779865,
+   16810726, 16783447, 16800031, 16806719, 16781458, 16784563, 16791562, 16792532, 16785670, 16792947, 16796406, 16841658, 16831095, 16795663, 16833719, 16793372,
+   16831321, 16781146, 16779237, 16827905, 16818175, 16788417, 16801265, 16803052, 16803629, 16801850, 16833255, 16816526, 16788282, 16783658, 16824440, 16778874,
+   16809793, 16838379, 16804969, 16796174, 16790250, 16833500, 16818731, 16837882, 16780902, 16824350, 16784907, 16822167, 16833940, 16789086, 16838813, 16819772,
+   16778812, 16826522, 16791723, 16793322, 16797505, 16810753, 16828125, 16819224, 16814105, 16800900, 16816061, 16795402, 16782857, 16785375, 16781537, 16792919,
+   16794800, 16810170, 16782795, 16835258, 16810678, 16821475, 16807475, 16833435, 16825963, 16791323, 16803060, 16821146, 16786267, 16782565, 16828416, 16840814,
+   16817327, 16796946, 16794265, 16834394, 16829264, 16789034, 16815740, 16833932, 16786804, 16825660, 16821176, 16800759, 16837519, 16790735, 16797467, 16801719,
+   16788873, 16821351, 16785767, 16826451, 16798709, 16815812, 16840602, 16812736, 16798127, 16814233, 16816154, 16795375, 16803858, 16791964, 16805563, 16783592,
+   16813320, 16783967, 16779899, 16838289, 16800157, 16800233, 16803061, 16819389, 16833456, 16806717, 16817686, 16821630, 16801439, 16803952, 16827099, 16842333,
+   16818322, 16784653, 16836043, 16814329, 16798705, 16817112, 16809441, 16836773, 16820384, 16832882, 16814100, 16792102, 16816765, 16831448, 16798915, 16829416,
+   16812019, 16782762, 16818453, 16822413, 16821289, 16840928, 16817859, 16821248, 16778989, 16840089, 16810197, 16792114, 16813540, 16804802, 16790147, 16799789,
+   16811091, 16807122, 16778935, 16812112, 16833897, 16804794, 16811511, 16815832, 16777561, 16833526, 16795793, 16779935, 16832718, 16819775, 16807095, 16791158,
+   16838009, 16820509, 16795648, 16797704, 16779308, 16802679, 16841566, 16779712, 16809848, 16830682, 16837993, 16832222, 16780695, 16801669, 16824311, 16779977,
+   16812179, 16821117, 16790903, 16838569, 16794568, 16797728, 16787272, 16795440, 16815606, 16816216, 16826360, 16821767, 16833914, 16795617, 16833971, 16827160,
+   16787383, 16834090, 16834713, 16781202, 16836268, 16820188, 16823199, 16821229, 16786155, 16788293, 16838892, 16814262, 16788721, 16818093, 16809423, 16785340,
+   16806136, 16789039, 16821671, 16794708, 16817592, 16821065, 16777927, 16792386, 16817548, 16824571, 16833513, 16834044, 16780383, 16789123, 16785402, 16816970,
+   16802456, 16805304, 16808719, 16817662, 16789817, 16813587, 16811363, 16812791, 16822672, 16841285, 16787004, 16836393, 16789425, 16838156, 16828054, 16780449,
+   16803298, 16796311, 16827301, 16825482, 16816623, 16801329, 16788620, 16791369, 16825631, 16788353, 16807065, 16780854, 16810718, 16811750, 16823528, 16795651,
+   16838718, 16835476, 16830474, 16819425, 16791066, 16797305, 16812459, 16811820, 16815361, 16830042, 16814576, 16835416, 16778143, 16833600, 16790811, 16836020,
+   16782856, 16835787, 16792807, 16789216, 16795451, 16804641, 16835611, 16794689, 16826027, 16829800, 16828820, 16778714, 16818928, 16822641, 16837273, 16829684,
+   16792229, 16779381, 16797984, 16818682, 16780001, 16833428, 16780956, 16802013, 16810866, 16780587, 16813269, 16810185, 16818671, 16841967, 16823856, 16794538,
+   16785257, 16808178, 16816584, 16809843, 16824992, 16805987, 16789499, 16814144, 16781289, 16778382, 16829502, 16788828, 16817813, 16778431, 16804037, 16786452,
+   16796520, 16788948, 16797131, 16839161, 16802203, 16801662, 16819162, 16819984, 16833707, 16799785, 16797048, 16818967, 16820933, 16815901, 16805741, 16790616,
+   16801958, 16784357, 16837133, 16786330, 16815918, 16809800, 16798870, 16840617, 16797682, 16793318, 16805323, 16795576, 16790419, 16784678, 16835382, 16799170,
+   16805031, 16821031, 16782130, 16815337, 16785452, 16826629, 16840956, 16815735, 16783343, 16802352, 16813115, 16819022, 16834378, 16783061, 16819463, 16835896,
+   16781019, 16781756, 16784955, 16808787, 16841749, 16785166, 16804295, 16804882, 16819322, 16840873, 16797695, 16830401, 16836865, 16784361, 16777749, 16832360,
+   16777897, 16780821, 16823647, 16823807, 16818226, 16799607, 16801110, 16787246, 16837997, 16780222, 16815280, 16806888, 16840235, 16782403, 16814570, 16833553,
+   16780894, 16802293, 16829643, 16783142, 16799110, 16814319, 16841040, 16778844, 16828620, 16821743, 16832707, 16824103, 16806608, 16792588, 16787981, 16781575,
+   16819496, 16791087, 16818408, 16803765, 16798367, 16838651, 16835401, 16806766, 16778270, 16805178, 16837001, 16839799, 16788336, 16813793, 16821821, 16839798,
+   16778261, 16783529, 16813811, 16782391, 16794737, 16839822, 16820478, 16841056, 16804784, 16802374, 16834283, 16792456, 16840583, 16796719, 16799808, 16780911},
+  {16825612, 16821875, 16783912, 16794238, 16832600, 16801695, 16777290, 16831666, 16782481, 16781915, 16842272, 16781275, 16817995, 16815179, 16828869, 16797246,
+   16813215, 16807869, 16790016, 16805359, 16792807, 16781591, 16795133, 16833852, 16799991, 16811309, 16784520, 16834479, 16838207, 16822672, 16799397, 16822970,
+   16779462, 16800401, 16829696, 16780782, 16781249, 16834537, 16790843, 16834683, 16805039, 16816033, 16797675, 16804073, 16822239, 16806517, 16826123, 16783715,
+   16802051, 16803819, 16833734, 16791310, 16837547, 16814920, 16807600, 16835707, 16794449, 16818447, 16799742, 16818312, 16833315, 16831629, 16809376, 16805575,
+   16794373, 16819227, 16798497, 16829439, 16807007, 16834692, 16841064, 16815380, 16834152, 16813709, 16812923, 16828298, 16825333, 16814481, 16788524, 16787502,
+   16812248, 16794798, 16820589, 16780643, 16819562, 16811333, 16807952, 16805430, 16840827, 16799764, 16803947, 16833993, 16807267, 16821033, 16821736, 16839832,
+   16786357, 16795568, 16806733, 16797969, 16838177, 16828369, 16777472, 16834853, 16784646, 16809033, 16788895, 16818367, 16784104, 16791371, 16835753, 16816186,
+   16792724, 16806312, 16835241, 16841215, 16826438, 16836785, 16801349, 16832011, 16828638, 16779140, 16841171, 16779798, 16806605, 16818228, 16786190, 16786356,
+   16789356, 16828506, 16811958, 16815699, 16781784, 16797867, 16834002, 16822095, 16790430, 16790543, 16804413, 16814144, 16793740, 16787848, 16809855, 16823612,
+   16803643, 16801296, 16797822, 16806259, 16830859, 16830730, 16778288, 16785449, 16803716, 16818175, 16795614, 16783326, 16791962, 16811815, 16780921, 16823220,
+   16801120, 16832331, 16835905, 16794202, 16782375, 16838816, 16804014, 16791754, 16796622, 16790171, 16799693, 16818135, 16777975, 16788350, 16795557, 16795277,
+   16783600, 16790670, 16838146, 16795540, 16821763, 16795339, 16829399, 16777504, 16841286, 16813980, 16815985, 16793742, 16811900, 16827585, 16817287, 16780602,
+   16783194, 16780864, 16791177, 16784083, 16803793, 16795962, 16804454, 16825667, 16839433, 16787559, 16826243, 16810423, 16806658, 16830379, 16819274, 16825390,
+   16813915, 16809331, 16791066, 16796327, 16827070, 16807615, 16779003, 16797052, 16812404, 16801124, 16802551, 16813801, 16799664, 16841809, 16838511, 16812463,
+   16802590, 16837823, 16778093, 16839310, 16797103, 16807945, 16825437, 16839746, 16810125, 16821326, 16823834, 16835672, 16819706, 16779467, 16836074, 16821741,
+   16797400, 16795257, 16788384, 16785354, 16823918, 16777962, 16839232, 16818498, 16841242, 16800166, 16787318, 16793132, 16838939, 16798054, 16815454, 16835203,
+   16820389, 16800852, 16784749, 16813373, 16780778, 16818806, 16831966, 16790161, 16838901, 16812776, 16833347, 16826556, 16799858, 16794961, 16794747, 16833721,
+   16809516, 16827440, 16781563, 16798825, 16839086, 16794623, 16797656, 16782705, 16799902, 16823648, 16806003, 16821657, 16782921, 16838574, 16816068, 16787276,
+   16816240, 16816422, 16839132, 16805231, 16818949, 16802528, 16821711, 16836147, 16778336, 16783338, 16784424, 16828779, 16829865, 16785951, 16834388, 16784662,
+   16828989, 16816212, 16824628, 16786247, 16824739, 16781014, 16806957, 16831009, 16842134, 16824105, 16841627, 16840076, 16785656, 16809770, 16784565, 16784553,
+   16831214, 16786380, 16825223, 16825402, 16816193, 16840368, 16804341, 16811145, 16803516, 16783168, 16809633, 16778312, 16785254, 16818947, 16811041, 16777748,
+   16807912, 16782414, 16821795, 16804600, 16788686, 16836323, 16841638, 16828918, 16809035, 16837404, 16808130, 16824122, 16793362, 16795641, 16827420, 16821198,
+   16797895, 16829588, 16796394, 16790138, 16817156, 16839668, 16842146, 16777481, 16830693, 16820380, 16841938, 16840763, 16813787, 16833904, 16835009, 16777906,
+   16786043, 16835205, 16817205, 16789195, 16784942, 16797600, 16813577, 16803704, 16780992, 16810708, 16842191, 16826014, 16822009, 16819956, 16787363, 16820794,
+   16799284, 16840117, 16796447, 16781223, 16836197, 16790870, 16829187, 16799567, 16812213, 16819439, 16838996, 16802663, 16828234, 16824237, 16783677, 16823493,
+   16785969, 16830137, 16832925, 16786722, 16817525, 16823811, 16813746, 16823617, 16829976, 16838250, 16834620, 16791750, 16820967, 16818372, 16804488, 16810081,
+   16788498, 16838831, 16842145, 16807043, 16832613, 16807896, 16790912, 16803954, 16779326, 16798100, 16815828, 16820862, 16789063, 16817123, 16793095, 16809049,
+   16786393, 16804008, 16806318, 16826802, 16835389, 16797690, 16802249, 16803570, 16798017, 16793601, 16841299, 16786693, 16780143, 16841906, 16781945, 16838048,
+   16783728, 16823418, 16841265, 16789778, 16824850, 16833959, 16839932, 16781716, 16806797, 16802388, 16809709, 16830945, 16782939, 16807023, 16829081, 16815920,
+   16824072, 16810966, 16811225, 16795600, 16782885, 16822555, 16798789, 16817177, 16790606, 16818859, 16795865, 16813461, 16779117, 16803231, 16803195, 16788968,
+   16802866, 16834772, 16808988, 16793696, 16822574, 16821034, 16805501, 16837826, 16778584, 16783220, 16835870, 16819488, 16801831, 16805821, 16824432, 16801101,
+   16778030, 16822980, 16794339, 16834202, 16827291, 16799754, 16809361, 16800000, 16827204, 16802407, 16839868, 16816030, 16809179, 16815714, 16841750, 16794846,
+   16831222, 16778296, 16831772, 16788523, 16786601, 16816850, 16837893, 16810588, 16778763, 16794705, 16796841, 16777946, 16788512, 16811132, 16811301, 16785204,
+   16797326, 16812539, 16827242, 16838023, 16829922, 16790126, 16836487, 16784808, 16806742, 16840299, 16802567, 16831468, 16801537, 16800956, 16839361, 16804059,
+   16802924, 16806529, 16825297, 16831509, 16827275, 16820609, 16816495, 16803785, 16839711, 16779193, 16821804, 16835306, 16814243, 16817880, 16820471, 16814855,
+   16800697, 16823709, 16820555, 16826032, 16805024, 16786078, 16809986, 16818602, 16786295, 16837413, 16827394, 16819104, 16821404, 16819835, 16789831, 16816942,
+   16842459, 16836935, 16803834, 16803369, 16784934, 16781790, 16842744, 16799890, 16785893, 16810181, 16828096, 16791182, 16823383, 16835527, 16823068, 16840511,
+   16836384, 16798444, 16782782, 16792920, 16804761, 16841355, 16802679, 16820767, 16842703, 16803747, 16778267, 16807987, 16806355, 16840188, 16779388, 16819101,
+   16824750, 16786340, 16827005, 16834794, 16784973, 16838431, 16800791, 16831300, 16812644, 16782958, 16812156, 16796158, 16824495, 16801391, 16787003, 16805181,
+   16815372, 16829778, 16801903, 16789051, 16842467, 16839767, 16840712, 16819067, 16802506, 16784025, 16805201, 16797370, 16834734, 16829721, 16840505, 16828789,
+   16789267, 16813933, 16799701, 16812249, 16783270, 16823487, 16820208, 16814947, 16839037, 16826159, 16827564, 16836582, 16787723, 16833556, 16841488, 16783446,
+   16841511, 16790249, 16785733, 16821929, 16819034, 16822173, 16823306, 16818357, 16780444, 16804837, 16810795, 16777723, 16839664, 16804987, 16819927, 16809692,
+   16799226, 16801940, 16836123, 16838987, 16838977, 16810220, 16821176, 16840044, 16823395, 16833324, 16830136, 16824253, 16809100, 16825146, 16812772, 16838714,
+   16810646, 16791330, 16812256, 16840733, 16787528, 16777698, 16809712, 16779627, 16828469, 16838118, 16812367, 16782309, 16830891, 16817860, 16832007, 16839816,
+   16832380, 16840362, 16829123, 16803903, 16778710, 16785148, 16803056, 16838552, 16799463, 16798259, 16791967, 16792294, 16799056, 16805617, 16783074, 16834234,
+   16790878, 16794988, 16802197, 16806071, 16781057, 16801540, 16806740, 16826590, 16797273, 16784960, 16829099, 16807073, 16810976, 16808348, 16839737, 16823309,
+   16840769, 16825092, 16819175, 16799816, 16788458, 16813176, 16805519, 16799407, 16835152, 16835175, 16784648, 16786071, 16836499, 16833742, 16794822, 16829954,
+   16831457, 16807851, 16786733, 16832327, 16778582, 16790698, 16827389, 16789981, 16825048, 16832425, 16817873, 16834478, 16832141, 16797854, 16834499, 16830795,
+   16826396, 16841473, 16808340, 16780351, 16777263, 16800533, 16809739, 16828968, 16816774, 16779682, 16838468, 16793561, 16830395, 16833704, 16785539, 16829557,
+   16797021, 16818840, 16832467, 16792195, 16780959, 16800682, 16800952, 16796606, 16831464, 16830809, 16806276, 16810658, 16784672, 16822810, 16800964, 16819486,
+   16780979, 16826942, 16802660, 16825498, 16832289, 16789811, 16818706, 16821626, 16831787, 16794211, 16833415, 16814651, 16827249, 16788094, 16838546, 16826220,
+   16804544, 16807351, 16834415, 16813433, 16803409, 16784752, 16811117, 16779038, 16817504, 16808786, 16780173, 16832170, 16781523, 16828018, 16777451, 16836034,
+   16782616, 16813133, 16824083, 16809509, 16782158, 16780645, 16831200, 16784050, 16800343, 16816771, 16793727, 16805449, 16823646, 16833637, 16823674, 16829145,
+   16810285, 16831394, 16790651, 16801498, 16788899, 16794858, 16829789, 16800219, 16802639, 16791493, 16816154, 16827818, 16792030, 16841916, 16781180, 16793182,
+   16779506, 16829117, 16821928, 16778798, 16799535, 16800170, 16802858, 16826820, 16777760, 16822485, 16828463, 16810404, 16832090, 16835712, 16826053, 16798233,
+   16778162, 16779026, 16829950, 16811080, 16783052, 16803106, 16805143, 16797707, 16807878, 16808177, 16784860, 16816571, 16838809, 16826134, 16788445, 16818072,
+   16840223, 16780774, 16807269, 16838891, 16781757, 16836503, 16835751, 16779929, 16820333, 16802808, 16789286, 16831240, 16818633, 16823677, 16780997, 16803808,
+   16794521, 16784180, 16787224, 16785389, 16807051, 16810080, 16824331, 16831307, 16783951, 16813883, 16808377, 16785419, 16781773, 16839974, 16818362, 16782905,
+   16821491, 16829397, 16780095, 16794218, 16810488, 16779336, 16823894, 16835012, 16788912, 16819324, 16831673, 16815077, 16808454, 16801209, 16782251, 16821361,
+   16807929, 16801414, 16817844, 16800749, 16778260, 16808287, 16802975, 16830324, 16807808, 16825948, 16821939, 16840187, 16784341, 16787308, 16788481, 16777224,
+   16813742, 16819965, 16811159, 16813190, 16819313, 16838299, 16826790, 16831323, 16794323, 16789868, 16836897, 16839396, 16806852, 16832291, 16790012, 16788229,
+   16834125, 16812864, 16808638, 16819109, 16835900, 16781362, 16810484, 16805540, 16808821, 16836413, 16786821, 16808660, 16820332, 16823958, 16842647, 16783723,
+   16787381, 16832191, 16803805, 16786982, 16827303, 16777407, 16808132, 16828714, 16799154, 16778295, 16834317, 16814753, 16837427, 16801151, 16833235, 16832707,
+   16836351, 16812563, 16837230, 16793761, 16787755, 16812855, 16830148, 16792849, 16820264, 16787105, 16781654, 16786797, 16791342, 16788666, 16797648, 16780592,
+   16816515, 16782540, 16793712, 16842380, 16780537, 16842729, 16788381, 16779289, 16804058, 16795409, 16804109, 16838460, 16842223, 16829098, 16792337, 16815060,
+   16784634, 16836534, 16841519, 16803351, 16838359, 16817894, 16807333, 16815993, 16840313, 16795698, 16814504, 16817802, 16818327, 16821093, 16796972, 16804613,
+   16814101, 16806928, 16829256, 16783611, 16826749, 16793455, 16838474, 16779618, 16817314, 16830862, 16833978, 16839146, 16807370, 16817436, 16830237, 16794781,
+   16831531, 16781596, 16780750, 16835488, 16824738, 16802029, 16801919, 16821463, 16806755, 16827456, 16783854, 16820965, 16812137, 16802764, 16798152, 16836853,
+   16842494, 16842045, 16824159, 16820241, 16815211, 16791875, 16795479, 16821263, 16778492, 16840466, 16826683, 16806334, 16829386, 16836748, 16788243, 16789125,
+   16792442, 16823907, 16804648, 16779626, 16811741, 16792052, 16814430, 16834468, 16825110, 16789440, 16840508, 16780916, 16782596, 16777354, 16840020, 16782209,
+   16797461, 16796959, 16808627, 16814449, 16829269, 16837563, 16837878, 16800910, 16808501, 16804396, 16783489, 16812653, 16828089, 16784135, 16831785, 16786556,
+   16836371, 16832189, 16827731, 16781119, 16832071, 16781107, 16785468, 16784059, 16788959, 16804375, 16803763, 16829270, 16805395, 16780388, 16805206, 16829795,
+   16789104, 16827426, 16838433, 16830103, 16791400, 16792219, 16832299, 16790068, 16838756, 16813916, 16782465, 16788960, 16805188, 16812141, 16827494, 16838106,
+   16809075, 16839257, 16841234, 16794749, 16790868, 16786680, 16814176, 16829034, 16792908, 16807347, 16804999, 16815034, 16832817, 16813466, 16778360, 16818513,
+   16814986, 16823613, 16806549, 16813668, 16827114, 16833432, 16807211, 16840531, 16835573, 16795465, 16831144, 16840339, 16842152, 16812243, 16818511, 16835678,
+   16802428, 16826000, 16783258, 16789807, 16793970, 16805314, 16795618, 16840616, 16827101, 16826659, 16790589, 16789413, 16815636, 16810094, 16803031, 16832988,
+   16806133, 16797328, 16842239, 16818126, 16833972, 16793103, 16803094, 16806870, 16835984, 16839112, 16784629, 16822328, 16802857, 16838983, 16811572, 16778603,
+   16802157, 16789665, 16817574, 16831056, 16835477, 16839529, 16791411, 16824630, 16787173, 16779352, 16784478, 16807381, 16788549, 16816210, 16786942, 16815216,
+   16786798, 16832389, 16798004, 16829556, 16799469, 16803506, 16829100, 16797928, 16830764, 16801546, 16801388, 16801671, 16818566, 16822365, 16804940, 16778963,
+   16779655, 16832830, 16815910, 16802620, 16827675, 16832469, 16807523, 16785117, 16808618, 16790976, 16811856, 16813188, 16842244, 16790603, 16798423, 16778239,
+   16790018, 16799185, 16820467, 16817422, 16817819, 16805444, 16808959, 16790525, 16792722, 16796398, 16831912, 16828480, 16777704, 16796610, 16837063, 16826593,
+   16802479, 16777433, 16826298, 16800928, 16822176, 16817585, 16811487, 16790584, 16828864, 16817457, 16817936, 16831624, 16803679, 16796965, 16792832, 16798251,
+   16799922, 16781313, 16812071, 16800450, 16815145, 16835832, 16784021, 16834280, 16809379, 16803504, 16825189, 16818811, 16809495, 16809051, 16786118, 16807244,
+   16835615, 16813937, 16841867, 16808297, 16791776, 16795636, 16828329, 16837067, 16807988, 16789000, 16830092, 16837433, 16783278, 16838871, 16810565, 16814653,
+   16818444, 16793918, 16840992, 16840230, 16800108, 16836501, 16833643, 16784622, 16777807, 16796231, 16804577, 16841120, 16801785, 16793818, 16798562, 16779714,
+   16822812, 16828942, 16821388, 16808363, 16822602, 16834597, 16809094, 16779629, 16792932, 16802940, 16785915, 16841122, 16820658, 16803581, 16785072, 16831901,
+   16814500, 16827315, 16797616, 16802040, 16790141, 16838124, 16823830, 16800683, 16823812, 16804006, 16798336, 16800064, 16793567, 16790500, 16821718, 16838995,
+   16788003, 16834265, 16828312, 16835115, 16804346, 16780524, 16809559, 16826170, 16803127, 16828169, 16777715, 16830860, 16822381, 16796580, 16811565, 16794509,
+   16793433, 16834056, 16829587, 16819433, 16791796, 16792322, 16828631, 16801443, 16807838, 16809663, 16788145, 16781755, 16781528, 16836887, 16783999, 16801116,
+   16825406, 16784669, 16793442, 16840100, 16835827, 16796265, 16795386, 16802710, 16803028, 16834902, 16794379, 16812806, 16783037, 16827238, 16787738, 16798944,
+   16812032, 16815627, 16831229, 16833530, 16799276, 16801122, 16792585, 16836002, 16825563, 16827726, 16780308, 16816758, 16784000, 16808971, 16786133, 16792206,
+   16806863, 16816247, 16779501, 16831033, 16790869, 16802062, 16833316, 16820768, 16833462, 16795107, 16818008, 16782952, 16815030, 16815116, 16808193, 16803317,
+   16818733, 16778011, 16781551, 16805280, 16784442, 16823657, 16813932, 16809073, 16796667, 16778878, 16820111, 16824316, 16824070, 16801859, 16781034, 16815772,
+   16836991, 16808684, 16833843, 16800274, 16808403, 16806998, 16813395, 16822857, 16838742, 16815979, 16790380, 16822533, 16809252, 16795396, 16819630, 16788823,
+   16782586, 16779793, 16816057, 16792826, 16803891, 16825566, 16802655, 16833194, 16781988, 16840396, 16790600, 16814379, 16791249, 16785438, 16788530, 16803956,
+   16811787, 16793396, 16823591, 16830758, 16784031, 16798359, 16804998, 16808654, 16839633, 16799954, 16788089, 16785649, 16819808, 16790441, 16780175, 16802477,
+   16796493, 16828097, 16816187, 16835189, 16809630, 16799498, 16787709, 16787051, 16836514, 16827186, 16801535, 16801886, 16838694, 16839690, 16811840, 16817881,
+   16817708, 16797314, 16799166, 16821242, 16840189, 16781299, 16810676, 16829021, 16822076, 16808050, 16815884, 16811859, 16794786, 16825368, 16821955, 16824112,
+   16816318, 16814465, 16813025, 16834633, 16803683, 16804739, 16834735, 16789161, 16813848, 16780757, 16791210, 16801573, 16790302, 16817001, 16802561, 16826287,
+   16785988, 16834829, 16816457, 16780728, 16834577, 16840351, 16824995, 16795215, 16778644, 16813869, 16799516, 16842684, 16840637, 16833753, 16787964, 16786928,
+   16797451, 16782143, 16778139, 16828569, 16777731, 16837523, 16834462, 16822131, 16812804, 16818723, 16829897, 16824867, 16798990, 16832810, 16786822, 16788594,
+   16817606, 16814159, 16800572, 16796476, 16811152, 16816316, 16793936, 16790703, 16829781, 16805115, 16806283, 16811067, 16810428, 16833411, 16790478, 16797937,
+   16842033, 16795269, 16809285, 16795460, 16795340, 16798012, 16783599, 16842067, 16812377, 16813182, 16839874, 16789531, 16824481, 16799318, 16833867, 16840491,
+   16779447, 16807070, 16777655, 16827764, 16817131, 16835864, 16831278, 16828985, 16792835, 16811174, 16788853, 16821090, 16818562, 16820406, 16777524, 16803618,
+   16842610, 16814704, 16836354, 16817716, 16808456, 16800223, 16813957, 16840156, 16781954, 16833562, 16803644, 16816634, 16838426, 16799311, 16810650, 16802317,
+   16788893, 16781006, 16839614, 16817743, 16796072, 16818708, 16793504, 16831622, 16801269, 16836764, 16822706, 16813703, 16792130, 16799214, 16785881, 16831208,
+   16787317, 16838769, 16813260, 16804273, 16785445, 16827383, 16782197, 16784508, 16840705, 16816629, 16828477, 16779027, 16795322, 16813528, 16785712, 16807191,
+   16819705, 16820441, 16838129, 16786342, 16789312, 16825320, 16833689, 16780539, 16822181, 16827313, 16791510, 16822141, 16806266, 16781979, 16802064, 16809060,
+   16837985, 16831832, 16825649, 16782260, 16802856, 16783309, 16798177, 16786570, 16790689, 16826010, 16785018, 16789360, 16834731, 16825324, 16790891, 16782486,
+   16785965, 16822298, 16823703, 16839970, 16798501, 16801072, 16786431, 16832067, 16819890, 16839661, 16785522, 16819350, 16794064, 16781574, 16795775, 16815854,
+   16783797, 16782449, 16801065, 16782318, 16780557, 16817374, 16788747, 16820346, 16791599, 16815399, 16802171, 16805699, 16781588, 16790830, 16840592, 16826770,
+   16834906, 16832320, 16796473, 16788851, 16815084, 16812189, 16778221, 16811940, 16783213, 16824836, 16790230, 16804064, 16784299, 16789704, 16778297, 16833778,
+   16825039, 16784935, 16827049, 16797218, 16789821, 16837859, 16793694, 16834850, 16824436, 16803975, 16807232, 16796084, 16790734, 16840969, 16834488, 16797682,
+   16819619, 16815230, 16792912, 16796252, 16819410, 16830231, 16790129, 16840666, 16800451, 16837896, 16792697, 16816122, 16795201, 16782478, 16840145, 16781570,
+   16827036, 16840530, 16788043, 16817230, 16800221, 16839387, 16789857, 16803680, 16795159, 16815644, 16825916, 16777919, 16799394, 16827776, 16800788, 16819718,
+   16787215, 16816617, 16803533, 16800071, 16838619, 16800484, 16810426, 16800086, 16785961, 16842116, 16804545, 16835326, 16830316, 16838524, 16813744, 16813090,
+   16795092, 16806969, 16800766, 16812231, 16783640, 16826135, 16829445, 16796801, 16827287, 16807674, 16815233, 16799405, 16792900, 16840646, 16826609, 16842052,
+   16792894, 16780578, 16810199, 16793865, 16809225, 16788184, 16809109, 16795247, 16790769, 16830134, 16839482, 16838788, 16779337, 16779586, 16782505, 16779004,
+   16789331, 16794123, 16827802, 16842661, 16790519, 16788352, 16818203, 16808441, 16788875, 16811228, 16806614, 16831862, 16785466, 16791153, 16780894, 16805334,
+   16796010, 16818431, 16830213, 16807177, 16818808, 16828423, 16833655, 16791112, 16814930, 16841455, 16797919, 16836157, 16841552, 16807521, 16795440, 16841173,
+   16781885, 16785841, 16784013, 16841414, 16784707, 16794354, 16793573, 16819100, 16827954, 16835629, 16792408, 16816725, 16833270, 16797259, 16837770, 16804456,
+   16790918, 16817885, 16808357, 16828848, 16806281, 16803880, 16828115, 16832498, 16778264, 16840048, 16810052, 16793949, 16833776, 16820080, 16802063, 16833554,
+   16797337, 16790587, 16811047, 16839271, 16794555, 16802151, 16823713, 16803247, 16834417, 16796681, 16812558, 16799050, 16820928, 16788602, 16808002, 16826564,
+   16802623, 16838580, 16802455, 16814783, 16810255, 16788780, 16789438, 16793147, 16811457, 16804310, 16803252, 16806875, 16828303, 16834538, 16804219, 16812394,
+   16827181, 16792200, 16787529, 16800353, 16825784, 16792254, 16829210, 16827846, 16791929, 16778706, 16820280, 16810873, 16798183, 16805682, 16841260, 16792462,
+   16842377, 16781875, 16835740, 16790528, 16813907, 16810422, 16833491, 16793177, 16815498, 16788654, 16821087, 16824450, 16816763, 16842155, 16814077, 16821428,
+   16800034, 16832624, 16826764, 16812703, 16800122, 16830173, 16809737, 16801665, 16816970, 16810922, 16805179, 16793963, 16784657, 16797938, 16814249, 16822481,
+   16796110, 16782472, 16805481, 16829407, 16801963, 16790487, 16790714, 16803631, 16801182, 16806798, 16784770, 16779323, 16805418, 16779925, 16800337, 16783313,
+   16800929, 16780028, 16818836, 16782822, 16790825, 16801135, 16839657, 16824791, 16817678, 16828752, 16817423, 16781482, 16824420, 16814395, 16828962, 16825290,
+   16828757, 16832259, 16826905, 16803013, 16809616, 16828374, 16837812, 16825564, 16824226, 16809404, 16822921, 16797738, 16831312, 16825041, 16790115, 16841989,
+   16836762, 16809579, 16801127, 16789966, 16815958, 16809569, 16831705, 16806339, 16794504, 16785589, 16782857, 16782485, 16825656, 16799239, 16818337, 16777970,
+   16809120, 16823356, 16820058, 16786837, 16833817, 16835741, 16808345, 16800460, 16808546, 16794318, 16842405, 16818130, 16831469, 16812842, 16822935, 16831620,
+   16785030, 16838887, 16797906, 16831788, 16789083, 16783369, 16829753, 16819169, 16827102, 16794475, 16782726, 16802259, 16807000, 16794878, 16792505, 16823136,
+   16806241, 16795141, 16820684, 16825971, 16802849, 16784215, 16794420, 16790994, 16788207, 16835337, 16819604, 16789656, 16821350, 16807153, 16809858, 16792370,
+   16815437, 16787932, 16780785, 16784273, 16836364, 16785124, 16813571, 16808004, 16822186, 16787994, 16811921, 16820094, 16790148, 16824864, 16806044, 16836837,
+   16801649, 16778499, 16789512, 16786334, 16782181, 16806988, 16806154, 16807405, 16816832, 16820151, 16778711, 16789423, 16809227, 16808798, 16816720, 16794616,
+   16790901, 16805365, 16802861, 16780147, 16806032, 16808436, 16801389, 16842444, 16820306, 16806946, 16790657, 16818858, 16793034, 16781008, 16835808, 16780018,
+   16795593, 16818140, 16833262, 16798516, 16796534, 16780307, 16824295, 16828391, 16818268, 16822864, 16837644, 16821769, 16812627, 16811146, 16783380, 16813765,
+   16831800, 16841620, 16778647, 16782233, 16832653, 16778745, 16782598, 16805484, 16837618, 16811548, 16824926, 16820395, 16801747, 16806728, 16825204, 16798097,
+   16828966, 16803963, 16835348, 16794534, 16830782, 16786135, 16825788, 16787014, 16836140, 16812672, 16830120, 16820614, 16836052, 16802316, 16841382, 16822066,
+   16785948, 16801352, 16828731, 16834226, 16804071, 16809517, 16781780, 16830779, 16837900, 16777217, 16818639, 16810685, 16795635, 16799168, 16813852, 16819199,
+   16795954, 16817514, 16837025, 16835671, 16784965, 16831805, 16842150, 16789455, 16821027, 16820138, 16819398, 16817175, 16811766, 16795803, 16784214, 16819902,
+   16779706, 16828214, 16811665, 16828662, 16778737, 16834514, 16789022, 16779251, 16811441, 16798373, 16832115, 16790419, 16839200, 16795414, 16820853, 16826112,
+   16827043, 16797250, 16804146, 16788879, 16815021, 16839409, 16809140, 16807135, 16797898, 16807599, 16841024, 16789657, 16813660, 16782161, 16778423, 16811393,
+   16836747, 16819734, 16813016, 16838095, 16802733, 16799893, 16842040, 16794731, 16798822, 16810364, 16824862, 16808704, 16810940, 16782494, 16821307, 16777835,
+   16816128, 16822883, 16800895, 16827943, 16787511, 16821449, 16788420, 16825482, 16826850, 16825010, 16804148, 16821293, 16798786, 16830584, 16785798, 16836929,
+   16783533, 16827944, 16783785, 16777856, 16785318, 16840960, 16808739, 16829308, 16837562, 16810967, 16812888, 16783823, 16800698, 16811234, 16841567, 16806558,
+   16809620, 16779803, 16806706, 16793004, 16785669, 16819030, 16840717, 16792776, 16793855, 16819330, 16799501, 16829937, 16795839, 16801677, 16832686, 16820925,
+   16798860, 16817475, 16799131, 16841226, 16836740, 16820914, 16807379, 16784381, 16801172, 16822887, 16789047, 16813082, 16777471, 16787537, 16792823, 16818246,
+   16810074, 16828173, 16804891, 16779476, 16807716, 16818071, 16828238, 16834962, 16812860, 16787349, 16805190, 16829044, 16827039, 16818534, 16818457, 16812987,
+   16779458, 16791155, 16807563, 16797974, 16802855, 16781161, 16819008, 16807128, 16812370, 16783990, 16799749, 16815941, 16833856, 16823075, 16814295, 16799941,
+   16800496, 16787172, 16804915, 16831774, 16790197, 16822763, 16810151, 16796559, 16840532, 16820870, 16777641, 16784420, 16818044, 16778041, 16820337, 16819506,
+   16840425, 16825452, 16816433, 16832471, 16786139, 16797436, 16814086, 16824071, 16812393, 16797845, 16803482, 16803269, 16780833, 16797264, 16821208, 16831566,
+   16796014, 16791440, 16790011, 16830067, 16800189, 16802049, 16783987, 16784134, 16807681, 16804504, 16823332, 16794022, 16810928, 16797662, 16793754, 16830662,
+   16798126, 16842740, 16840232, 16825425, 16799901, 16818908, 16841739, 16805227, 16793378, 16788626, 16814266, 16796694, 16814849, 16829033, 16791888, 16820864,
+   16812172, 16800854, 16820120, 16782963, 16807549, 16801114, 16831540, 16806616, 16781052, 16807531, 16802319, 16804990, 16831923, 16812093, 16790004, 16818097,
+   16814529, 16793871, 16792690, 16834613, 16833897, 16810935, 16806404, 16810070, 16794128, 16828221, 16786678, 16795297, 16778447, 16809695, 16791573, 16825887,
+   16807180, 16836012, 16816924, 16833502, 16804932, 16797020, 16792113, 16824868, 16823516, 16823955, 16833093, 16816097, 16833359, 16836896, 16778228, 16802973,
+   16810771, 16787429, 16810775, 16785683, 16784282, 16812084, 16812257, 16842270, 16826172, 16793557, 16814179, 16805990, 16818470, 16796273, 16800471, 16831473,
+   16786491, 16781156, 16801959, 16820206, 16790980, 16798875, 16808680, 16806660, 16793894, 16827744, 16790408, 16812355, 16779876, 16808274, 16807451, 16786784,
+   16842579, 16811818, 16810269, 16809418, 16798308, 16799963, 16793498, 16832979, 16831516, 16835329, 16795653, 16832639, 16822886, 16802290, 16784476, 16807802,
+   16842420, 16818270, 16816922, 16777909, 16814167, 16810303, 16802902, 16817496, 16800092, 16797037, 16800110, 16781319, 16824935, 16793376, 16818657, 16813326,
+   16835747, 16824327, 16836923, 16805796, 16789786, 16789845, 16807478, 16787466, 16827015, 16837620, 16785702, 16794322, 16803766, 16777387, 16811010, 16798743,
+   16801328, 16816460, 16805849, 16814016, 16827292, 16816084, 16832776, 16822774, 16806143, 16810077, 16830157, 16795583, 16824240, 16791354, 16806980, 16811141,
+   16809136, 16780658, 16804450, 16792516, 16824619, 16833055, 16835736, 16814444, 16783773, 16812894, 16837924, 16811997, 16791975, 16819342, 16826986, 16835837,
+   16802110, 16831662, 16825837, 16830443, 16810367, 16827047, 16832459, 16798727, 16835531, 16789637, 16803041, 16831859, 16821258, 16827048, 16793720, 16804317,
+   16811534, 16811422, 16777948, 16816731, 16782018, 16820805, 16808697, 16797904, 16783981, 16810482, 16822915, 16790595, 16809019, 16792430, 16793583, 16808525,
+   16789399, 16825063, 16801516, 16797046, 16784793, 16784207, 16835764, 16826414, 16797491, 16819801, 16785159, 16840224, 16824490, 16777708, 16825197, 16810258,
+   16835095, 16834255, 16805311, 16818448, 16779544, 16839463, 16794048, 16793625, 16792433, 16839588, 16798848, 16818121, 16800873, 16790833, 16794187, 16813092,
+   16786711, 16823596, 16797708, 16824605, 16782691, 16842068, 16787681, 16778868, 16821315, 16828769, 16840272, 16783837, 16781077, 16813291, 16802125, 16800523,
+   16830755, 16836210, 16841316, 16804748, 16808857, 16813986, 16791419, 16812790, 16840901, 16815173, 16804210, 16834552, 16803943, 16791566, 16787423, 16822960,
+   16842468, 16821746, 16799525, 16819114, 16801972, 16800303, 16783670, 16819055, 16797152, 16814803, 16819680, 16822174, 16815324, 16801094, 16840892, 16837617,
+   16805628, 16807645, 16826872, 16812587, 16807458, 16835541, 16777616, 16790701, 16823537, 16784357, 16779970, 16816772, 16819023, 16834059, 16828993, 16781425,
+   16782578, 16825523, 16831865, 16777284, 16814472, 16801128, 16837015, 16804107, 16823469, 16828098, 16797022, 16827994, 16795545, 16831455, 16795815, 16784654,
+   16839835, 16797108, 16790188, 16807386, 16816245, 16828964, 16830794, 16799545, 16813967, 16806724, 16778935, 16820123, 16806674, 16779941, 16805538, 16830751,
+   16823232, 16828100, 16802591, 16818700, 16817114, 16838951, 16808253, 16820937, 16795626, 16830275, 16837268, 16841190, 16783022, 16812897, 16810121, 16811604,
+   16797923, 16795337, 16838980, 16840463, 16812830, 16824975, 16813205, 16825866, 16814487, 16823465, 16808397, 16842619, 16839799, 16809474, 16792389, 16796459,
+   16803480, 16801211, 16814799, 16796727, 16812688, 16790398, 16783778, 16825565, 16800649, 16802922, 16786598, 16836860, 16803565, 16837510, 16783133, 16781079,
+   16814446, 16794004, 16836877, 16795335, 16810810, 16797590, 16789569, 16797997, 16807920, 16787117, 16801948, 16819925, 16833725, 16802474, 16802113, 16819768,
+   16828110, 16794015, 16831711, 16834050, 16802826, 16826936, 16796203, 16790571, 16832519, 16805877, 16824052, 16791710, 16814831, 16814349, 16778358, 16814432,
+   16778026, 16800423, 16794683, 16785184, 16782625, 16789893, 16793632, 16831409, 16825988, 16814931, 16796092, 16803933, 16800904, 16811031, 16793491, 16803742,
+   16826717, 16798443, 16829617, 16810219, 16823736, 16811985, 16791506, 16810041, 16820713, 16782855, 16781676, 16820450, 16784800, 16839976, 16780509, 16781141,
+   16815239, 16820997, 16842739, 16830190, 16838767, 16805537, 16836657, 16819237, 16807646, 16821281, 16779064, 16778158, 16813400, 16828591, 16841503, 16789078,
+   16824207, 16837870, 16832575, 16836888, 16820238, 16798172, 16808021, 16810832, 16842365, 16818661, 16780195, 16800285, 16780030, 16799569, 16812669, 16838791,
+   16800096, 16834739, 16826511, 16824460, 16837913, 16788460, 16791092, 16804119, 16784042, 16835835, 16794653, 16825515, 16805325, 16817119, 16797792, 16831395,
+   16833436, 16835607, 16792984, 16813274, 16838416, 16793637, 16828927, 16832594, 16816234, 16789279, 16811582, 16782683, 16841965, 16829360, 16809563, 16827605,
+   16826347, 16840183, 16793948, 16801657, 16795973, 16783655, 16821410, 16800031, 16842508, 16821496, 16819589, 16835132, 16803145, 16789650, 16791614, 16790489,
+   16794558, 16788257, 16820163, 16819396, 16817170, 16834273, 16814274, 16827859, 16827037, 16800894, 16823017, 16814733, 16789901, 16830195, 16787536, 16787817,
+   16800175, 16828758, 16827364, 16808144, 16777933, 16811537, 16805451, 16824474, 16808952, 16841413, 16836788, 16791924, 16808712, 16812800, 16794023, 16827575,
+   16805369, 16837462, 16813227, 16808784, 16833905, 16799137, 16796692, 16794580, 16781047, 16784691, 16833889, 16800853, 16793663, 16841669, 16819061, 16807977,
+   16819079, 16827985, 16804135, 16785931, 16808870, 16794188, 16828826, 16817099, 16839510, 16807431, 16785145, 16827809, 16798231, 16829517, 16797994, 16837417,
+   16780850, 16778166, 16817110, 16812805, 16791974, 16790222, 16804397, 16794490, 16788259, 16798812, 16802460, 16791020, 16842629, 16803323, 16816782, 16812792,
+   16806282, 16815994, 16787453, 16831247, 16791081, 16787125, 16822384, 16817516, 16803732, 16832435, 16784848, 16798570, 16830226, 16795132, 16813337, 16839171,
+   16792428, 16777369, 16833561, 16835794, 16830093, 16836299, 16798828, 16782365, 16842750, 16794816, 16781600, 16837117, 16780420, 16816762, 16812311, 16801184,
+   16799568, 16826419, 16802521, 16826852, 16830402, 16795907, 16801941, 16791055, 16831118, 16812612, 16827419, 16824473, 16802991, 16784296, 16799736, 16793246,
+   16837109, 16791503, 16832797, 16834657, 16825128, 16822844, 16818363, 16803208, 16827641, 16825093, 16808944, 16813379, 16807623, 16802002, 16825624, 16811048,
+   16781593, 16786215, 16839278, 16794566, 16832447, 16831494, 16799683, 16786023, 16815965, 16831719, 16834628, 16796715, 16780876, 16829000, 16800589, 16789487,
+   16811873, 16802944, 16802810, 16797874, 16795895, 16838396, 16823397, 16781284, 16819933, 16823360, 16800680, 16824080, 16828977, 16789168, 16829446, 16786421,
+   16790965, 16816828, 16806316, 16801687, 16806896, 16808598, 16819283, 16833576, 16808155, 16821147, 16837727, 16839339, 16809645, 16800368, 16782248, 16798628,
+   16800585, 16819529, 16829031, 16790044, 16803310, 16779804, 16826417, 16799670, 16818426, 16816352, 16838649, 16805891, 16821675, 16813648, 16778902, 16832241,
+   16795783, 16842296, 16822263, 16800976, 16780858, 16821413, 16816038, 16781910, 16836272, 16803262, 16790547, 16791632, 16838015, 16837282, 16836414, 16813945,
+   16778883, 16809432, 16805598, 16786508, 16783449, 16781558, 16824363, 16799487, 16810193, 16792838, 16803194, 16841854, 16794010, 16816478, 16829260, 16802662,
+   16812383, 16811581, 16814174, 16784368, 16794103, 16815882, 16808958, 16825058, 16811822, 16784988, 16819557, 16809921, 16785780, 16820501, 16817581, 16837482,
+   16786425, 16782463, 16825943, 16825456, 16822402, 16826545, 16811626, 16840166, 16833539, 16815755, 16835680, 16779667, 16821892, 16804207, 16829911, 16817021,
+   16788320, 16804579, 16788426, 16839110, 16835303, 16783454, 16837355, 16779890, 16779495, 16833891, 16826576, 16833120, 16802465, 16815592, 16829215, 16824205,
+   16789700, 16835602, 16814574, 16842435, 16800898, 16809464, 16784407, 16809065, 16785284, 16805310, 16816680, 16778002, 16799762, 16800830, 16815237, 16800109,
+   16790479, 16825011, 16794774, 16781668, 16832537, 16806361, 16838246, 16805848, 16808089, 16836161, 16816500, 16781188, 16788496, 16786961, 16840176, 16817178,
+   16800351, 16801821, 16790695, 16796051, 16831936, 16810687, 16801271, 16841121, 16816626, 16811320, 16796243, 16812222, 16828705, 16813020, 16814923, 16813074,
+   16812500, 16834409, 16815702, 16832900, 16818500, 16785325, 16814990, 16830506, 16779761, 16813120, 16793793, 16813641, 16790650, 16790509, 16797032, 16829433,
+   16806047, 16819560, 16791810, 16807242, 16812552, 16788018, 16801798, 16809981, 16783162, 16792916, 16800625, 16801838, 16801381, 16789075, 16818623, 16781323,
+   16833465, 16780389, 16784651, 16822024, 16801873, 16801163, 16812177, 16794515, 16784166, 16818475, 16836734, 16803754, 16834110, 16840060, 16806688, 16838261,
+   16810072, 16782402, 16816232, 16816552, 16839566, 16830979, 16784081, 16829767, 16824983, 16784886, 16802401, 16829763, 16825554, 16781684, 16835107, 16791333,
+   16837887, 16788928, 16820189, 16795888, 16841994, 16822945, 16812934, 16829688, 16818515, 16817071, 16825332, 16805870, 16825935, 16817249, 16829801, 16784210,
+   16809814, 16813616, 16779564, 16833435, 16790214, 16822779, 16783310, 16831109, 16804713, 16786519, 16788772, 16832204, 16808450, 16839920, 16782338, 16799431,
+   16819148, 16830367, 16835495, 16823111, 16835260, 16795857, 16812038, 16783496, 16798286, 16806640, 16785640, 16809845, 16795629, 16780443, 16816605, 16810119,
+   16822856, 16801621, 16838743, 16834904, 16795681, 16813802, 16800586, 16798772, 16777766, 16816786, 16837491, 16822584, 16816892, 16778986, 16840287, 16778551,
+   16842259, 16792995, 16795531, 16816577, 16781310, 16823641, 16784229, 16794363, 16803512, 16841263, 16804727, 16830603, 16779342, 16829874, 16808876, 16785024,
+   16783970, 16830045, 16840038, 16788490, 16806856, 16790361, 16788952, 16837760, 16824471, 16779286, 16799040, 16819952, 16804474, 16798797, 16820381, 16807251,
+   16814024, 16794120, 16832088, 16788854, 16812988, 16799190, 16813797, 16791980, 16823920, 16841818, 16818410, 16793628, 16788258, 16825897, 16787998, 16808290,
+   16834211, 16829352, 16807213, 16801882, 16806080, 16778398, 16784885, 16785854, 16802768, 16778444, 16783343, 16779909, 16813879, 16836981, 16826581, 16822407,
+   16780128, 16794806, 16815358, 16787043, 16792526, 16781661, 16788599, 16786464, 16815194, 16797265, 16807301, 16809990, 16807195, 16790098, 16794025, 16838558,
+   16790653, 16791410, 16780668, 16826809, 16794547, 16837499, 16778380, 16781354, 16782243, 16793009, 16782475, 16789668, 16787838, 16829431, 16815177, 16822032,
+   16785261, 16822107, 16788457, 16817562, 16837960, 16797387, 16789369, 16836056, 16817916, 16807480, 16788087, 16829342, 16806475, 16827496, 16804582, 16809148,
+   16785736, 16832450, 16778109, 16801782, 16820565, 16821866, 16835693, 16836906, 16830272, 16790624, 16778800, 16815513, 16797163, 16833283, 16842466, 16778810,
+   16785521, 16836389, 16795970, 16778059, 16785707, 16829582, 16817875, 16821606, 16823049, 16786512, 16838010, 16836978, 16841324, 16824924, 16796261, 16789338,
+   16827455, 16804640, 16839501, 16804633, 16786099, 16841178, 16780063, 16814392, 16785744, 16810909, 16816215, 16779052, 16779846, 16838355, 16804459, 16781532,
+   16838168, 16817948, 16801569, 16782268, 16788759, 16796397, 16828117, 16819390, 16788386, 16812868, 16820253, 16783679, 16834119, 16785607, 16818647, 16841403,
+   16777615, 16839084, 16791211, 16819910, 16832943, 16811673, 16813077, 16828978, 16800676, 16791847, 16830230, 16792520, 16807685, 16805609, 16807887, 16815094,
+   16839630, 16791769, 16813502, 16788001, 16831699, 16826557, 16836761, 16831441, 16795757, 16811538, 16829577, 16787162, 16834309, 16810528, 16794717, 16835542,
+   16801672, 16783265, 16808805, 16809848, 16824182, 16779897, 16806056, 16786014, 16790404, 16815656, 16793928, 16792774, 16789596, 16817672, 16813678, 16797114,
+   16811229, 16825723, 16806619, 16834407, 16795365, 16804718, 16831649, 16808077, 16830623, 16830977, 16828772, 16833845, 16789849, 16804053, 16783354, 16811362,
+   16825083, 16811232, 16777907, 16827286, 16783464, 16778955, 16842262, 16785557, 16814545, 16795631, 16814745, 16834283, 16803690, 16823919, 16831068, 16824360,
+   16838000, 16784566, 16824963, 16837431, 16812191, 16841785, 16809998, 16786384, 16812060, 16842507, 16810413, 16795881, 16796647, 16832364, 16819192, 16832977,
+   16786599, 16798046, 16815098, 16803133, 16829122, 16834189, 16805393, 16834491, 16777745, 16820692, 16782184, 16801149, 16785705, 16786354, 16829167, 16798029,
+   16802068, 16814107, 16790331, 16837376, 16839988, 16798401, 16789350, 16794688, 16783040, 16831180, 16779716, 16794984, 16801870, 16816852, 16834846, 16839841,
+   16817485, 16818995, 16836208, 16810210, 16825616, 16811653, 16784057, 16784931, 16788761, 16783378, 16813567, 16840744, 16803937, 16837713, 16797137, 16831243,
+   16784602, 16798665, 16791682, 16842438, 16830719, 16832470, 16833108, 16780948, 16827185, 16799042, 16815054, 16810062, 16822425, 16778478, 16812173, 16808015,
+   16812901, 16832040, 16779178, 16797182, 16838647, 16816649, 16822491, 16837075, 16831277, 16835076, 16787913, 16816826, 16782128, 16839869, 16821054, 16831628,
+   16803308, 16778615, 16793784, 16808783, 16836420, 16827974, 16837790, 16791297, 16835789, 16814738, 16805703, 16836955, 16836096, 16838323, 16801067, 16828439,
+   16810266, 16832846, 16789509, 16788414, 16785386, 16837446, 16831771, 16819697, 16790024, 16823883, 16792010, 16832351, 16840361, 16795484, 16795710, 16832487,
+   16838206, 16791351, 16828104, 16787990, 16800005, 16838526, 16839253, 16813017, 16836141, 16833142, 16837175, 16784345, 16806731, 16833545, 16800874, 16811532,
+   16828264, 16829860, 16790929, 16804255, 16794511, 16816220, 16785265, 16777899, 16811363, 16831339, 16839798, 16821291, 16781106, 16811719, 16790968, 16821640,
+   16829241, 16781132, 16832491, 16830916, 16793032, 16796825, 16783241, 16784830, 16830591, 16841869, 16842696, 16811583, 16828041, 16804904, 16806439, 16818371,
+   16793545, 16800081, 16816036, 16778769, 16802909, 16781189, 16821108, 16788629, 16781750, 16790803, 16818366, 16795627, 16783240, 16831982, 16810727, 16781490,
+   16802575, 16841838, 16803414, 16794393, 16784427, 16799661, 16830366, 16818617, 16828550, 16822217, 16781424, 16791579, 16808771, 16789313, 16824486, 16820649,
+   16811845, 16787416, 16835661, 16787052, 16784372, 16792709, 16798804, 16782980, 16820227, 16839967, 16802534, 16822760, 16839217, 16811996, 16793076, 16827498,
+   16840172, 16780185, 16840749, 16811720, 16822461, 16813560, 16809122, 16796290, 16779841, 16818775, 16785790, 16813097, 16817837, 16782144, 16830744, 16837534,
+   16780863, 16790162, 16837855, 16802984, 16784874, 16822869, 16818321, 16789566, 16780381, 16798830, 16788135, 16813661, 16777578, 16792885, 16778611, 16825915,
+   16806320, 16797815, 16824661, 16805135, 16791357, 16810617, 16783950, 16805723, 16810950, 16777371, 16815144, 16794842, 16830079, 16831047, 16815919, 16816860,
+   16807721, 16809138, 16823243, 16810840, 16808799, 16786306, 16823514, 16834274, 16812809, 16809740, 16806955, 16839685, 16840714, 16812378, 16827536, 16784649,
+   16791278, 16783008, 16808856, 16812008, 16794759, 16801110, 16838875, 16828419, 16836182, 16787297, 16807673, 16842053, 16828079, 16788302, 16795836, 16800051,
+   16788223, 16836459, 16810920, 16818646, 16825974, 16794226, 16792262, 16782798, 16841645, 16786108, 16825445, 16815579, 16811786, 16806445, 16819945, 16795456,
+   16783386, 16824756, 16800825, 16785279, 16814553, 16838448, 16835793, 16831043, 16814668, 16779675, 16806319, 16821327, 16824485, 16815654, 16800386, 16816493,
+   16830328, 16841134, 16804827, 16796673, 16799819, 16795530, 16838684, 16838886, 16836201, 16835892, 16811555, 16778461, 16784062, 16781420, 16803710, 16821305,
+   16830553, 16798766, 16812208, 16800727, 16821937, 16807527, 16798919, 16836469, 16804455, 16818580, 16795915, 16823804, 16828586, 16807034, 16780382, 16794973,
+   16801769, 16795992, 16835464, 16793506, 16811628, 16819480, 16813114, 16782188, 16839248, 16833741, 16840249, 16807247, 16828896, 16826975, 16838695, 16834087},
+  {16830492, 16790854, 16793287, 16779364, 16794191, 16821828, 16832032, 16832875, 16789404, 16811798, 16832554, 16779963, 16805124, 16814650, 16834600, 16830138,
+   16785449, 16832426, 16818152, 16818562, 16807969, 16791703, 16841680, 16792282, 16811530, 16780760, 16811321, 16838134, 16817151, 16783934, 16813913, 16818762,
+   16821797, 16814624, 16834372, 16815760, 16791470, 16838836, 16804192, 16829971, 16816587, 16787176, 16807579, 16819967, 16783467, 16812026, 16815542, 16825270,
+   16815332, 16784774, 16792506, 16793038, 16828826, 16802106, 16817608, 16816212, 16805799, 16796175, 16785528, 16781264, 16834267, 16781302, 16827552, 16811201,
+   16780774, 16794304, 16819485, 16803762, 16797511, 16799821, 16785840, 16799439, 16793282, 16806077, 16828329, 16787309, 16835677, 16837726, 16817129, 16783646,
+   16794484, 16786466, 16787191, 16807184, 16839493, 16832719, 16800720, 16819160, 16796756, 16801124, 16797231, 16779885, 16806592, 16798007, 16788755, 16779663,
+   16838285, 16836186, 16777318, 16782435, 16796249, 16784687, 16823180, 16793424, 16803484, 16813121, 16795981, 16805132, 16838104, 16777333, 16791513, 16832116,
+   16835411, 16832494, 16810604, 16803007, 16791198, 16791998, 16809454, 16777747, 16782786, 16787285, 16821069, 16812312, 16827227, 16781546, 16801665, 16780557,
+   16812280, 16839751, 16808498, 16791772, 16825396, 16837451, 16781927, 16822776, 16817000, 16787328, 16837691, 16816020, 16814676, 16810140, 16795035, 16808869,
+   16786994, 16839853, 16835649, 16816206, 16815919, 16815709, 16795881, 16798315, 16823135, 16824565, 16794091, 16811048, 16781576, 16783419, 16841118, 16786106,
+   16832238, 16797919, 16815502, 16802485, 16831923, 16822644, 16799807, 16818090, 16797706, 16836209, 16814848, 16832804, 16805571, 16802112, 16777438, 16834922,
+   16842135, 16809501, 16804928, 16824471, 16822341, 16817355, 16833234, 16813624, 16816733, 16842695, 16815554, 16821917, 16796833, 16806428, 16813567, 16804729,
+   16811436, 16820879, 16797708, 16842421, 16779400, 16813917, 16791722, 16826701, 16809690, 16810474, 16831730, 16809212, 16810872, 16784007, 16838295, 16837801,
+   16795091, 16790099, 16786315, 16794088, 16789249, 16827256, 16816734, 16780593, 16820864, 16795921, 16809190, 16807894, 16804321, 16781449, 16831833, 16831616,
+   16790895, 16838210, 16816646, 16777878, 16805572, 16802826, 16794237, 16841931, 16788094, 16816606, 16780661, 16838906, 16832053, 16824172, 16823918, 16823636,
+   16833103, 16802210, 16785465, 16830275, 16807873, 16826988, 16836607, 16802670, 16779428, 16817099, 16791205, 16811541, 16820151, 16827279, 16802522, 16821215,
+   16836439, 16842079, 16841690, 16788672, 16783843, 16828606, 16811598, 16789540, 16790109, 16838983, 16833735, 16807366, 16807344, 16808896, 16792275, 16808926,
+   16831210, 16810075, 16827510, 16805849, 16821230, 16820522, 16808165, 16814250, 16799401, 16823143, 16815965, 16779783, 16841537, 16829621, 16822001, 16804360,
+   16811417, 16836680, 16787587, 16813950, 16805275, 16812730, 16813040, 16794644, 16784856, 16830862, 16802406, 16834853, 16826868, 16801266, 16829322, 16790086,
+   16810188, 16807901, 16826401, 16832066, 16834599, 16803921, 16824979, 16838573, 16805767, 16782306, 16780299, 16799562, 16824681, 16821062, 16826861, 16840495,
+   16795404, 16796839, 16830865, 16785693, 16798562, 16821743, 16816643, 16784758, 16786147, 16835858, 16833627, 16806030, 16828640, 16822433, 16831099, 16808285,
+   16833512, 16792485, 16779519, 16794397, 16828103, 16815060, 16803722, 16820047, 16800077, 16833628, 16797181, 16838273, 16810806, 16794453, 16799063, 16797819,
+   16833634, 16805152, 16826144, 16842519, 16836330, 16819409, 16821821, 16801253, 16832715, 16796625, 16782166, 16822868, 16798419, 16830648, 16795210, 16839803,
+   16800357, 16835816, 16777501, 16780765, 16785258, 16822918, 16783115, 16778162, 16791881, 16790442, 16834862, 16797780, 16806559, 16819764, 16828965, 16805062,
+   16796969, 16810465, 16835416, 16812495, 16829874, 16830845, 16836219, 16782405, 16807292, 16839657, 16842175, 16793988, 16779149, 16794925, 16781240, 16842261,
+   16800926, 16784068, 16783940, 16798317, 16803025, 16796846, 16838818, 16795842, 16787143, 16783632, 16828898, 16813477, 16817302, 16798830, 16811172, 16839669,
+   16834086, 16778727, 16817292, 16793874, 16781788, 16799056, 16811300, 16817942, 16833069, 16836311, 16797920, 16811960, 16833390, 16796895, 16814525, 16840490,
+   16821738, 16818282, 16825107, 16824974, 16831340, 16785372, 16822721, 16830175, 16832211, 16783034, 16789678, 16794685, 16803256, 16837694, 16840658, 16832229,
+   16829012, 16822413, 16808705, 16814519, 16781438, 16808521, 16800972, 16827374, 16815756, 16796792, 16825147, 16778778, 16810713, 16818766, 16816675, 16810958,
+   16792982, 16814401, 16836427, 16835621, 16817989, 16786502, 16793689, 16837782, 16818927, 16836926, 16823356, 16836148, 16833159, 16784459, 16781417, 16806922,
+   16778069, 16785358, 16807364, 16787023, 16840775, 16838916, 16788179, 16812704, 16819424, 16801520, 16797872, 16833286, 16815957, 16788371, 16792507, 16789266,
+   16806403, 16794606, 16790565, 16790292, 16822212, 16814359, 16783672, 16816775, 16815984, 16782326, 16822074, 16786048, 16831296, 16798361, 16786010, 16805838,
+   16841062, 16816965, 16814428, 16831283, 16797025, 16804105, 16823083, 16788955, 16806330, 16842257, 16822859, 16808862, 16830359, 16825679, 16815258, 16834737,
+   16782534, 16805106, 16834548, 16791662, 16809739, 16809972, 16819574, 16809055, 16781283, 16812015, 16793736, 16824302, 16821886, 16816211, 16841791, 16835787,
+   16790286, 16777898, 16783613, 16826408, 16805198, 16824803, 16785872, 16811814, 16842647, 16789794, 16829649, 16836747, 16832848, 16827275, 16791763, 16821877,
+   16820943, 16826909, 16783874, 16824802, 16785769, 16796617, 16802138, 16801864, 16777294, 16783558, 16787599, 16820319, 16791234, 16812192, 16820383, 16838629,
+   16782846, 16830135, 16831228, 16797993, 16807120, 16829757, 16838231, 16778701, 16832630, 16836742, 16838597, 16777770, 16832115, 16804458, 16781539, 16819058,
+   16817632, 16809852, 16842127, 16839579, 16797957, 16784629, 16841237, 16828192, 16819438, 16802357, 16808781, 16800516, 16783959, 16811421, 16815305, 16834482,
+   16797784, 16839817, 16800698, 16797782, 16815107, 16809711, 16794105, 16829294, 16838083, 16788757, 16827190, 16803901, 16791177, 16815526, 16835067, 16819435,
+   16790843, 16841549, 16799195, 16831984, 16818556, 16817039, 16805051, 16787809, 16811420, 16836627, 16812416, 16795010, 16785144, 16799587, 16787445, 16835227,
+   16798484, 16784258, 16820827, 16779832, 16779795, 16785251, 16788602, 16828913, 16802642, 16841780, 16786034, 16801979, 16834986, 16829207, 16778634, 16831510,
+   16792950, 16806423, 16822289, 16788175, 16827898, 16838550, 16783977, 16807931, 16833580, 16825965, 16814286, 16793754, 16780202, 16798020, 16838084, 16797008,
+   16789688, 16794280, 16800454, 16786912, 16791186, 16798088, 16814899, 16815196, 16840041, 16789505, 16814952, 16829527, 16827135, 16838810, 16826622, 16814089,
+   16805613, 16817726, 16827236, 16814714, 16797704, 16821428, 16780893, 16831427, 16806352, 16798200, 16807723, 16819475, 16794029, 16792253, 16826886, 16803427,
+   16794076, 16779718, 16817602, 16778210, 16780313, 16818239, 16786260, 16835010, 16807476, 16803822, 16777513, 16799849, 16829789, 16832714, 16790428, 16791822,
+   16808996, 16780074, 16815678, 16781474, 16803035, 16792362, 16816804, 16817932, 16840431, 16835047, 16827436, 16834360, 16798969, 16828134, 16822326, 16821998,
+   16784158, 16801134, 16836928, 16819283, 16840485, 16783416, 16834255, 16828481, 16827421, 16804945, 16828276, 16818384, 16824978, 16803454, 16806562, 16819881,
+   16803327, 16825463, 16813336, 16796080, 16785122, 16781419, 16814654, 16784278, 16779808, 16824180, 16783111, 16810488, 16839342, 16834123, 16825930, 16833818,
+   16801203, 16795203, 16790135, 16829545, 16800211, 16813478, 16799435, 16797458, 16841767, 16812858, 16783471, 16818559, 16809798, 16805916, 16795512, 16814466,
+   16808317, 16828688, 16838947, 16811058, 16831019, 16814028, 16787195, 16799633, 16840457, 16779007, 16813568, 16784724, 16813592, 16792469, 16839349, 16814611,
+   16799572, 16836290, 16829362, 16804246, 16816049, 16827619, 16804408, 16840605, 16815051, 16806595, 16802510, 16803237, 16805922, 16787838, 16790976, 16800078,
+   16803541, 16841067, 16831839, 16831447, 16814918, 16842654, 16825312, 16818241, 16817290, 16796018, 16805762, 16809371, 16811915, 16819585, 16822097, 16794696,
+   16825527, 16808671, 16827088, 16831390, 16836696, 16801002, 16803329, 16834042, 16827346, 16788127, 16789536, 16782817, 16819738, 16811531, 16787673, 16827097,
+   16797482, 16807812, 16837584, 16801832, 16828748, 16807831, 16804252, 16784355, 16792714, 16828892, 16815262, 16810771, 16815190, 16810696, 16811219, 16778224,
+   16837566, 16833254, 16821185, 16830963, 16811037, 16813670, 16823916, 16808657, 16798563, 16794924, 16812634, 16793869, 16822262, 16838745, 16822707, 16787893,
+   16825326, 16812088, 16820588, 16829741, 16801202, 16841006, 16788315, 16805561, 16842337, 16793207, 16798380, 16789765, 16829940, 16798180, 16837454, 16785989,
+   16837663, 16815987, 16830867, 16786222, 16780834, 16777916, 16777666, 16778900, 16803613, 16822603, 16821357, 16792428, 16826242, 16778904, 16782324, 16819610,
+   16828315, 16805682, 16803432, 16807717, 16814817, 16834170, 16828863, 16840975, 16807389, 16822936, 16780008, 16801172, 16790457, 16787390, 16833108, 16782570,
+   16813219, 16808563, 16842750, 16823000, 16838070, 16829977, 16832470, 16821368, 16788311, 16841964, 16780766, 16804249, 16808590, 16832435, 16827306, 16833391,
+   16816319, 16829317, 16808853, 16811864, 16811525, 16783384, 16799355, 16787059, 16830679, 16840779, 16824906, 16788196, 16824113, 16810459, 16831095, 16813470,
+   16813901, 16791635, 16839413, 16795663, 16796101, 16782144, 16785287, 16783132, 16785417, 16807405, 16812127, 16796436, 16784969, 16832388, 16794546, 16784168,
+   16795303, 16792617, 16779372, 16809763, 16812403, 16835346, 16810992, 16788069, 16811999, 16830551, 16807818, 16780759, 16842729, 16798760, 16824078, 16786488,
+   16826608, 16812883, 16783706, 16783913, 16836007, 16829219, 16800033, 16820216, 16809447, 16836677, 16826914, 16825423, 16821947, 16780704, 16821367, 16838442,
+   16810191, 16817448, 16826945, 16802404, 16827412, 16823414, 16785152, 16832161, 16815913, 16794201, 16820029, 16840984, 16815008, 16811257, 16833691, 16784836,
+   16826757, 16834655, 16793254, 16831319, 16827479, 16812286, 16819781, 16838011, 16797938, 16791647, 16784568, 16820295, 16779669, 16791297, 16796603, 16812792,
+   16778710, 16827646, 16807007, 16783938, 16808106, 16807424, 16799179, 16819820, 16777794, 16799184, 16778266, 16807966, 16828685, 16834802, 16795543, 16797141,
+   16777673, 16822412, 16789972, 16788967, 16817741, 16786761, 16831315, 16819343, 16797757, 16798387, 16805099, 16779024, 16841712, 16823986, 16823119, 16826545,
+   16802035, 16836501, 16820610, 16781232, 16806720, 16782241, 16784063, 16827621, 16780700, 16806307, 16792132, 16835429, 16780441, 16814224, 16807037, 16835505,
+   16836008, 16782993, 16797009, 16800293, 16824095, 16803668, 16800021, 16802496, 16814474, 16832423, 16784501, 16837293, 16789163, 16810555, 16801829, 16831413,
+   16785348, 16796899, 16782238, 16811623, 16787174, 16825121, 16823128, 16827854, 16787860, 16778272, 16796432, 16794259, 16835789, 16786829, 16827534, 16827690,
+   16811361, 16793258, 16778489, 16837737, 16781785, 16787736, 16792613, 16788346, 16778827, 16819138, 16808783, 16784080, 16790835, 16810164, 16819752, 16839159,
+   16785140, 16819517, 16806326, 16837709, 16820844, 16784431, 16837904, 16834070, 16791346, 16813874, 16794039, 16842712, 16827928, 16835041, 16808353, 16796361,
+   16798630, 16801239, 16810091, 16781178, 16810948, 16813114, 16811879, 16778684, 16832203, 16820563, 16819487, 16779655, 16815741, 16794877, 16821442, 16790624,
+   16815101, 16781458, 16823930, 16801775, 16826286, 16833945, 16806375, 16837570, 16783307, 16790553, 16833101, 16826125, 16809915, 16835105, 16792632, 16794865,
+   16812366, 16801441, 16828360, 16782633, 16801297, 16780154, 16785928, 16781694, 16831075, 16780797, 16823751, 16808462, 16828694, 16803490, 16804965, 16825406,
+   16832191, 16818437, 16823818, 16797545, 16811047, 16840432, 16779852, 16782835, 16805783, 16796820, 16781508, 16808951, 16819015, 16803919, 16825142, 16784857,
+   16838068, 16790687, 16827705, 16805847, 16842723, 16783979, 16783266, 16822956, 16778106, 16835043, 16779366, 16827195, 16814911, 16781059, 16792825, 16784847,
+   16787393, 16831772, 16809855, 16808634, 16834131, 16808631, 16787381, 16815930, 16803347, 16831770, 16827550, 16832791, 16812813, 16836764, 16804358, 16782604,
+   16821945, 16793537, 16805112, 16804914, 16784594, 16809640, 16828743, 16795115, 16836731, 16836914, 16815340, 16834412, 16779731, 16826453, 16822911, 16805794,
+   16812455, 16799517, 16800469, 16793589, 16787146, 16781307, 16831268, 16806961, 16815129, 16821573, 16842734, 16812224, 16834714, 16824087, 16792047, 16781559,
+   16788785, 16784976, 16808715, 16804214, 16789027, 16785292, 16811179, 16840338, 16803570, 16831611, 16792500, 16779337, 16826367, 16807924, 16835206, 16790111,
+   16797165, 16784538, 16805578, 16797846, 16794589, 16816872, 16820317, 16802709, 16838874, 16803702, 16805761, 16818667, 16780666, 16829853, 16791857, 16790008,
+   16810319, 16827984, 16805579, 16809877, 16782244, 16804604, 16835525, 16819021, 16786411, 16778164, 16833572, 16806623, 16821538, 16836040, 16801344, 16836942,
+   16805466, 16790514, 16841590, 16826273, 16817220, 16836925, 16793998, 16791135, 16793363, 16804821, 16840834, 16842523, 16818076, 16780130, 16822718, 16826704,
+   16777748, 16801123, 16824869, 16810743, 16811838, 16840814, 16842208, 16784624, 16826375, 16785475, 16777576, 16828007, 16803770, 16780448, 16842617, 16786181,
+   16806018, 16781485, 16781445, 16805252, 16780367, 16813802, 16777511, 16840944, 16837868, 16840624, 16786514, 16824775, 16837599, 16815370, 16782471, 16823193,
+   16809402, 16823715, 16777464, 16813322, 16812753, 16779498, 16838159, 16779217, 16829367, 16784321, 16803670, 16782085, 16815538, 16821631, 16785227, 16814079,
+   16792628, 16806644, 16794837, 16795514, 16838787, 16782469, 16800008, 16803162, 16842153, 16795938, 16829947, 16802732, 16823970, 16803476, 16783657, 16812909,
+   16833287, 16803927, 16836673, 16830274, 16824377, 16780651, 16839224, 16828462, 16841045, 16833831, 16799330, 16813125, 16789107, 16807114, 16799707, 16795792,
+   16801547, 16792823, 16778833, 16813716, 16811379, 16801542, 16779565, 16837407, 16778817, 16811991, 16780953, 16812727, 16805513, 16789097, 16801106, 16827173,
+   16835854, 16822128, 16793037, 16781303, 16781899, 16815007, 16779004, 16786641, 16781881, 16818098, 16805766, 16810367, 16813695, 16813734, 16822792, 16840487,
+   16835586, 16812910, 16814939, 16818665, 16793512, 16797683, 16789159, 16804075, 16791267, 16819700, 16827112, 16822527, 16788415, 16839857, 16818413, 16793345,
+   16792511, 16804936, 16786043, 16820687, 16817261, 16815694, 16808885, 16833193, 16806107, 16799158, 16824134, 16822830, 16799318, 16823525, 16782853, 16794436,
+   16781030, 16795153, 16833643, 16801940, 16806038, 16818519, 16826330, 16826377, 16826961, 16782454, 16828421, 16824696, 16813005, 16830129, 16828446, 16826325,
+   16804848, 16827342, 16808140, 16793794, 16825828, 16785702, 16810944, 16815549, 16831682, 16805219, 16823591, 16778026, 16787003, 16834178, 16819872, 16833714,
+   16814693, 16824197, 16827945, 16779151, 16796291, 16800273, 16825884, 16814254, 16805781, 16797554, 16820754, 16828878, 16791092, 16831077, 16785117, 16807211,
+   16788097, 16778441, 16812287, 16827180, 16801192, 16820958, 16786903, 16829157, 16804923, 16806859, 16801145, 16779421, 16814505, 16798894, 16781963, 16803826,
+   16822196, 16820229, 16813124, 16826057, 16809126, 16807610, 16804884, 16789306, 16820380, 16814334, 16816086, 16809060, 16816501, 16795211, 16788910, 16821733,
+   16834572, 16828373, 16829705, 16791637, 16842514, 16803608, 16778220, 16799229, 16780465, 16821380, 16822448, 16805785, 16798989, 16788739, 16814059, 16793146,
+   16780833, 16800141, 16814527, 16824778, 16833314, 16842526, 16794841, 16781006, 16784951, 16803054, 16781704, 16813795, 16817068, 16801897, 16829689, 16792992,
+   16809668, 16812258, 16779472, 16788295, 16833366, 16817159, 16800238, 16795102, 16841389, 16832945, 16806364, 16804769, 16795196, 16814908, 16828251, 16816093,
+   16839892, 16832219, 16831289, 16782357, 16781620, 16786886, 16799009, 16808855, 16808708, 16795992, 16814993, 16840867, 16797971, 16835909, 16829443, 16814095,
+   16785324, 16801147, 16799234, 16778280, 16835593, 16796519, 16799966, 16781446, 16805176, 16831805, 16839574, 16803588, 16822487, 16796666, 16823245, 16818825,
+   16793012, 16802025, 16804124, 16788914, 16786810, 16787777, 16810481, 16779116, 16810794, 16802430, 16798632, 16836821, 16792803, 16778349, 16798186, 16805867,
+   16822809, 16838694, 16823166, 16780183, 16800570, 16831230, 16785455, 16830713, 16828775, 16778661, 16824354, 16777998, 16808692, 16807955, 16831580, 16839758,
+   16801714, 16807942, 16824207, 16784784, 16809242, 16788985, 16842174, 16833925, 16828728, 16787105, 16809546, 16835974, 16823551, 16807501, 16815743, 16838119,
+   16839572, 16811451, 16829800, 16789434, 16797790, 16820519, 16781125, 16828409, 16838933, 16807547, 16842573, 16842525, 16841450, 16824838, 16836798, 16800821,
+   16791504, 16821659, 16840038, 16835551, 16805321, 16829391, 16822432, 16808031, 16790587, 16823540, 16817249, 16799968, 16786585, 16816353, 16780359, 16780503,
+   16817954, 16792491, 16779305, 16802098, 16833588, 16824871, 16812800, 16817407, 16811290, 16797668, 16789195, 16791388, 16809076, 16781045, 16821858, 16810285,
+   16799498, 16792972, 16785132, 16805573, 16832421, 16802712, 16807897, 16820348, 16799456, 16806637, 16791830, 16795713, 16780201, 16777944, 16833943, 16842592,
+   16829145, 16798968, 16797702, 16836568, 16842641, 16826894, 16830872, 16804093, 16840652, 16803711, 16831262, 16786973, 16832755, 16811448, 16800358, 16820011,
+   16836956, 16823711, 16798762, 16818587, 16792770, 16825294, 16816629, 16834590, 16788931, 16834306, 16796622, 16814659, 16807180, 16835095, 16817053, 16786786,
+   16828313, 16781749, 16819765, 16783907, 16818942, 16798017, 16812639, 16829929, 16803155, 16794019, 16811491, 16823500, 16821137, 16824972, 16786590, 16827644,
+   16827572, 16814063, 16778969, 16796740, 16826513, 16788443, 16812268, 16808768, 16788442, 16828042, 16793610, 16834139, 16784787, 16816237, 16796286, 16788450,
+   16831309, 16809772, 16791024, 16841468, 16781993, 16808021, 16827266, 16777694, 16793343, 16782183, 16812124, 16783217, 16838293, 16811121, 16838438, 16804699,
+   16805102, 16829233, 16840946, 16804708, 16829599, 16809409, 16823249, 16796120, 16839527, 16840274, 16804774, 16827270, 16825761, 16829918, 16828764, 16818568,
+   16811622, 16825262, 16792284, 16809342, 16824956, 16804306, 16838314, 16811862, 16788298, 16792845, 16830339, 16783649, 16808003, 16808413, 16816980, 16789725,
+   16791651, 16828116, 16796311, 16803810, 16802299, 16780595, 16831974, 16818985, 16840796, 16839636, 16816031, 16780365, 16822682, 16788634, 16833246, 16789131,
+   16796709, 16794366, 16842720, 16808935, 16833930, 16780927, 16842467, 16798818, 16829658, 16785017, 16795276, 16821496, 16785106, 16780733, 16823884, 16823949,
+   16786939, 16841439, 16798925, 16811150, 16780118, 16830161, 16811472, 16799484, 16827074, 16788551, 16812404, 16793365, 16822962, 16801661, 16804211, 16796790,
+   16821054, 16783063, 16836804, 16784620, 16836364, 16783095, 16809797, 16802524, 16831116, 16778884, 16812422, 16781227, 16839865, 16816764, 16828131, 16818646,
+   16813615, 16782965, 16778066, 16790827, 16840654, 16833061, 16785781, 16801738, 16819518, 16796389, 16801821, 16798470, 16782540, 16830003, 16804291, 16780690,
+   16835060, 16781891, 16834630, 16781575, 16839766, 16840488, 16806228, 16829581, 16817910, 16792294, 16828385, 16831740, 16804641, 16787488, 16810725, 16802636,
+   16807410, 16828684, 16798410, 16791441, 16825623, 16838929, 16802918, 16805543, 16809216, 16839984, 16781420, 16779768, 16792777, 16837102, 16820788, 16805423,
+   16777771, 16814658, 16792118, 16784057, 16780174, 16825348, 16838268, 16782202, 16819577, 16825260, 16826447, 16842037, 16840943, 16789774, 16817967, 16778948,
+   16783441, 16810890, 16795544, 16798432, 16825613, 16808664, 16799277, 16792079, 16821699, 16831333, 16834122, 16816620, 16841960, 16798365, 16804355, 16828979,
+   16788997, 16823840, 16834244, 16822416, 16806180, 16787842, 16807526, 16830376, 16783404, 16787588, 16801868, 16793057, 16789140, 16781556, 16804560, 16789722,
+   16785007, 16802757, 16789964, 16794852, 16782510, 16812594, 16799614, 16813402, 16806490, 16777977, 16835868, 16778327, 16797936, 16837796, 16780638, 16832623,
+   16790678, 16792793, 16787178, 16788887, 16816597, 16798396, 16825745, 16825467, 16831721, 16790485, 16836753, 16808600, 16823041, 16839993, 16794975, 16795920,
+   16838748, 16779920, 16779961, 16803459, 16796525, 16808579, 16808116, 16835254, 16830830, 16831623, 16794365, 16826793, 16841236, 16835674, 16807540, 16829813,
+   16819308, 16778976, 16782572, 16785971, 16807248, 16797992, 16828882, 16837375, 16819064, 16793503, 16833425, 16828654, 16814617, 16807549, 16828998, 16816196,
+   16836644, 16807046, 16840193, 16792716, 16790218, 16830206, 16838345, 16824923, 16806622, 16819025, 16820451, 16820641, 16778434, 16835950, 16793124, 16839416,
+   16779616, 16837253, 16811511, 16833936, 16784166, 16836711, 16830396, 16780775, 16781015, 16842280, 16799733, 16823136, 16833415, 16789407, 16812999, 16803075,
+   16820305, 16810282, 16820127, 16783310, 16780869, 16806060, 16834539, 16800079, 16788725, 16818860, 16792435, 16820260, 16802041, 16827745, 16836884, 16783060,
+   16786769, 16788184, 16804669, 16837354, 16789706, 16842237, 16800096, 16815864, 16805235, 16801929, 16808282, 16821957, 16803739, 16789503, 16820727, 16827683,
+   16778573, 16808459, 16813676, 16832895, 16825317, 16833524, 16808015, 16790117, 16837335, 16839629, 16805424, 16825003, 16811328, 16806465, 16782245, 16812492,
+   16778294, 16802215, 16798158, 16805522, 16832206, 16790540, 16803147, 16811645, 16818530, 16837751, 16812782, 16818373, 16818377, 16840685, 16786251, 16812911,
+   16793575, 16800967, 16790750, 16788244, 16799338, 16813440, 16787953, 16790867, 16817526, 16778131, 16804197, 16823279, 16781884, 16826843, 16802332, 16812952,
+   16787692, 16840408, 16826670, 16787250, 16790201, 16785419, 16835564, 16801463, 16802310, 16809998, 16831590, 16797434, 16842357, 16819528, 16785906, 16791633,
+   16829535, 16811125, 16841856, 16803079, 16836893, 16819178, 16816095, 16784175, 16801499, 16831396, 16838878, 16784921, 16781675, 16823791, 16795393, 16825922,
+   16818186, 16810683, 16820794, 16838913, 16816939, 16787855, 16818438, 16783019, 16791627, 16824430, 16807895, 16794246, 16800015, 16789247, 16783539, 16796254,
+   16831661, 16813287, 16785456, 16807171, 16842407, 16832897, 16832890, 16799380, 16821382, 16830691, 16835475, 16840020, 16828034, 16785690, 16788103, 16790341,
+   16818246, 16834518, 16809024, 16779040, 16805658, 16821274, 16798520, 16777811, 16793188, 16825665, 16801006, 16839293, 16806917, 16788299, 16798026, 16806993,
+   16815732, 16836599, 16807431, 16777404, 16785373, 16842005, 16823574, 16805839, 16826317, 16817002, 16839699, 16788643, 16818110, 16819159, 16790904, 16837753,
+   16829302, 16790290, 16830689, 16830148, 16787420, 16798700, 16799399, 16783457, 16785900, 16799215, 16807841, 16822104, 16784608, 16790313, 16796569, 16815788,
+   16828862, 16799280, 16790676, 16833638, 16805596, 16835599, 16812046, 16804357, 16818871, 16783587, 16825886, 16778296, 16797502, 16838190, 16791466, 16812549,
+   16821468, 16811063, 16794951, 16840209, 16819653, 16820602, 16787967, 16807475, 16794106, 16811860, 16802333, 16779385, 16828307, 16782139, 16787850, 16793079,
+   16807905, 16802842, 16836400, 16811969, 16815881, 16778215, 16824502, 16820725, 16802330, 16793103, 16785243, 16816226, 16827740, 16815892, 16807764, 16811309,
+   16829417, 16777569, 16841721, 16815480, 16808228, 16789604, 16816947, 16817817, 16833438, 16801587, 16839762, 16802303, 16806502, 16819008, 16820643, 16794560,
+   16810100, 16830120, 16807382, 16827132, 16813839, 16803897, 16780846, 16802312, 16782417, 16806164, 16813354, 16841259, 16817428, 16785901, 16834921, 16794203,
+   16795940, 16830354, 16786218, 16805337, 16800644, 16818370, 16801087, 16778112, 16784286, 16812201, 16783784, 16803612, 16780060, 16828485, 16830969, 16798453,
+   16823576, 16799506, 16820102, 16787774, 16779397, 16797142, 16826797, 16825193, 16781135, 16797662, 16818177, 16840121, 16807906, 16809918, 16833059, 16830387,
+   16783687, 16827868, 16783846, 16799172, 16801340, 16823066, 16781958, 16791621, 16831102, 16819695, 16778420, 16809494, 16813681, 16810195, 16792623, 16820321,
+   16815358, 16831958, 16787321, 16794120, 16834466, 16793810, 16822418, 16837564, 16827472, 16801579, 16796292, 16818622, 16817609, 16817892, 16796518, 16809297,
+   16788509, 16837763, 16799696, 16824517, 16824515, 16814341, 16801333, 16815317, 16834502, 16782613, 16841786, 16778105, 16797024, 16824149, 16812585, 16788355,
+   16833732, 16787625, 16819023, 16820724, 16815009, 16789487, 16779117, 16821063, 16820283, 16834101, 16826876, 16830000, 16779391, 16810980, 16799984, 16793175,
+   16793598, 16784860, 16806456, 16786354, 16823323, 16827730, 16789009, 16831005, 16837643, 16800976, 16791370, 16778175, 16825989, 16805562, 16788041, 16811771,
+   16803038, 16788783, 16781957, 16821141, 16785625, 16810378, 16829351, 16830361, 16791311, 16823558, 16790372, 16826906, 16803216, 16785676, 16828821, 16778513,
+   16787158, 16837749, 16794488, 16806436, 16825490, 16820122, 16788817, 16822638, 16832117, 16802902, 16792479, 16792340, 16811734, 16803889, 16811264, 16838894,
+   16777545, 16839956, 16822013, 16788535, 16788964, 16780167, 16789815, 16829295, 16781725, 16781547, 16787946, 16807605, 16820478, 16791789, 16799838, 16811613,
+   16834813, 16819139, 16836819, 16801822, 16826416, 16833566, 16806337, 16818513, 16783293, 16792165, 16780855, 16792865, 16785633, 16781408, 16834855, 16786012,
+   16820947, 16839376, 16810714, 16837725, 16795017, 16833085, 16819032, 16793078, 16786347, 16808393, 16832090, 16798302, 16839548, 16826615, 16842134, 16796769,
+   16825825, 16777882, 16820049, 16831662, 16833244, 16816383, 16838827, 16792194, 16817405, 16812454, 16830418, 16813113, 16809419, 16818220, 16818417, 16838203,
+   16838677, 16832731, 16799691, 16812041, 16834762, 16827831, 16778149, 16813934, 16803758, 16803884, 16789646, 16800715, 16816609, 16815634, 16821590, 16777911,
+   16816310, 16840302, 16825457, 16799608, 16819075, 16780792, 16796239, 16798429, 16795651, 16821036, 16797966, 16836611, 16831342, 16798356, 16807459, 16781734,
+   16806761, 16787690, 16841634, 16825564, 16829966, 16779510, 16783272, 16820937, 16800508, 16836236, 16799483, 16836603, 16805844, 16829426, 16806333, 16830708,
+   16805793, 16822052, 16778438, 16793916, 16827040, 16820579, 16838566, 16783144, 16807117, 16841386, 16825510, 16777978, 16803688, 16819200, 16791694, 16833365,
+   16792219, 16817975, 16816318, 16786332, 16780211, 16784643, 16837263, 16833063, 16820553, 16836725, 16834245, 16777941, 16810517, 16821354, 16782040, 16823280,
+   16808017, 16825711, 16796606, 16834385, 16799281, 16821237, 16816833, 16790588, 16827471, 16812190, 16827982, 16784239, 16836395, 16783027, 16803262, 16832764,
+   16822761, 16795272, 16823841, 16829273, 16795398, 16817491, 16789687, 16799278, 16795545, 16803930, 16827290, 16827497, 16819338, 16831200, 16826625, 16797187,
+   16784000, 16823297, 16823596, 16793010, 16835293, 16842521, 16778337, 16825472, 16789221, 16829268, 16801251, 16807796, 16828835, 16788717, 16801010, 16825460,
+   16811344, 16826620, 16823761, 16804859, 16778873, 16805853, 16806222, 16841325, 16781765, 16806310, 16809325, 16798274, 16779923, 16822892, 16782664, 16786360,
+   16817488, 16781291, 16815824, 16785958, 16831081, 16837650, 16841158, 16805024, 16781667, 16789868, 16828754, 16788976, 16824368, 16780710, 16828471, 16804134,
+   16795858, 16808773, 16834428, 16805169, 16796536, 16837588, 16828264, 16839248, 16801387, 16824230, 16796817, 16814270, 16806540, 16790684, 16811489, 16837270,
+   16834181, 16778104, 16825549, 16826092, 16809652, 16809429, 16785113, 16807445, 16806445, 16830042, 16792655, 16806273, 16807835, 16787926, 16821417, 16822087,
+   16823441, 16793091, 16812530, 16800505, 16800022, 16785719, 16837860, 16803350, 16837896, 16814522, 16782996, 16798335, 16794688, 16808615, 16787142, 16830805,
+   16840593, 16782340, 16790600, 16834289, 16818319, 16835194, 16807300, 16799250, 16790451, 16826822, 16831950, 16829871, 16801035, 16794321, 16784226, 16828783,
+   16795152, 16837221, 16802246, 16791506, 16820841, 16791314, 16831564, 16790434, 16842352, 16799018, 16838498, 16826246, 16806155, 16807934, 16777735, 16822236,
+   16784123, 16787999, 16793263, 16837306, 16804900, 16833228, 16837716, 16801636, 16829835, 16819418, 16785110, 16838160, 16810688, 16780178, 16787973, 16818691,
+   16826085, 16835939, 16836752, 16787129, 16779538, 16834040, 16787460, 16804750, 16802183, 16805648, 16841926, 16836436, 16790703, 16839793, 16802415, 16809516,
+   16787511, 16816826, 16840243, 16797560, 16831613, 16800538, 16808842, 16807437, 16837586, 16797192, 16800223, 16790380, 16835908, 16794873, 16825682, 16797624,
+   16817805, 16798478, 16818275, 16826501, 16800669, 16800429, 16818039, 16831708, 16793783, 16807438, 16783576, 16822310, 16832761, 16815592, 16789941, 16829540,
+   16818976, 16777546, 16808488, 16806722, 16841003, 16823963, 16800658, 16835887, 16815720, 16832345, 16795190, 16842362, 16809621, 16777284, 16811638, 16834545,
+   16794287, 16836988, 16794897, 16783742, 16798057, 16808744, 16799704, 16827632, 16793125, 16803146, 16825660, 16799539, 16800689, 16800540, 16801420, 16806568,
+   16783586, 16797205, 16838189, 16818548, 16798339, 16794759, 16834147, 16824983, 16820517, 16827385, 16813975, 16811007, 16784408, 16810957, 16821871, 16808049,
+   16835252, 16803283, 16786288, 16779332, 16793809, 16805524, 16820892, 16813638, 16793374, 16787063, 16829179, 16800786, 16834675, 16812958, 16839533, 16811694,
+   16840375, 16809014, 16810303, 16807742, 16793399, 16833182, 16818274, 16834378, 16806779, 16814577, 16827442, 16781996, 16826438, 16791010, 16777948, 16781004,
+   16803804, 16802893, 16804732, 16839185, 16831980, 16814897, 16818491, 16842593, 16806376, 16829691, 16834709, 16781222, 16810813, 16807327, 16807515, 16827631,
+   16785717, 16837552, 16804976, 16779445, 16798595, 16821775, 16781507, 16830253, 16830149, 16812418, 16822453, 16826036, 16834492, 16818393, 16829842, 16819934,
+   16797537, 16777769, 16813384, 16837926, 16828051, 16781794, 16809275, 16808878, 16828604, 16782334, 16831104, 16789164, 16801715, 16800908, 16826388, 16826391,
+   16792889, 16822564, 16779733, 16809165, 16796437, 16828846, 16786293, 16789034, 16823351, 16805366, 16837865, 16815230, 16829097, 16785921, 16782100, 16799593,
+   16823090, 16826265, 16790654, 16810740, 16783976, 16824220, 16808821, 16833988, 16807258, 16791088, 16823849, 16798913, 16783801, 16785539, 16800536, 16841999,
+   16832965, 16822022, 16825163, 16836621, 16826203, 16785476, 16812660, 16824975, 16785273, 16796133, 16833953, 16793758, 16829027, 16793516, 16840222, 16791816,
+   16782235, 16778447, 16825427, 16831434, 16825542, 16778808, 16825593, 16840866, 16785558, 16836260, 16802495, 16823520, 16786880, 16782776, 16825224, 16782765,
+   16833327, 16823496, 16804637, 16804081, 16790329, 16831087, 16800329, 16797970, 16787918, 16819527, 16814740, 16811190, 16826582, 16830424, 16781964, 16808483,
+   16834863, 16788552, 16818935, 16842503, 16812979, 16812974, 16830910, 16797414, 16807293, 16806651, 16806405, 16831066, 16829237, 16808999, 16789758, 16837187,
+   16829985, 16787356, 16793214, 16820166, 16795907, 16785031, 16823124, 16833825, 16809826, 16804891, 16839715, 16789528, 16796898, 16835901, 16804981, 16831469,
+   16798932, 16804109, 16804089, 16828435, 16778248, 16806305, 16794432, 16779280, 16812284, 16833066, 16784147, 16840794, 16786483, 16790087, 16784641, 16827930,
+   16793043, 16821097, 16790397, 16801964, 16798624, 16822636, 16801111, 16813375, 16821755, 16829492, 16831815, 16832349, 16803206, 16806327, 16796877, 16807799,
+   16840819, 16834780, 16794642, 16840666, 16799120, 16827544, 16826863, 16795031, 16791086, 16816323, 16785500, 16828517, 16785748, 16837138, 16782825, 16831336,
+   16803483, 16816340, 16816553, 16834133, 16809457, 16794526, 16839551, 16835083, 16833482, 16819519, 16807890, 16813855, 16809745, 16800925, 16817071, 16820187,
+   16803013, 16806881, 16830695, 16797005, 16812011, 16818159, 16796088, 16797999, 16795988, 16797597, 16812277, 16818915, 16798079, 16830632, 16802632, 16779677,
+   16789381, 16831945, 16831381, 16786232, 16798554, 16814570, 16829227, 16783594, 16786608, 16841072, 16787773, 16818873, 16841437, 16796705, 16814069, 16784602,
+   16813296, 16808629, 16824536, 16786793, 16805279, 16793461, 16821318, 16795949, 16818689, 16838953, 16819280, 16833819, 16799777, 16807240, 16824168, 16791329,
+   16841211, 16812095, 16819920, 16832568, 16784367, 16797084, 16819361, 16814990, 16784128, 16777370, 16811792, 16786996, 16810607, 16814267, 16812477, 16830048,
+   16789506, 16830201, 16813411, 16788532, 16838234, 16792408, 16800814, 16827429, 16830771, 16825587, 16798336, 16841228, 16822900, 16780498, 16803984, 16812537,
+   16807578, 16813545, 16788947, 16814900, 16828123, 16798078, 16819996, 16817899, 16791063, 16810434, 16834114, 16839862, 16793139, 16799636, 16825153, 16793509,
+   16831037, 16820362, 16798413, 16793289, 16836965, 16811643, 16807143, 16782517, 16794779, 16780540, 16835904, 16816871, 16798725, 16804809, 16789995, 16788978,
+   16814213, 16816762, 16783789, 16828726, 16833015, 16795808, 16813045, 16800792, 16789355, 16836489, 16779469, 16841263, 16820670, 16802086, 16825148, 16811427,
+   16777743, 16786622, 16814266, 16817641, 16804820, 16810812, 16813698, 16791038, 16824456, 16814784, 16785056, 16809730, 16800045, 16821838, 16790305, 16797138,
+   16796403, 16803226, 16797687, 16807092, 16826607, 16800978, 16825346, 16789873, 16830446, 16827212, 16805990, 16811889, 16796866, 16824008, 16822545, 16808194,
+   16829647, 16784771, 16798112, 16826898, 16813288, 16793750, 16795973, 16781895, 16811729, 16793811, 16837348, 16812714, 16791068, 16792143, 16804755, 16838687,
+   16808576, 16820853, 16788126, 16801127, 16804405, 16839208, 16828845, 16778783, 16777296, 16838705, 16804881, 16804064, 16834817, 16826193, 16821035, 16785577,
+   16826565, 16809965, 16834701, 16793996, 16813951, 16794941, 16801487, 16822730, 16779883, 16789257, 16798640, 16783716, 16832223, 16809264, 16841730, 16778561,
+   16829877, 16785202, 16827045, 16778421, 16810036, 16784463, 16818978, 16782930, 16833068, 16806025, 16818071, 16820740, 16782067, 16805314, 16796269, 16787548,
+   16802958, 16820942, 16825397, 16787341, 16824795, 16833121, 16789813, 16809056, 16825873, 16807432, 16824932, 16815167, 16809904, 16826883, 16818188, 16788078,
+   16803569, 16809549, 16795995, 16782625, 16817781, 16814944, 16781281, 16805067, 16842418, 16800225, 16784073, 16789616, 16810048, 16810254, 16813455, 16790523,
+   16801000, 16838439, 16810238, 16805632, 16791912, 16811611, 16819676, 16794512, 16838163, 16796342, 16828282, 16780558, 16811761, 16836035, 16820410, 16780915,
+   16824236, 16812611, 16802593, 16809746, 16780865, 16796234, 16827733, 16833744, 16789061, 16836176, 16833850, 16799218, 16831608, 16827482, 16798204, 16783868,
+   16778344, 16788356, 16791362, 16780544, 16799650, 16804518, 16842294, 16780290, 16824009, 16783624, 16785790, 16809280, 16838016, 16796814, 16830137, 16835631,
+   16781689, 16806480, 16797510, 16824570, 16778047, 16799028, 16790345, 16781803, 16806121, 16781260, 16826700, 16832404, 16799965, 16833796, 16805111, 16782220,
+   16837521, 16823892, 16783174, 16836381, 16811333, 16816200, 16787095, 16833471, 16815212, 16780930, 16836567, 16791019, 16777921, 16835692, 16835487, 16829287,
+   16797255, 16812919, 16810682, 16782955, 16842356, 16816913, 16832620, 16788028, 16816632, 16813142, 16811770, 16814682, 16827829, 16809644, 16784250, 16824737,
+   16780888, 16830374, 16780047, 16822510, 16826005, 16791888, 16835000, 16838496, 16823403, 16808320, 16829604, 16819202, 16826056, 16788546, 16777775, 16838663,
+   16835702, 16803342, 16786724, 16831866, 16813826, 16806990, 16813949, 16829116, 16813644, 16813632, 16828710, 16816749, 16786495, 16813529, 16796921, 16805863,
+   16785622, 16816290, 16793573, 16824038, 16777252, 16791731, 16794713, 16805775, 16810787, 16788733, 16828909, 16814023, 16782985, 16795740, 16815222, 16802747,
+   16783800, 16782049, 16806444, 16810184, 16820115, 16823996, 16837572, 16813725, 16813526, 16817679, 16795583, 16821260, 16782822, 16813702, 16827139, 16835913,
+   16778619, 16820680, 16832817, 16821756, 16809863, 16829632, 16790650, 16801535, 16836587, 16831442, 16841090, 16797603, 16797549, 16809665, 16789423, 16791228,
+   16800035, 16790751, 16790328, 16813538, 16820185, 16833218, 16804401, 16788908, 16821819, 16789950, 16822338, 16788501, 16788467, 16836442, 16830625, 16803010,
+   16778198, 16836063, 16807075, 16791000, 16841098, 16821290, 16832730, 16801844, 16826241, 16811323, 16785505, 16814869, 16808430, 16816487, 16837044, 16781731,
+   16828059, 16839541, 16814575, 16786887, 16784186, 16811815, 16831250, 16817483, 16822184, 16797478, 16829889, 16829905, 16836336, 16800438, 16792895, 16791972,
+   16840288, 16809034, 16779264, 16782655, 16802580, 16820967, 16780264, 16797540, 16812936, 16803097, 16832322, 16839542, 16825518, 16811390, 16814584, 16794010,
+   16842589, 16807876, 16814601, 16780554, 16803606, 16781756, 16816717, 16799133, 16788719, 16839475, 16795951, 16825573, 16812656, 16813915, 16841560, 16830007,
+   16812172, 16794434, 16783046, 16792069, 16826337, 16800643, 16797312, 16801045, 16816184, 16815401, 16832113, 16829066, 16820199, 16781245, 16804012, 16831451,
+   16817573, 16810158, 16814578, 16794053, 16812305, 16825318, 16828453, 16815240, 16806950, 16837531, 16778966, 16810838, 16802773, 16778475, 16785282, 16829056,
+   16783294, 16827405, 16840772, 16821025, 16840569, 16780862, 16813938, 16819211, 16788171, 16827080, 16835341, 16802262, 16838501, 16831142, 16814580, 16821990,
+   16793132, 16839926, 16789817, 16834857, 16804370, 16792056, 16805747, 16801102, 16813275, 16808104, 16827025, 16791707, 16810718, 16782055, 16824629, 16777922,
+   16818741, 16798277, 16783444, 16801498, 16828263, 16795518, 16778352, 16796302, 16794507, 16823994, 16836782, 16823898, 16798997, 16788402, 16796859, 16836570,
+   16796469, 16830745, 16806311, 16833675, 16823065, 16787797, 16822323, 16800586, 16805485, 16781825, 16806426, 16825013, 16800550, 16839134, 16817337, 16809403,
+   16789951, 16791351, 16822783, 16779968, 16791572, 16820973, 16788073, 16836419, 16836559, 16841774, 16817737, 16820799, 16799430, 16834664, 16817534, 16803926,
+   16793742, 16788476, 16812230, 16835508, 16836215, 16840798, 16817639, 16813324, 16777605, 16831521, 16782213, 16790058, 16838670, 16809691, 16825744, 16780295,
+   16796295, 16807874, 16809562, 16811120, 16824119, 16840761, 16796315, 16781659, 16839812, 16813491, 16838580, 16792891, 16785364, 16821760, 16838556, 16826202,
+   16794258, 16841394, 16801013, 16815021, 16822556, 16831635, 16792328, 16780377, 16821914, 16786674, 16826054, 16780471, 16798793, 16792814, 16801113, 16839689,
+   16794729, 16825282, 16811089, 16782427, 16832334, 16823932, 16829933, 16795395, 16793179, 16836966, 16780584, 16836602, 16810135, 16801081, 16808407, 16777842,
+   16832104, 16834025, 16822501, 16779863, 16792806, 16838975, 16785472, 16807932, 16796971, 16817563, 16827607, 16792133, 16840885, 16806703, 16825801, 16807954,
+   16835176, 16807628, 16792753, 16790213, 16791323, 16796444, 16789150, 16792654, 16811726, 16808511, 16798603, 16818213, 16815712, 16794868, 16777384, 16782290,
+   16835484, 16785819, 16836659, 16821485, 16787729, 16794559, 16782874, 16812042, 16797777, 16817673, 16795123, 16790198, 16782386, 16835946, 16814162, 16794176,
+   16792684, 16835361, 16792771, 16833426, 16809607, 16810814, 16787731, 16841728, 16803240, 16838645, 16812670, 16793467, 16831933, 16817931, 16827453, 16814085,
+   16820177, 16798012, 16783216, 16792813, 16825824, 16811716, 16841705, 16793925, 16812288, 16835305, 16793032, 16804742, 16787306, 16781969, 16825383, 16780946,
+   16827219, 16781740, 16783375, 16815255, 16783782, 16830987, 16787251, 16790782, 16813434, 16806236, 16799528, 16821566, 16812001, 16828853, 16830630, 16816159,
+   16822159, 16823322, 16804097, 16804131, 16784189, 16814720, 16810484, 16797499, 16819665, 16835771, 16790359, 16819495, 16792829, 16827555, 16778933, 16793551,
+   16832756, 16817121, 16815465, 16829166, 16837415, 16812964, 16789526, 16823643, 16813508, 16812407, 16807049, 16818880, 16824650, 16821717, 16786523, 16841507,
+   16840836, 16782568, 16795049, 16836832, 16791846, 16838451, 16827672, 16816294, 16827815, 16829568, 16782550, 16833875, 16837312, 16782950, 16839470, 16800961,
+   16817551, 16795824, 16828352, 16780351, 16818293, 16806615, 16815820, 16823766, 16817148, 16841526, 16821244, 16836783, 16836051, 16796044, 16818565, 16819297,
+   16832864, 16789374, 16810858, 16836787, 16790421, 16788385, 16832883, 16778856, 16803911, 16834243, 16805825, 16812546, 16800378, 16837108, 16798129, 16826226,
+   16795814, 16824939, 16807456, 16835902, 16803394, 16802554, 16839697, 16779957, 16826303, 16824720, 16831158, 16839829, 16787282, 16792229, 16792166, 16813096},
+};
@@ -0,0 +1,145 @@
+// next event estimation of emissive meshes (Texture::Emissive), the triangles, the alias table & the light bvh come
+// from gen_emissive_obj
+// with few triangles, one is chosen with probability ~ area * luminance(emission) in O(1) by the alias table (walker /
+// vose), then a point is uniform inside it, so the pdf (in area) of any point of an emissive object is
+// luminance(emission) / total power, and a bsdf sample hitting a light only needs res.col for the mis weight
+// with many triangles (LIGHT_BVH_MIN in src/codegen.rs), far or edge-on ones get most of the samples that way, so the
+// triangle is chosen by walking down the light bvh instead, taking a child with probability ~ its importance seen from
+// the shading point; the pdf of a point then depends on the shading point & the triangle, which is found again by the
+// position of the hit
+
+struct EmissiveTri {
+  Vec3 p, e1, e2, norm; // the vertices are p, p + e1, p + e2, norm is unit
+  Vec3 emission;
+  f32 prob; // keep this triangle if the coin < prob, otherwise take `alias`, like EnvTexel
+  u32 alias;
+  f32 area;
+};
+
+// a node of the light bvh, nodes are in depth first order, the first child follows its parent
+// triangles emit on both sides, so the cone bounds the normals up to sign: every normal is within acos(cos_o) of axis
+// or -axis
+struct LightNode {
+  Vec3 min, max;
+  Vec3 axis;
+  f32 cos_o;
+  f32 power; // sum of area * luminance(emission) of the triangles below
+  u32 child; // the second child, or the triangle of a leaf
+  u32 leaf;
+};
+
+// importance of the lights below node seen from p (conty & kulla), power * the max cos at the emitters / distance^2
+// there is no bound on the cos at the receiver, so it is the same for the sample & the pdf of a bsdf hit
+inline f32 light_importance(const LightNode &node, const Vec3 &p) {
+  Vec3 c = (node.min + node.max) * 0.5f, v = p - c;
+  f32 r2 = (node.max - node.min).len2() * 0.25f, d2 = v.len2();
+  if (d2 <= r2) { return node.power / fmaxf(r2, 1e-8f); }
+  // the angle between the axis (up to sign) & the direction to p, less the cone & the angle of the bounding sphere
+  f32 cos_w = fminf(fabsf(node.axis.dot(v)) / sqrtf(d2), 1.0f), sin_w = sqrtf(1.0f - cos_w * cos_w);
+  f32 sin_o = sqrtf(fmaxf(0.0f, 1.0f - node.cos_o * node.cos_o));
+  f32 cos_x = cos_w > node.cos_o ? 1.0f : cos_w * node.cos_o + sin_w * sin_o;
+  f32 sin_x = cos_w > node.cos_o ? 0.0f : sin_w * node.cos_o - cos_w * sin_o;
+  f32 cos_b = sqrtf(1.0f - r2 / d2), sin_b = sqrtf(r2 / d2);
+  f32 cos_p = cos_x > cos_b ? 1.0f : cos_x * cos_b + sin_x * sin_b;
+  return cos_p > 0.0f ? node.power * cos_p / d2 : 0.0f;
+}
+
+template <u32 N>
+struct EmissiveTable {
+  const EmissiveTri *tris;
+  const LightNode *nodes; // nullptr if the triangles are chosen by the alias table
+  f32 inv_power;          // 1 / sum of area * luminance(emission)
+
+  // probability of choosing the triangle x is on from p & its area, 0 if it isn't found
+  f32 tri_prob(const Vec3 &p, const Vec3 &x, f32 &area) const {
+    // the boxes of siblings may overlap, so both children are searched if x is in both
+    u32 stack[64];
+    f32 probs[64];
+    u32 n = 0;
+    stack[n] = 0, probs[n++] = 1.0f;
+    while (n) {
+      u32 i = stack[--n];
+      f32 prob = probs[n];
+      const LightNode &node = nodes[i];
+      if (node.leaf) {
+        const EmissiveTri &tri = tris[node.child];
+        Vec3 v = x - tri.p;
+        f32 d00 = tri.e1.dot(tri.e1), d01 = tri.e1.dot(tri.e2), d11 = tri.e2.dot(tri.e2);
+        f32 d20 = v.dot(tri.e1), d21 = v.dot(tri.e2), inv = 1.0f / (d00 * d11 - d01 * d01);
+        f32 b1 = (d11 * d20 - d01 * d21) * inv, b2 = (d00 * d21 - d01 * d20) * inv;
+        if (b1 >= -1e-4f && b2 >= -1e-4f && b1 + b2 <= 1.0f + 1e-4f &&
+            fabsf(v.dot(tri.norm)) < 1e-3f * sqrtf(d00 + d11)) {
+          area = tri.area;
+          return prob;
+        }
+        continue;
+      }
+      f32 i0 = light_importance(nodes[i + 1], p), i1 = light_importance(nodes[node.child], p);
+      if (i0 + i1 <= 0.0f) { continue; }
+      // with some slack, the hit point is a bit off the plane of the triangle
+      Vec3 pad = (node.max - node.min) * 1e-4f + Vec3{1e-4f, 1e-4f, 1e-4f};
+      for (u32 c : {i + 1, node.child}) {
+        const LightNode &ch = nodes[c];
+        bool in = x.x >= ch.min.x - pad.x && x.y >= ch.min.y - pad.y && x.z >= ch.min.z - pad.z &&
+                  x.x <= ch.max.x + pad.x && x.y <= ch.max.y + pad.y && x.z <= ch.max.z + pad.z;
+        f32 ic = c == i + 1 ? i0 : i1;
+        if (in && ic > 0.0f && n < 64) { stack[n] = c, probs[n++] = prob * ic / (i0 + i1); }
+      }
+    }
+    return 0.0f;
+  }
+
+  // solid angle pdf of sample() from p choosing the point x of emission e at distance t, cos is between the ray & the
+  // normal
+  f32 pdf(const Vec3 &p, const Vec3 &x, const Vec3 &e, f32 t, f32 cos) const {
+    f32 area_pdf;
+    if (nodes) {
+      f32 area, prob = tri_prob(p, x, area);
+      if (prob == 0.0f) { return 0.0f; }
+      area_pdf = prob / area;
+    } else {
+      area_pdf = luminance(e) * inv_power;
+    }
+    return area_pdf * t * t / fmaxf(fabsf(cos), 1e-6f);
+  }
+
+  // a point of the lights seen from p, as the direction d, its distance & the solid angle pdf, returns the emission
+  template <typename RNG>
+  Vec3 sample(RNG &rng, const Vec3 &p, Vec3 &d, f32 &dist, f32 &pdf) const {
+    u32 i;
+    f32 area_pdf;
+    if (nodes) {
+      u32 node = 0;
+      f32 prob = 1.0f;
+      while (!nodes[node].leaf) {
+        f32 i0 = light_importance(nodes[node + 1], p), i1 = light_importance(nodes[nodes[node].child], p);
+        if (i0 + i1 <= 0.0f) {
+          pdf = 0.0f;
+          return Vec3{};
+        }
+        f32 p0 = i0 / (i0 + i1);
+        // a random number per level, rescaling one would run out of bits in a deep tree
+        if (rng.gen() < p0) {
+          node = node + 1, prob *= p0;
+        } else {
+          node = nodes[node].child, prob *= 1.0f - p0;
+        }
+      }
+      i = nodes[node].child;
+      area_pdf = prob / tris[i].area;
+    } else {
+      f32 u0 = rng.gen(), coin = rng.gen();
+      i = std::min(u32(f64(u0) * N), N - 1);
+      if (coin >= tris[i].prob) { i = tris[i].alias; }
+      area_pdf = luminance(tris[i].emission) * inv_power;
+    }
+    const EmissiveTri &tri = tris[i];
+    f32 u1 = rng.gen(), u2 = rng.gen(), su = sqrtf(u1);
+    d = tri.p + tri.e1 * (su * (1.0f - u2)) + tri.e2 * (su * u2) - p;
+    dist = d.len();
+    d /= dist;
+    f32 cos = fabsf(d.dot(tri.norm));
+    pdf = cos > 0.0f ? area_pdf * dist * dist / cos : 0.0f;
+    return tri.emission;
+  }
+};
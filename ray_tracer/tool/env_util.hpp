@@ -0,0 +1,40 @@
+// environment map lighting, the texels & the alias table come from gen_env_obj
+// the mapping is the same as material::EnvMap: row 0 is +y, column x is phi = atan2(z, x) in [0, 2 PI)
+// a texel is chosen with probability ~ luminance * sin(theta) in O(1) by the alias table (walker / vose),
+// then a direction is uniform in (phi, theta) inside the texel
+// the coin between a texel & its alias is a random number of its own, the fractional part of the scaled index sample
+// has few bits left (none past 2^24 texels) for hdr maps of millions of texels
+
+struct EnvTexel {
+  Vec3 rad;
+  f32 prob; // keep this texel if the coin < prob, otherwise take `alias`
+  u32 alias;
+  f32 pdf;  // probability of choosing this texel * W * H / (2 PI^2), the pdf of a direction is pdf / sin(theta)
+};
+
+template <u32 W, u32 H>
+struct EnvMap {
+  const EnvTexel *texels;
+
+  // radiance from direction d (unit) & the pdf of sample() choosing it
+  Vec3 eval(const Vec3 &d, f32 &pdf) const {
+    f32 phi = atan2f(d.z, d.x), sin = sqrtf(fmaxf(0.0f, 1.0f - d.y * d.y));
+    u32 x = std::min(u32((phi < 0.0f ? phi + 2.0f * PI : phi) * (W * 0.5f / PI)), W - 1);
+    u32 y = std::min(u32(acosf(fminf(fmaxf(d.y, -1.0f), 1.0f)) * (H / PI)), H - 1);
+    const EnvTexel &t = texels[y * W + x];
+    pdf = sin > 0.0f ? t.pdf / sin : 0.0f;
+    return t.rad;
+  }
+
+  // u0 & coin choose the texel, u1 & u2 the position inside it
+  Vec3 sample(f32 u0, f32 coin, f32 u1, f32 u2, Vec3 &d, f32 &pdf) const {
+    u32 i = std::min(u32(f64(u0) * (W * H)), W * H - 1);
+    if (coin >= texels[i].prob) { i = texels[i].alias; }
+    const EnvTexel &t = texels[i];
+    f32 phi = (i % W + u1) * (2.0f * PI / W), theta = (i / W + u2) * (PI / H);
+    f32 sin = sinf(theta);
+    d = Vec3{sin * cosf(phi), cosf(theta), sin * sinf(phi)};
+    pdf = sin > 0.0f ? t.pdf / sin : 0.0f;
+    return t.rad;
+  }
+};
@@ -0,0 +1,212 @@
+#include <vector>
+
+// practical path guiding (sd-tree)
+// https://tom94.net/data/publications/mueller17practical/mueller17practical.pdf
+// space is a binary tree (split in the middle, axis x -> y -> z -> x ...), each leaf owns directional quadtrees
+// a direction is mapped to [0, 1)^2 by (cos theta, phi), which preserves area, so pdf(solid angle) = pdf([0, 1)^2) / (4 PI)
+// the structure is fixed during a pass, recording only adds to existing nodes with atomic add, so no lock is needed
+// between passes the trees are refined by the main thread (directional trees of different leaves in parallel)
+
+constexpr u32 GUIDING_MAX_DEPTH = 20;
+constexpr f32 GUIDING_RHO = 0.01f;
+constexpr f32 GUIDING_SPATIAL_C = 12000.0f;
+constexpr f32 GUIDING_BSDF_PROB = 0.5f;
+
+inline Vec2 dir_to_square(const Vec3 &d) {
+  f32 phi = atan2f(d.z, d.x);
+  return Vec2{fminf(fmaxf((d.y + 1.0f) * 0.5f, 0.0f), 1.0f), (phi < 0.0f ? phi + 2.0f * PI : phi) * (0.5f / PI)};
+}
+
+inline Vec3 square_to_dir(const Vec2 &p) {
+  f32 cos = 2.0f * p.x - 1.0f, sin = sqrtf(fmaxf(0.0f, 1.0f - cos * cos)), phi = 2.0f * PI * p.y;
+  return Vec3{sin * cosf(phi), cos, sin * sinf(phi)};
+}
+
+// quadrant q of a node covers [x, x + 1/2) * [y, y + 1/2), x = (q & 1) / 2, y = (q >> 1) / 2
+struct DTree {
+  struct Node {
+    f32 sum[4];
+    u32 child[4]; // 0 means the quadrant is not subdivided
+  };
+
+  std::vector<Node> nodes{Node{}};
+
+  f32 total() const {
+    return nodes[0].sum[0] + nodes[0].sum[1] + nodes[0].sum[2] + nodes[0].sum[3];
+  }
+
+  void record(Vec2 p, f32 v) {
+    for (u32 i = 0;;) {
+      u32 qx = p.x >= 0.5f, qy = p.y >= 0.5f, q = qx | qy << 1;
+#pragma omp atomic
+      nodes[i].sum[q] += v;
+      if (!(i = nodes[i].child[q])) { return; }
+      p = Vec2{p.x * 2.0f - qx, p.y * 2.0f - qy};
+    }
+  }
+
+  // u is uniform in [0, 1)^2, total() should be > 0
+  Vec2 sample(Vec2 u) const {
+    Vec2 o{0.0f, 0.0f};
+    f32 s = 1.0f;
+    for (u32 i = 0;;) {
+      const Node &n = nodes[i];
+      f32 l = n.sum[0] + n.sum[2], r = n.sum[1] + n.sum[3];
+      if (l + r <= 0.0f) { return o + u * s; }
+      u32 qx = 0, qy = 0;
+      f32 px = l / (l + r);
+      if (u.x < px) {
+        u.x /= px;
+      } else {
+        u.x = (u.x - px) / (1.0f - px), qx = 1;
+      }
+      f32 py = n.sum[qx] / (n.sum[qx] + n.sum[qx + 2]);
+      if (u.y < py) {
+        u.y /= py;
+      } else {
+        u.y = (u.y - py) / (1.0f - py), qy = 1;
+      }
+      s *= 0.5f;
+      o = o + Vec2{qx * s, qy * s};
+      if (!(i = n.child[qx | qy << 1])) { return o + Vec2{fminf(u.x, 1.0f), fminf(u.y, 1.0f)} * s; }
+    }
+  }
+
+  // pdf in [0, 1)^2
+  f32 pdf(Vec2 p) const {
+    f32 ret = 1.0f;
+    for (u32 i = 0;;) {
+      const Node &n = nodes[i];
+      f32 s = n.sum[0] + n.sum[1] + n.sum[2] + n.sum[3];
+      u32 qx = p.x >= 0.5f, qy = p.y >= 0.5f, q = qx | qy << 1;
+      if (s <= 0.0f) { return ret; }
+      ret *= 4.0f * n.sum[q] / s;
+      if (ret == 0.0f || !(i = n.child[q])) { return ret; }
+      p = Vec2{p.x * 2.0f - qx, p.y * 2.0f - qy};
+    }
+  }
+
+  // a tree subdivided where this tree has more than GUIDING_RHO of the energy, all sums are 0
+  DTree refined() const {
+    DTree ret;
+    ret.refine_from(*this, 0, 0, 1.0f, total(), 1);
+    return ret;
+  }
+
+  // node i of this tree corresponds to node old_i of the old tree
+  // old_i == -1u means the old tree doesn't have it, and its energy frac is assumed to be uniformly distributed
+  void refine_from(const DTree &old, u32 i, u32 old_i, f32 frac, f32 total, u32 depth) {
+    for (u32 q = 0; q < 4; ++q) {
+      f32 f = old_i == -1u ? frac * 0.25f : total > 0.0f ? old.nodes[old_i].sum[q] / total : 0.0f;
+      if (f > GUIDING_RHO && depth < GUIDING_MAX_DEPTH) {
+        u32 c = nodes.size();
+        nodes.push_back(Node{});
+        nodes[i].child[q] = c;
+        u32 old_c = old_i == -1u || !old.nodes[old_i].child[q] ? -1u : old.nodes[old_i].child[q];
+        refine_from(old, c, old_c, f, total, depth + 1);
+      }
+    }
+  }
+};
+
+// sampling is learned in the previous pass, building is being learned in this pass
+struct GuidingLeaf {
+  DTree sampling, building;
+  u32 n;
+};
+
+struct STree {
+  struct Node {
+    u32 axis;
+    u32 child[2]; // child[0] == 0 means it is a leaf (the root is never a child)
+    u32 leaf;
+  };
+
+  std::vector<Node> nodes{Node{0, {0, 0}, 0}};
+  std::vector<GuidingLeaf> leaves{GuidingLeaf{}};
+  Vec3 min, size;
+
+  STree(const Vec3 &min, const Vec3 &max) : min(min), size(max - min) {}
+
+  // positions out of the bound are clamped
+  GuidingLeaf &lookup(const Vec3 &pos) {
+    f32 p[3] = {(pos.x - min.x) / size.x, (pos.y - min.y) / size.y, (pos.z - min.z) / size.z};
+    u32 i = 0;
+    while (nodes[i].child[0]) {
+      f32 &x = p[nodes[i].axis];
+      if (x < 0.5f) {
+        x *= 2.0f, i = nodes[i].child[0];
+      } else {
+        x = x * 2.0f - 1.0f, i = nodes[i].child[1];
+      }
+    }
+    return leaves[nodes[i].leaf];
+  }
+
+  // called between passes, iter is the index of the pass just finished
+  void refine(u32 iter) {
+    // split leaves with enough samples, both children inherit the statistics
+    // new nodes are also visited by this loop, so a leaf may be split many times
+    f32 threshold = GUIDING_SPATIAL_C * sqrtf(f32(1u << iter));
+    for (u32 i = 0; i < nodes.size(); ++i) {
+      if (!nodes[i].child[0] && leaves[nodes[i].leaf].n > threshold) {
+        u32 l = nodes[i].leaf, axis = (nodes[i].axis + 1) % 3, c = nodes.size();
+        leaves[l].n /= 2;
+        GuidingLeaf copy = leaves[l];
+        leaves.push_back(std::move(copy));
+        nodes[i].child[0] = c, nodes[i].child[1] = c + 1;
+        nodes.push_back(Node{axis, {0, 0}, l});
+        nodes.push_back(Node{axis, {0, 0}, u32(leaves.size() - 1)});
+      }
+    }
+#pragma omp parallel for schedule(dynamic, 1)
+    for (u32 i = 0; i < leaves.size(); ++i) {
+      leaves[i].sampling = leaves[i].building;
+      leaves[i].building = leaves[i].building.refined();
+      leaves[i].n = 0;
+    }
+  }
+};
+
+// one-sample mis between bsdf (cosine) sampling & guided sampling
+// w: normal facing the incoming ray, d: sampled direction, pdf: combined pdf in solid angle
+// return false if the sampled direction is under the surface
+template <typename RNG>
+bool guiding_sample(const GuidingLeaf &leaf, const Vec3 &w, RNG &rng, Vec3 &d, f32 &pdf) {
+  bool guide = leaf.sampling.total() > 0.0f;
+  if (!guide || rng.gen() < GUIDING_BSDF_PROB) {
+    f32 r1 = 2.0f * PI * rng.gen();
+    f32 r2 = rng.gen(), r2s = sqrtf(r2);
+    Vec3 u = w.orthogonal_unit();
+    Vec3 v = w.cross(u);
+    d = ((u * cosf(r1) + v * sinf(r1)) * r2s + w * sqrtf(1.0f - r2)).norm();
+  } else {
+    d = square_to_dir(leaf.sampling.sample(Vec2{rng.gen(), rng.gen()}));
+  }
+  f32 cos = d.dot(w);
+  if (cos <= 0.0f) { return false; }
+  pdf = cos / PI;
+  if (guide) {
+    pdf = GUIDING_BSDF_PROB * pdf + (1.0f - GUIDING_BSDF_PROB) * leaf.sampling.pdf(dir_to_square(d)) / (4.0f * PI);
+  }
+  return true;
+}
+
+struct GuidingVertex {
+  GuidingLeaf *leaf;
+  Vec2 dir;
+  Vec3 fac; // throughput from the camera, including the sampling weight of this vertex
+  f32 pdf;
+};
+
+// rad is the radiance of the whole path, the incident radiance at vertex i is rad / verts[i].fac
+inline void guiding_record(const GuidingVertex *verts, u32 n, const Vec3 &rad) {
+  for (u32 i = 0; i < n; ++i) {
+    const GuidingVertex &v = verts[i];
+    f32 l = (v.fac.x > 0.0f ? rad.x / v.fac.x : 0.0f) + (v.fac.y > 0.0f ? rad.y / v.fac.y : 0.0f) +
+            (v.fac.z > 0.0f ? rad.z / v.fac.z : 0.0f);
+    v.leaf->building.record(v.dir, l / (3.0f * v.pdf));
+#pragma omp atomic
+    ++v.leaf->n;
+  }
+}
@@ -0,0 +1,161 @@
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
+// irradiance caching with gradients
+// http://www.graphics.cornell.edu/~bjw/IrradianceGradients.pdf
+// records are stored in a hash grid (same hash as HashGrid in ppm_util.hpp), a record is linked into every cell
+// its influence sphere overlaps, so a lookup only visits one cell
+// records & list nodes are preallocated and appended by atomic counters, a list is prepended by cas on its head,
+// so rendering threads can insert & lookup concurrently without lock
+
+constexpr f32 IC_A = 0.3f;         // the allowed error, a record is used when its weight > 1 / IC_A
+constexpr u32 IC_M = 8, IC_N = 32; // #stratum in theta & phi when computing a record
+constexpr u32 IC_MAX_RECORD = 1 << 18, IC_MAX_NODE = IC_MAX_RECORD * 8, IC_BUCKET = 1 << 20;
+
+struct IrradianceRecord {
+  Vec3 pos, norm, e;
+  f32 r;            // harmonic mean distance to the surrounding surfaces
+  Vec3 grad_r[3];   // rotational gradient of each channel
+  Vec3 grad_t[3];   // translational gradient of each channel
+};
+
+struct IrradianceCache {
+  struct Node {
+    u32 rec, next; // next == 0 means the end of list, node 0 is never used
+  };
+
+  std::vector<IrradianceRecord> records;
+  std::vector<Node> nodes;
+  std::vector<std::atomic<u32>> heads;
+  std::atomic<u32> n_record{0}, n_node{1};
+  std::atomic<u64> n_lookup{0}, n_hit{0};
+  f32 r_min, r_max, inv_cell_size;
+
+  IrradianceCache(f32 r_min, f32 r_max)
+    : records(IC_MAX_RECORD), nodes(IC_MAX_NODE), heads(IC_BUCKET), r_min(r_min), r_max(r_max),
+      inv_cell_size(1.0f / (2.0f * IC_A * r_max)) {}
+
+  u32 hash(u32 x, u32 y, u32 z) const {
+    return ((x * 73856093) ^ (y * 19349663) ^ (z * 83492791)) & (IC_BUCKET - 1);
+  }
+
+  u32 cell(const Vec3 &p) const {
+    return hash(u32(int(floorf(p.x * inv_cell_size))), u32(int(floorf(p.y * inv_cell_size))),
+                u32(int(floorf(p.z * inv_cell_size))));
+  }
+
+  // Ward's weighted interpolation with gradients, return false if no record is close enough
+  bool lookup(const Vec3 &p, const Vec3 &n, Vec3 &e) const {
+    f32 sum_w = 0.0f;
+    Vec3 sum{};
+    for (u32 i = heads[cell(p)].load(std::memory_order_acquire); i; i = nodes[i].next) {
+      const IrradianceRecord &r = records[nodes[i].rec];
+      Vec3 d = p - r.pos;
+      f32 err = d.len() / r.r + sqrtf(fmaxf(0.0f, 1.0f - n.dot(r.norm)));
+      // skip records that are too far away or in front of p
+      if (err >= IC_A || d.dot(n + r.norm) < -0.02f * r.r) { continue; }
+      f32 w = 1.0f / fmaxf(err, 1e-4f);
+      Vec3 rot = r.norm.cross(n);
+      sum += Vec3{r.e.x + rot.dot(r.grad_r[0]) + d.dot(r.grad_t[0]),
+                  r.e.y + rot.dot(r.grad_r[1]) + d.dot(r.grad_t[1]),
+                  r.e.z + rot.dot(r.grad_r[2]) + d.dot(r.grad_t[2])} * w;
+      sum_w += w;
+    }
+    if (sum_w == 0.0f) { return false; }
+    e = sum / sum_w;
+    e = Vec3{fmaxf(e.x, 0.0f), fmaxf(e.y, 0.0f), fmaxf(e.z, 0.0f)};
+    return true;
+  }
+
+  void insert(const IrradianceRecord &rec) {
+    u32 id = n_record.fetch_add(1, std::memory_order_relaxed);
+    if (id >= IC_MAX_RECORD) { return; }
+    records[id] = rec;
+    f32 rad = IC_A * rec.r;
+    Vec3 min1 = (rec.pos - rad) * inv_cell_size, max1 = (rec.pos + rad) * inv_cell_size;
+    for (int z = int(floorf(min1.z)); z <= int(floorf(max1.z)); ++z) {
+      for (int y = int(floorf(min1.y)); y <= int(floorf(max1.y)); ++y) {
+        for (int x = int(floorf(min1.x)); x <= int(floorf(max1.x)); ++x) {
+          u32 node = n_node.fetch_add(1, std::memory_order_relaxed);
+          if (node >= IC_MAX_NODE) { return; }
+          std::atomic<u32> &head = heads[hash(x, y, z)];
+          nodes[node].rec = id;
+          nodes[node].next = head.load(std::memory_order_relaxed);
+          while (!head.compare_exchange_weak(nodes[node].next, node, std::memory_order_release, std::memory_order_relaxed)) {}
+        }
+      }
+    }
+  }
+
+  // compute a new record by stratified hemisphere sampling, trace(const Ray &, f32 &dist) -> Vec3 is the incident radiance
+  // http://www.graphics.cornell.edu/~bjw/IrradianceGradients.pdf, equation (4) & (5)
+  template <typename RNG, typename F>
+  IrradianceRecord compute(const Vec3 &p, const Vec3 &n, RNG &rng, F trace) const {
+    Vec3 ls[IC_M][IC_N];
+    f32 rs[IC_M][IC_N], sin_th[IC_M][IC_N];
+    IrradianceRecord rec{p, n, Vec3{}, 0.0f, {}, {}};
+    Vec3 u = n.orthogonal_unit(), v = n.cross(u);
+    f32 inv_r = 0.0f;
+    for (u32 j = 0; j < IC_M; ++j) {
+      for (u32 k = 0; k < IC_N; ++k) {
+        f32 s2 = (j + rng.gen()) / IC_M, phi = 2.0f * PI * (k + rng.gen()) / IC_N;
+        f32 s = sqrtf(s2), c = sqrtf(1.0f - s2), cos_phi = cosf(phi), sin_phi = sinf(phi);
+        f32 dist;
+        Vec3 l = trace(Ray{p, u * (cos_phi * s) + v * (sin_phi * s) + n * c}, dist);
+        ls[j][k] = l, rs[j][k] = fmaxf(dist, 1e-3f), sin_th[j][k] = fmaxf(s, 1e-3f);
+        rec.e += l;
+        inv_r += 1.0f / rs[j][k];
+        // rotational gradient: v_k * (-tan(theta) * L)
+        Vec3 vk = v * cos_phi - u * sin_phi;
+        for (u32 ch = 0; ch < 3; ++ch) {
+          rec.grad_r[ch] += vk * (-s / fmaxf(c, 1e-3f) * l[ch] * (PI / (IC_M * IC_N)));
+        }
+      }
+    }
+    rec.e *= PI / (IC_M * IC_N);
+    rec.r = fminf(fmaxf(IC_M * IC_N / inv_r, r_min), r_max);
+    for (u32 k = 0; k < IC_N; ++k) {
+      f32 phi = 2.0f * PI * (k + 0.5f) / IC_N, phi_m = 2.0f * PI * k / IC_N;
+      Vec3 uk = u * cosf(phi) + v * sinf(phi), vkm = v * cosf(phi_m) - u * sinf(phi_m);
+      u32 km = (k + IC_N - 1) % IC_N;
+      for (u32 j = 0; j < IC_M; ++j) {
+        f32 s2_m = f32(j) / IC_M, s2_p = f32(j + 1) / IC_M;
+        // change across the boundary between theta stratum j - 1 & j
+        if (j > 0) {
+          f32 f = (2.0f * PI / IC_N) * sqrtf(s2_m) * (1.0f - s2_m) / fminf(rs[j][k], rs[j - 1][k]);
+          for (u32 ch = 0; ch < 3; ++ch) {
+            rec.grad_t[ch] += uk * (f * (ls[j][k][ch] - ls[j - 1][k][ch]));
+          }
+        }
+        // change across the boundary between phi stratum k - 1 & k
+        f32 f = (sqrtf(1.0f - s2_m) - sqrtf(1.0f - s2_p)) / (sin_th[j][k] * fminf(rs[j][k], rs[j][km]));
+        for (u32 ch = 0; ch < 3; ++ch) {
+          rec.grad_t[ch] += vkm * (f * (ls[j][k][ch] - ls[j][km][ch]));
+        }
+      }
+    }
+    return rec;
+  }
+
+  // interpolate if possible, otherwise compute & insert a new record
+  template <typename RNG, typename F>
+  Vec3 get(const Vec3 &p, const Vec3 &n, RNG &rng, F trace) {
+    n_lookup.fetch_add(1, std::memory_order_relaxed);
+    Vec3 e;
+    if (lookup(p, n, e)) {
+      n_hit.fetch_add(1, std::memory_order_relaxed);
+      return e;
+    }
+    IrradianceRecord rec = compute(p, n, rng, trace);
+    insert(rec);
+    return rec.e;
+  }
+
+  void print_info() const {
+    u64 lookup = n_lookup, hit = n_hit;
+    fprintf(stderr, "irradiance cache: %d records, %d nodes, hit rate = %.2f%% (%llu / %llu)\n",
+            std::min(u32(n_record), IC_MAX_RECORD), std::min(u32(n_node) - 1, IC_MAX_NODE - 1),
+            lookup ? 100.0 * hit / lookup : 0.0, hit, lookup);
+  }
+};
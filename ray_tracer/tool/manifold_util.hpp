@@ -0,0 +1,78 @@
+// specular manifold next event estimation
+// https://rgl.epfl.ch/publications/Zeltner2020Specular
+// the connection from a diffuse point to the light through refractive interfaces is parameterized by the initial
+// direction w, the walk solves light_plane_hit(w) = target with Newton iteration
+// the jacobian is computed by finite difference, so anything scene_hit() returns (e.g. interpolated mesh normals) works
+
+constexpr u32 MANIFOLD_ITER = 10;
+constexpr u32 MANIFOLD_MAX_INTERFACE = 2;
+constexpr f32 MANIFOLD_H = 1e-3f;
+
+// result of walking the chain from the diffuse point
+struct ManifoldChain {
+  f32 qu, qv; // hit point on the light plane, in light's local coordinate
+  Vec3 trans; // transmittance of the chain
+  u32 n;      // number of refractive interfaces
+};
+
+// refract d through the surface with normal norm, return false if total reflection happens
+// fresnel is the reflect intensity
+inline bool refract_dir(const Vec3 &d, const Vec3 &norm, Vec3 &out, f32 &fresnel) {
+  constexpr f32 NA = 1.0f, NG = 1.5f, R0 = (NA - NG) * (NA - NG) / ((NA + NG) * (NA + NG));
+  f32 cos = norm.dot(d), sin = sqrtf(fmaxf(0.0f, 1.0f - cos * cos)), n;
+  Vec3 norm_d = norm;
+  if (cos < 0.0f) {
+    n = NG / NA;
+    cos = -cos;
+    norm_d = -norm_d;
+  } else {
+    n = NA / NG;
+    if (sin >= n) {
+      return false;
+    }
+  }
+  fresnel = R0 + (1.0f - R0) * powf(1.0f - cos, 5);
+  out = norm_d * (sqrtf(1.0f - sin * sin / (n * n)) - cos / n) + d / n;
+  return true;
+}
+
+// chain(const Vec3 &w, ManifoldChain &c) -> bool: walk from the shading point along w
+// on success, w is the solved direction and inv_det = |d(solid angle) / d(light area)|
+template <typename F>
+bool manifold_solve(Vec3 &w, f32 tu, f32 tv, F chain, ManifoldChain &c, f32 &inv_det, f32 tol) {
+  if (!chain(w, c)) { return false; }
+  for (u32 i = 0; i < MANIFOLD_ITER; ++i) {
+    Vec3 t1 = w.orthogonal_unit(), t2 = w.cross(t1);
+    ManifoldChain ca, cb;
+    if (!chain((w + t1 * MANIFOLD_H).norm(), ca) || !chain((w + t2 * MANIFOLD_H).norm(), cb) || ca.n != c.n || cb.n != c.n) {
+      return false;
+    }
+    f32 j00 = (ca.qu - c.qu) / MANIFOLD_H, j01 = (cb.qu - c.qu) / MANIFOLD_H;
+    f32 j10 = (ca.qv - c.qv) / MANIFOLD_H, j11 = (cb.qv - c.qv) / MANIFOLD_H;
+    f32 det = j00 * j11 - j01 * j10;
+    if (fabsf(det) < 1e-6f) { return false; }
+    f32 eu = c.qu - tu, ev = c.qv - tv, err = eu * eu + ev * ev;
+    if (err < tol * tol) {
+      // t1, t2 are orthonormal to w, so d(solid angle) = da * db here
+      inv_det = 1.0f / fabsf(det);
+      return true;
+    }
+    f32 da = -(j11 * eu - j01 * ev) / det, db = -(j00 * ev - j10 * eu) / det;
+    f32 step = sqrtf(da * da + db * db);
+    if (step > 0.25f) { // the chain is far from linear when the step is large
+      da *= 0.25f / step, db *= 0.25f / step;
+    }
+    // backtracking, only accept a step that reduces the error
+    for (u32 j = 0;; ++j) {
+      Vec3 w1 = (w + t1 * da + t2 * db).norm();
+      ManifoldChain c1;
+      if (chain(w1, c1) && c1.n == c.n && (c1.qu - tu) * (c1.qu - tu) + (c1.qv - tv) * (c1.qv - tv) < err) {
+        w = w1, c = c1;
+        break;
+      }
+      if (j == 4) { return false; }
+      da *= 0.5f, db *= 0.5f;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,139 @@
+#include <vector>
+#include <algorithm>
+
+// primary sample space metropolis light transport
+// http://www.cs.columbia.edu/cg/pdfs/1171024519-SIGGRAPH_2002.pdf
+// trace() reads its random numbers from PSSSampler::gen(), so mutating the sample vector mutates the whole path
+
+constexpr f32 MLT_P_LARGE = 0.3f;
+constexpr f32 MLT_SIGMA = 0.01f;
+constexpr u32 MLT_BOOTSTRAP = 1 << 17;
+constexpr u32 MLT_CHAINS = 1024;
+
+struct PSSSampler {
+  struct Sample {
+    f32 val, backup;
+    u32 modify, modify_backup;
+  };
+
+  std::vector<Sample> xs;
+  XorShiftRNG rng;
+  u32 idx = 0, time = 0, large_step_time = 0;
+  bool large_step = true;
+
+  PSSSampler(u32 seed) : rng(seed) {}
+
+  void start_iteration() {
+    ++time;
+    large_step = rng.gen() < MLT_P_LARGE;
+    idx = 0;
+  }
+
+  // samples are mutated lazily, only when trace() actually reads them
+  f32 gen() {
+    if (idx == xs.size()) {
+      xs.push_back(Sample{0.0f, 0.0f, 0, 0});
+    }
+    Sample &x = xs[idx++];
+    if (x.modify < large_step_time) {
+      x.val = rng.gen();
+      x.modify = large_step_time;
+    }
+    x.backup = x.val, x.modify_backup = x.modify;
+    if (large_step) {
+      x.val = rng.gen();
+    } else {
+      // n small steps are equal to one small step with sigma * sqrt(n)
+      f32 r1 = fmaxf(rng.gen(), 1e-7f), r2 = rng.gen();
+      f32 normal = sqrtf(-2.0f * logf(r1)) * cosf(2.0f * PI * r2);
+      x.val += normal * MLT_SIGMA * sqrtf(f32(time - x.modify));
+      x.val -= floorf(x.val);
+    }
+    x.modify = time;
+    return x.val;
+  }
+
+  void accept() {
+    if (large_step) {
+      large_step_time = time;
+    }
+  }
+
+  void reject() {
+    for (auto &x : xs) {
+      if (x.modify == time) {
+        x.val = x.backup, x.modify = x.modify_backup;
+      }
+    }
+    --time;
+  }
+};
+
+// different chains may splat to the same pixel, atomic add is enough, no lock needed
+inline void mlt_splat(Vec3 *output, u32 index, const Vec3 &v) {
+#pragma omp atomic
+  output[index].x += v.x;
+#pragma omp atomic
+  output[index].y += v.y;
+#pragma omp atomic
+  output[index].z += v.z;
+}
+
+// eval(PSSSampler &, u32 &index) -> Vec3, generate a camera ray from the sampler, write the pixel index & return radiance
+template <typename F>
+void render_mlt(Vec3 *output, u32 w, u32 h, u32 mpp, F eval) {
+  // bootstrap: estimate the normalization constant b & choose the initial states of chains
+  std::vector<f32> cdf(MLT_BOOTSTRAP + 1);
+#pragma omp parallel for schedule(dynamic, 1024)
+  for (u32 i = 0; i < MLT_BOOTSTRAP; ++i) {
+    PSSSampler sampler{i + 1};
+    u32 index;
+    cdf[i + 1] = luminance(eval(sampler, index));
+  }
+  for (u32 i = 1; i <= MLT_BOOTSTRAP; ++i) {
+    cdf[i] += cdf[i - 1];
+  }
+  f32 b = cdf[MLT_BOOTSTRAP] / MLT_BOOTSTRAP;
+  fprintf(stderr, "mlt bootstrap: b = %f\n", b);
+  if (b == 0.0f) {
+    return;
+  }
+  u64 n_mutation = u64(mpp) * w * h / MLT_CHAINS;
+#pragma omp parallel for schedule(dynamic, 1)
+  for (u32 c = 0; c < MLT_CHAINS; ++c) {
+    fprintf(stderr, "\rrendering %5.2f%%", 100.0f * c / (MLT_CHAINS - 1));
+    // stratified selection of the initial state, proportional to its contribution
+    f32 u = (c + 0.5f) / MLT_CHAINS * cdf[MLT_BOOTSTRAP];
+    u32 seed = u32(std::upper_bound(cdf.begin() + 1, cdf.end(), u) - cdf.begin());
+    PSSSampler sampler{std::min(seed, MLT_BOOTSTRAP)};
+    XorShiftRNG rng{(c + 1) * 19260817};
+    u32 cur_index;
+    Vec3 cur = eval(sampler, cur_index);
+    f32 cur_i = luminance(cur);
+    for (u64 m = 0; m < n_mutation; ++m) {
+      sampler.start_iteration();
+      u32 index;
+      Vec3 pro = eval(sampler, index);
+      f32 pro_i = luminance(pro);
+      f32 a = cur_i > 0.0f ? fminf(1.0f, pro_i / cur_i) : 1.0f;
+      // expected value splatting: both states contribute, weighted by the acceptance probability
+      if (a > 0.0f && pro_i > 0.0f) {
+        mlt_splat(output, index, pro * (a / pro_i));
+      }
+      if (a < 1.0f && cur_i > 0.0f) {
+        mlt_splat(output, cur_index, cur * ((1.0f - a) / cur_i));
+      }
+      if (rng.gen() < a) {
+        cur = pro, cur_i = pro_i, cur_index = index;
+        sampler.accept();
+      } else {
+        sampler.reject();
+      }
+    }
+  }
+  fprintf(stderr, "\n");
+  f32 scale = b * w * h / (f32(n_mutation) * MLT_CHAINS);
+  for (u32 i = 0; i < w * h; ++i) {
+    output[i] *= scale;
+  }
+}
@@ -1,39 +1,15 @@
 #include <vector>
-#include <mutex>
+#include <algorithm>
+#include <omp.h>
 
 constexpr f32 ALPHA = 0.7f;
+constexpr u32 PPM_PASS_1024 = 64; // photons in a pass (* 1024), hit points are updated at the end of a pass
 
-// generate low discrepancy random numbers using Halton sequence
-// with div/mod const optimization
-struct HaltonRNG {
-  u64 mul;
-  u32 val, shift;
-  f32 inv;
-
-  HaltonRNG(u32 prime) : val(prime), shift(63 - __builtin_clz(prime)), inv(1.0f / prime) {
-    mul = ((u64) 1 << shift) / val;
-    mul += (val * mul >> shift) != 1;
-  }
-
-  f32 gen(u32 x) const {
-    f32 ret = 0.0, fac = inv;
-    while (x) {
-      u32 div = x * mul >> shift;
-      ret += (x - val * div) * fac;
-      x = div;
-      fac *= inv;
-    }
-    return ret;
-  }
-};
-
-const HaltonRNG hal[] = {
-    2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109,
-    113, 127, 131, 137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227, 229, 233, 239,
-    241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311, 313, 317, 331, 337, 347, 349, 353, 359, 367, 373, 379,
-    383, 389, 397, 401, 409, 419, 421, 431, 433, 439, 443, 449, 457, 461, 463, 467, 479, 487, 491, 499
-};
+// by default photon contributions are buffered per thread & reduced at the end of a pass, deterministic for a fixed
+// #thread; define PPM_ATOMIC_FLUX to accumulate them by atomic add instead, less memory, but the sum order is random
+constexpr u32 PPM_CHUNK_PER_THREAD = 4;
 
+// the record added by hit point passes, split into hot & cold data when collected into a HashGrid
 struct HitPoint {
   Vec3 fac, pos, norm, flux;
   f32 r2;
@@ -41,73 +17,277 @@ struct HitPoint {
   u32 idx;
 };
 
+// read by every photon lookup, 32 bytes so that a record never crosses a cache line
+struct alignas(16) HitPointHot {
+  Vec3 pos;
+  f32 r2;
+  Vec3 norm;
+};
+
+// only touched at the end of a pass (or when a caustic photon is accepted)
+struct HitPointCold {
+  Vec3 fac, flux;
+  u32 n, idx;
+#ifdef PPM_ATOMIC_FLUX
+  Vec3 pass_flux;
+  u32 pass_n;
+#endif
+};
+
+struct PhotonContrib {
+  u32 hp;
+  Vec3 flux;
+};
+
 struct HashGrid {
   Vec3 min, max;
   f32 inv_grid_size;
-  std::vector<HitPoint> hps;
-  std::vector<HitPoint *> pool;
+  u32 mask; // the table size is a power of 2
+  // hot[i] & cold[i] are the same point, points are sorted by the cell they lie in after build()
+  // so points of neighbouring entries in pool are mostly adjacent in memory
+  std::vector<HitPointHot> hot;
+  std::vector<HitPointCold> cold;
+  std::vector<u32> pool; // index of hit points, grouped by cell, increasing in a cell
   std::vector<u32> idx;
-  std::mutex mu;
+  // per thread buffers, hit points are collected in thread order
+  std::vector<std::vector<HitPoint>> hp_bufs;
+  // contribs[t * n_chunk + c]: contributions added by thread t to hit points in chunk c
+  // i.e. a per thread bucket sort by hit point index
+  std::vector<std::vector<PhotonContrib>> contribs;
+  u32 n_chunk, chunk_size;
+  std::vector<Vec3> pass_phi;
+  std::vector<u32> pass_m;
+  // buffers of build(), kept to avoid allocation when building again
+  std::vector<std::vector<u32>> counts; // per thread count of each cell
+  std::vector<u32> chunk_sum;
+  std::vector<u32> order;
+  std::vector<HitPointHot> hot_buf;
+  std::vector<HitPointCold> cold_buf;
+
+  HashGrid() : hp_bufs(omp_get_max_threads()) {}
+
+  u32 size() const { return hot.size(); }
 
   u32 hash(u32 x, u32 y, u32 z) const {
-    return ((x * 73856093) ^ (y * 19349663) ^ (z * 83492791)) % hps.size();
+    return ((x * 73856093) ^ (y * 19349663) ^ (z * 83492791)) & mask;
   }
 
-  void rebuild(u32 w, u32 h) {
-    fprintf(stderr, "building hash grid...\n");
-    min = Vec3{1e10, 1e10, 1e10}, max = Vec3{-1e10, -1e10, -1e10};
-    auto update = [this](const Vec3 &v) {
-      min.x = fminf(v.x, min.x), min.y = fminf(v.y, min.y), min.z = fminf(v.z, min.z);
-      max.x = fmaxf(v.x, max.x), max.y = fmaxf(v.y, max.y), max.z = fmaxf(v.z, max.z);
-    };
-    for (auto &hp : hps) {
-      update(hp.pos);
+  void add_hit_point(const HitPoint &hp) {
+    hp_bufs[omp_get_thread_num()].push_back(hp);
+  }
+
+  // move the hit points added by add_hit_point() into hot & cold
+  void collect_hit_points() {
+    for (auto &buf : hp_bufs) {
+      for (const HitPoint &hp : buf) {
+        hot.push_back(HitPointHot{hp.pos, hp.r2, hp.norm});
+        cold.push_back(HitPointCold{hp.fac, hp.flux, hp.n, hp.idx});
+      }
+      buf.clear();
     }
+  }
+
+  void clear() {
+    hot.clear(), cold.clear();
+  }
+
+  // hit point i receives flux (already multiplied by its fac) in this pass, its radius doesn't change until end_pass()
+  // only accepted photons read the cold data
+  void add_photon(u32 i, const Vec3 &flux) {
+#ifdef PPM_ATOMIC_FLUX
+    HitPointCold &hp = cold[i];
+#pragma omp atomic
+    hp.pass_flux.x += flux.x;
+#pragma omp atomic
+    hp.pass_flux.y += flux.y;
+#pragma omp atomic
+    hp.pass_flux.z += flux.z;
+#pragma omp atomic
+    ++hp.pass_n;
+#else
+    contribs[omp_get_thread_num() * n_chunk + i / chunk_size].push_back(PhotonContrib{i, flux});
+#endif
+  }
+
+  // the same as m updates of one photon, with the radius fixed during the pass
+  // N' = N + ALPHA * M, R'^2 = R^2 * (N + ALPHA * M) / (N + M), flux' = (flux + phi) * (N + ALPHA * M) / (N + M)
+  void update(u32 i, u32 m, const Vec3 &phi) {
+    HitPointCold &hp = cold[i];
+    f32 g = (hp.n * ALPHA + m * ALPHA) / (hp.n * ALPHA + m);
+    hot[i].r2 *= g;
+    hp.n += m;
+    hp.flux = (hp.flux + phi) * g;
+  }
+
+  void end_pass() {
+    u32 n = size();
+#ifdef PPM_ATOMIC_FLUX
+#pragma omp parallel for schedule(static)
+    for (u32 i = 0; i < n; ++i) {
+      HitPointCold &hp = cold[i];
+      if (hp.pass_n) {
+        update(i, hp.pass_n, hp.pass_flux);
+        hp.pass_n = 0, hp.pass_flux = Vec3{};
+      }
+    }
+#else
+    u32 nt = contribs.size() / n_chunk;
+    // a chunk is reduced by one thread, reading the buckets in thread order, so the sum order is fixed
+#pragma omp parallel for schedule(dynamic, 1)
+    for (u32 c = 0; c < n_chunk; ++c) {
+      for (u32 t = 0; t < nt; ++t) {
+        for (const PhotonContrib &pc : contribs[t * n_chunk + c]) {
+          pass_phi[pc.hp] += pc.flux;
+          ++pass_m[pc.hp];
+        }
+        contribs[t * n_chunk + c].clear();
+      }
+      for (u32 i = c * chunk_size, end = std::min(n, i + chunk_size); i < end; ++i) {
+        if (pass_m[i]) {
+          update(i, pass_m[i], pass_phi[i]);
+          pass_m[i] = 0, pass_phi[i] = Vec3{};
+        }
+      }
+    }
+#endif
+  }
+
+  u32 cell(const Vec3 &pos) const {
+    Vec3 p = (pos - min) * inv_grid_size;
+    return hash(u32(p.x), u32(p.y), u32(p.z));
+  }
+
+  template <typename F>
+  void for_each_cell(const Vec3 &pos, f32 rad, F f) const {
+    Vec3 min1 = (pos - min - rad) * inv_grid_size;
+    Vec3 max1 = (pos - min + rad) * inv_grid_size;
+    for (u32 z = u32(min1.z); z <= u32(max1.z); ++z) {
+      for (u32 y = u32(min1.y); y <= u32(max1.y); ++y) {
+        for (u32 x = u32(min1.x); x <= u32(max1.x); ++x) {
+          f(hash(x, y, z));
+        }
+      }
+    }
+  }
+
+  // heuristic for the initial radius, from the bound of hit points
+  f32 init_rad(u32 w, u32 h) {
+    f32 x0 = 1e10, y0 = 1e10, z0 = 1e10, x1 = -1e10, y1 = -1e10, z1 = -1e10;
+#pragma omp parallel for reduction(min: x0, y0, z0) reduction(max: x1, y1, z1)
+    for (u32 i = 0; i < size(); ++i) {
+      const Vec3 &p = hot[i].pos;
+      x0 = fminf(x0, p.x), y0 = fminf(y0, p.y), z0 = fminf(z0, p.z);
+      x1 = fmaxf(x1, p.x), y1 = fmaxf(y1, p.y), z1 = fmaxf(z1, p.z);
+    }
+    min = Vec3{x0, y0, z0}, max = Vec3{x1, y1, z1};
     fprintf(stderr, "hash grid min: %f %f %f\n", min.x, min.y, min.z);
     fprintf(stderr, "hash grid max: %f %f %f\n", max.x, max.y, max.z);
     Vec3 size = max - min;
-    f32 rad = ((size.x + size.y + size.z) / 3.0) / ((w + h) / 2.0) * 2.0; // heuristic for initial radius
+    f32 rad = ((size.x + size.y + size.z) / 3.0) / ((w + h) / 2.0) * 2.0;
     fprintf(stderr, "init rad: %f\n", rad);
-    min = Vec3{1e10, 1e10, 1e10}, max = Vec3{-1e10, -1e10, -1e10};
-    for (auto &hp : hps) {
-      hp.r2 = rad * rad;
-      hp.n = 0;
-      hp.flux = Vec3{};
-      update(hp.pos - rad);
-      update(hp.pos + rad);
+    return rad;
+  }
+
+  void rebuild(u32 w, u32 h) {
+    fprintf(stderr, "building hash grid...\n");
+    f32 rad = init_rad(w, h);
+#pragma omp parallel for
+    for (u32 i = 0; i < size(); ++i) {
+      hot[i].r2 = rad * rad;
+      cold[i].n = 0;
+      cold[i].flux = Vec3{};
     }
-    inv_grid_size = 1.0 / (rad * 2.0); // make each grid cell two times larger than the initial radius
-    idx.resize(hps.size() + 1);
-    u32 all = 0;
-    for (auto &hp : hps) {
-      Vec3 min1 = (hp.pos - min - rad) * inv_grid_size;
-      Vec3 max1 = (hp.pos - min + rad) * inv_grid_size;
-      for (u32 z = u32(min1.z); z <= u32(max1.z); ++z) {
-        for (u32 y = u32(min1.y); y <= u32(max1.y); ++y) {
-          for (u32 x = u32(min1.x); x <= u32(max1.x); ++x) {
-            ++idx[hash(x, y, z) + 1];
-            ++all;
-          }
+    build(rad);
+  }
+
+  // parallel counting sort of points into cells, keys(i, f) calls f(h) for every cell h point i is put into
+  // afterwards cell h is out[off[h] .. off[h + 1]], in increasing order of point index
+  // thread t counts & fills for the t-th chunk of points, so the result doesn't depend on scheduling
+  template <typename F>
+  void bucket_sort(F keys, std::vector<u32> &off, std::vector<u32> &out) {
+    u32 n = size(), table = mask + 1;
+    off.resize(table + 1);
+#pragma omp parallel
+    {
+      u32 t = omp_get_thread_num(), nt = omp_get_num_threads();
+#pragma omp single
+      {
+        counts.resize(nt);
+        chunk_sum.resize(nt);
+      }
+      std::vector<u32> &cnt = counts[t];
+      cnt.assign(table, 0);
+      u32 begin = u64(n) * t / nt, end = u64(n) * (t + 1) / nt;
+      for (u32 i = begin; i < end; ++i) {
+        keys(i, [&](u32 h) { ++cnt[h]; });
+      }
+#pragma omp barrier
+      // parallel prefix sum, thread t scans the t-th chunk of cells
+      // afterwards counts[t][h] is where thread t starts writing in cell h
+      u32 c_begin = u64(table) * t / nt, c_end = u64(table) * (t + 1) / nt, sum = 0;
+      for (u32 c = c_begin; c < c_end; ++c) {
+        for (u32 t1 = 0; t1 < nt; ++t1) {
+          sum += counts[t1][c];
         }
       }
-    }
-    for (u32 i = 1; i < idx.size(); ++i) {
-      idx[i] += idx[i - 1];
-    }
-    std::vector<u32> idx_copy = idx;
-    pool.resize(all);
-    for (auto &hp : hps) {
-      Vec3 min1 = (hp.pos - min - rad) * inv_grid_size;
-      Vec3 max1 = (hp.pos - min + rad) * inv_grid_size;
-      for (u32 z = u32(min1.z); z <= u32(max1.z); ++z) {
-        for (u32 y = u32(min1.y); y <= u32(max1.y); ++y) {
-          for (u32 x = u32(min1.x); x <= u32(max1.x); ++x) {
-            pool[--idx_copy[hash(x, y, z) + 1]] = &hp;
-          }
+      chunk_sum[t] = sum;
+#pragma omp barrier
+      u32 o = 0;
+      for (u32 t1 = 0; t1 < t; ++t1) {
+        o += chunk_sum[t1];
+      }
+      for (u32 c = c_begin; c < c_end; ++c) {
+        off[c] = o;
+        for (u32 t1 = 0; t1 < nt; ++t1) {
+          u32 x = counts[t1][c];
+          counts[t1][c] = o;
+          o += x;
         }
       }
+      if (t == nt - 1) {
+        off[table] = o;
+      }
+#pragma omp barrier
+#pragma omp single
+      out.resize(off[table]);
+      for (u32 i = begin; i < end; ++i) {
+        keys(i, [&](u32 h) { out[cnt[h]++] = i; });
+      }
+    }
+  }
+
+  // distribute the points into the grid, every point covers a sphere of radius `rad`
+  // it doesn't touch the content of points except reordering them, so it can also be used to store photons
+  void build(f32 rad) {
+    u32 n = size(), table = 1;
+    f32 x0 = 1e10, y0 = 1e10, z0 = 1e10, x1 = -1e10, y1 = -1e10, z1 = -1e10;
+#pragma omp parallel for reduction(min: x0, y0, z0) reduction(max: x1, y1, z1)
+    for (u32 i = 0; i < n; ++i) {
+      const Vec3 &p = hot[i].pos;
+      x0 = fminf(x0, p.x - rad), y0 = fminf(y0, p.y - rad), z0 = fminf(z0, p.z - rad);
+      x1 = fmaxf(x1, p.x + rad), y1 = fmaxf(y1, p.y + rad), z1 = fmaxf(z1, p.z + rad);
+    }
+    min = Vec3{x0, y0, z0}, max = Vec3{x1, y1, z1};
+    inv_grid_size = 1.0 / (rad * 2.0); // make each grid cell two times larger than the initial radius
+    while (table < n) {
+      table <<= 1;
+    }
+    mask = table - 1;
+    // sort the points by the cell they lie in, a lookup then reads a few contiguous runs of hot
+    bucket_sort([&](u32 i, auto f) { f(cell(hot[i].pos)); }, idx, order);
+    hot_buf.resize(n), cold_buf.resize(n);
+#pragma omp parallel for
+    for (u32 i = 0; i < n; ++i) {
+      hot_buf[i] = hot[order[i]], cold_buf[i] = cold[order[i]];
     }
-    fprintf(stderr, "hash grid info: %d points, %d entry, mem = %.1fM\n", u32(hps.size()), all,
-            (hps.size() * (sizeof(HitPoint) + sizeof(u32)) + all * sizeof(HitPoint *)) / 1e6f);
+    hot.swap(hot_buf), cold.swap(cold_buf);
+    bucket_sort([&](u32 i, auto f) { for_each_cell(hot[i].pos, rad, f); }, idx, pool);
+    n_chunk = hp_bufs.size() * PPM_CHUNK_PER_THREAD;
+    chunk_size = std::max(1u, (n + n_chunk - 1) / n_chunk);
+    contribs.resize(hp_bufs.size() * n_chunk);
+    pass_phi.assign(n, Vec3{});
+    pass_m.assign(n, 0);
+    fprintf(stderr, "hash grid info: %d points, %d entry, mem = %.1fM\n", n, idx[table],
+            (n * (sizeof(HitPointHot) + sizeof(HitPointCold)) + (table + 1 + idx[table]) * sizeof(u32)) / 1e6f);
   }
 } grid;
@@ -0,0 +1,213 @@
+// owen scrambled sobol sequence, 8 dimensions are generated at a time with gcc vector extension
+// direction numbers: primitive polynomials in increasing order, the initial m_k are chosen greedily to minimize the
+// t-value of the 2d projections with the previous dimensions (the criterion of Joe & Kuo)
+// https://web.maths.unsw.edu.au/~fkuo/sobol/joe-kuo-notes.pdf
+// scrambling: hash based owen scrambling, http://www.jcgt.org/published/0009/04/01/
+// points are visited in gray code order, so going to the next sample is one xor per dimension
+// a sampler only hands out dimensions in order through gen(), so two call sites never share a dimension
+
+constexpr u32 SOBOL_DIM = 64; // dimensions after it are hashed random numbers
+
+typedef u32 u32x8 __attribute__((vector_size(32)));
+typedef f32 f32x8 __attribute__((vector_size(32)));
+typedef u64 u64x4 __attribute__((vector_size(32)));
+
+struct SobolPoly {
+  u32 poly; // including the x^s & 1 terms
+  u32 m[9];
+};
+
+// dimension 0 is the van der corput sequence, which needs no polynomial
+const SobolPoly SOBOL_POLY[SOBOL_DIM - 1] = {
+    {0x3, {1}}, {0x7, {1, 1}}, {0xb, {1, 3, 1}}, {0xd, {1, 1, 5}}, {0x13, {1, 3, 1, 7}}, {0x19, {1, 3, 7, 13}},
+    {0x25, {1, 3, 1, 9, 17}}, {0x29, {1, 3, 1, 5, 27}}, {0x2f, {1, 3, 7, 5, 23}}, {0x37, {1, 1, 1, 11, 5}},
+    {0x3b, {1, 1, 5, 5, 1}}, {0x3d, {1, 1, 5, 11, 17}}, {0x43, {1, 1, 7, 1, 27, 61}}, {0x5b, {1, 3, 7, 13, 11, 31}},
+    {0x61, {1, 3, 7, 1, 29, 11}}, {0x67, {1, 3, 1, 3, 29, 39}}, {0x6d, {1, 3, 1, 9, 25, 55}},
+    {0x73, {1, 1, 5, 3, 5, 7}}, {0x83, {1, 1, 3, 7, 25, 61, 97}}, {0x89, {1, 1, 1, 15, 23, 59, 3}},
+    {0x8f, {1, 3, 5, 7, 27, 35, 21}}, {0x91, {1, 1, 1, 11, 15, 55, 65}}, {0x9d, {1, 3, 5, 13, 23, 3, 111}},
+    {0xa7, {1, 3, 5, 7, 15, 57, 115}}, {0xab, {1, 3, 1, 9, 11, 23, 103}}, {0xb9, {1, 1, 1, 1, 31, 47, 37}},
+    {0xbf, {1, 1, 7, 3, 1, 63, 95}}, {0xc1, {1, 3, 1, 3, 31, 39, 25}}, {0xcb, {1, 3, 7, 5, 27, 11, 47}},
+    {0xd3, {1, 1, 5, 5, 23, 13, 25}}, {0xd5, {1, 3, 3, 9, 31, 33, 29}}, {0xe5, {1, 1, 7, 11, 21, 1, 123}},
+    {0xef, {1, 3, 3, 5, 5, 49, 59}}, {0xf1, {1, 3, 7, 15, 17, 61, 67}}, {0xf7, {1, 1, 3, 11, 15, 61, 17}},
+    {0xfd, {1, 1, 5, 9, 1, 23, 61}}, {0x11d, {1, 1, 7, 5, 27, 17, 39, 219}}, {0x12b, {1, 1, 7, 3, 11, 59, 63, 215}},
+    {0x12d, {1, 3, 5, 1, 29, 7, 71, 141}}, {0x14d, {1, 1, 1, 13, 25, 59, 65, 75}},
+    {0x15f, {1, 1, 5, 11, 19, 63, 85, 189}}, {0x163, {1, 1, 1, 1, 1, 1, 1, 1}}, {0x165, {1, 1, 5, 13, 3, 63, 111, 111}},
+    {0x169, {1, 3, 1, 9, 25, 25, 35, 231}}, {0x171, {1, 1, 3, 11, 17, 19, 15, 129}},
+    {0x187, {1, 1, 7, 5, 25, 33, 101, 65}}, {0x18d, {1, 1, 3, 7, 23, 53, 57, 37}}, {0x1a9, {1, 3, 5, 7, 9, 27, 115, 9}},
+    {0x1c3, {1, 1, 3, 9, 3, 3, 17, 183}}, {0x1cf, {1, 3, 3, 1, 29, 13, 121, 61}}, {0x1e7, {1, 1, 5, 7, 5, 57, 3, 207}},
+    {0x1f5, {1, 1, 3, 5, 3, 27, 79, 9}}, {0x211, {1, 1, 5, 1, 25, 43, 95, 205, 387}},
+    {0x21b, {1, 1, 5, 13, 9, 27, 13, 247, 275}}, {0x221, {1, 3, 1, 5, 23, 13, 83, 155, 451}},
+    {0x22d, {1, 3, 7, 11, 29, 55, 71, 57, 297}}, {0x233, {1, 3, 3, 9, 17, 59, 19, 95, 175}},
+    {0x259, {1, 3, 7, 3, 9, 11, 85, 249, 299}}, {0x25f, {1, 1, 7, 15, 29, 25, 83, 237, 149}},
+    {0x269, {1, 1, 1, 1, 1, 1, 1, 1, 1}}, {0x26f, {1, 3, 3, 15, 13, 13, 67, 203, 267}},
+    {0x277, {1, 1, 1, 13, 31, 13, 127, 113, 339}}, {0x27d, {1, 1, 7, 3, 15, 49, 45, 153, 509}},
+};
+
+// works for both u32 & u32x8
+template <typename T>
+inline T reverse_bits(T x) {
+  x = x >> 16 | x << 16;
+  x = (x >> 8 & 0x00ff00ff) | (x & 0x00ff00ff) << 8;
+  x = (x >> 4 & 0x0f0f0f0f) | (x & 0x0f0f0f0f) << 4;
+  x = (x >> 2 & 0x33333333) | (x & 0x33333333) << 2;
+  return (x >> 1 & 0x55555555) | (x & 0x55555555) << 1;
+}
+
+// https://nullprogram.com/blog/2018/07/31/
+template <typename T>
+inline T hash32(T x) {
+  x ^= x >> 16;
+  x *= 0x7feb352d;
+  x ^= x >> 15;
+  x *= 0x846ca68b;
+  return x ^ x >> 16;
+}
+
+// on bit reversed numbers, a bit is only affected by lower bits, i.e. an owen scrambling of the digits
+template <typename T>
+inline T laine_karras(T x, T seed) {
+  x += seed;
+  x ^= x * 0x6c50b47c;
+  x ^= x * 0xb82f1e52;
+  x ^= x * 0xc7afe638;
+  x ^= x * 0x8d22f6e6;
+  return x;
+}
+
+// 24 random bits to [0, 1)
+inline f32 bits_to_f32(u32 x) {
+  return (x >> 8) * (1.0f / (1u << 24));
+}
+
+struct SobolTable {
+  // v[k][d / 8][d % 8]: bit reversed direction number k of dimension d
+  u32x8 v[32][SOBOL_DIM / 8];
+
+  SobolTable() {
+    for (u32 k = 0; k < 32; ++k) {
+      v[k][0][0] = 1u << k;
+    }
+    for (u32 d = 1; d < SOBOL_DIM; ++d) {
+      const SobolPoly &p = SOBOL_POLY[d - 1];
+      u32 s = 31 - __builtin_clz(p.poly), m[32];
+      for (u32 k = 0; k < 32; ++k) {
+        if (k < s) {
+          m[k] = p.m[k];
+        } else {
+          m[k] = m[k - s] ^ m[k - s] << s;
+          for (u32 i = 1; i < s; ++i) {
+            if (p.poly >> (s - i) & 1) { m[k] ^= m[k - i] << i; }
+          }
+        }
+        v[k][d / 8][d % 8] = reverse_bits(m[k] << (31 - k));
+      }
+    }
+  }
+};
+
+const SobolTable sobol_table;
+
+struct SobolSampler {
+  u32x8 x[SOBOL_DIM / 8];   // unscrambled & bit reversed point of the current sample
+  u32x8 key[SOBOL_DIM / 8]; // scrambling seed of each dimension
+  f32x8 buf[SOBOL_DIM / 8]; // scrambled output, the first `ready` blocks are valid
+  u32 seed, index, dim, ready;
+
+  // samplers with different seeds are scrambled independently, e.g. one seed per pixel
+  // a sampler with one seed can be split into several ranges of index, e.g. batches of photons
+  SobolSampler(u32 seed, u32 index = 0) : seed(seed), index(index), dim(0), ready(0) {
+    u32 gray = index ^ index >> 1;
+    for (u32 i = 0; i < SOBOL_DIM / 8; ++i) {
+      x[i] = u32x8{};
+      for (u32 k = 0; gray >> k; ++k) {
+        if (gray >> k & 1) { x[i] ^= sobol_table.v[k][i]; }
+      }
+      key[i] = hash32(u32x8{0, 1, 2, 3, 4, 5, 6, 7} + (seed * SOBOL_DIM + i * 8));
+    }
+  }
+
+  // scramble dimension d like a sampler with seed s does, should be called before gen()
+  // e.g. the seeds of a blue noise tile (tool/blue_noise.cpp)
+  void reseed(u32 d, u32 s) {
+    key[d / 8][d % 8] = hash32(s * SOBOL_DIM + d);
+  }
+
+  void next_sample() {
+    u32 k = __builtin_ctz(++index);
+    for (u32 i = 0; i < SOBOL_DIM / 8; ++i) {
+      x[i] ^= sobol_table.v[k][i];
+    }
+    dim = ready = 0;
+  }
+
+  f32 gen() {
+    if (dim >= SOBOL_DIM) {
+      return bits_to_f32(hash32(hash32(hash32(dim++) ^ index) ^ seed));
+    }
+    if (dim == ready * 8) {
+      // the top 23 bits as the mantissa of a number in [1, 2)
+      u32x8 r = reverse_bits(laine_karras(x[ready], key[ready]));
+      buf[ready] = (f32x8) ((r >> 9) | 0x3f800000) - 1.0f;
+      ++ready;
+    }
+    u32 d = dim++;
+    return buf[d / 8][d % 8];
+  }
+};
+
+// counter based rng, philox4x32-10, http://www.thesalmons.org/john/random123/papers/random123sc11.pdf
+// dimension d of a sample is a pure function of (seed, pixel, sample, d), so the result doesn't depend on thread
+// scheduling, and renderings with different seeds (e.g. on different machines) are independent
+// 8 counters are run in the lanes of u32x8, giving 32 dimensions at a time
+struct PhiloxRNG {
+  f32x8 buf[4];
+  u32 seed, pixel, sample, dim;
+
+  PhiloxRNG(u32 seed, u32 pixel, u32 sample = 0) : seed(seed), pixel(pixel), sample(sample), dim(0) {}
+
+  // high 32 bits of x * m, by the 32 x 32 -> 64 multiply on even & odd lanes (vpmuludq)
+  static u32x8 mulhi(u32x8 x, u32 m) {
+    u64x4 even = (u64x4) x & 0xffffffff, odd = (u64x4) x >> 32;
+    return (u32x8) ((even * m) >> 32) | ((u32x8) (odd * m) & u32x8{0, ~0u, 0, ~0u, 0, ~0u, 0, ~0u});
+  }
+
+  // out[w][l]: word w of counter {c0[l], c1[l], c2, c3}
+  static void philox(u32x8 c0, u32x8 c1, u32 c2, u32 c3, u32 k0, u32 k1, u32x8 out[4]) {
+    u32x8 x0 = c0, x1 = c1, x2 = u32x8{} + c2, x3 = u32x8{} + c3;
+    for (u32 r = 0; r < 10; ++r) {
+      u32x8 hi0 = mulhi(x0, 0xd2511f53), lo0 = x0 * 0xd2511f53;
+      u32x8 hi1 = mulhi(x2, 0xcd9e8d57), lo1 = x2 * 0xcd9e8d57;
+      x0 = hi1 ^ x1 ^ k0, x1 = lo1, x2 = hi0 ^ x3 ^ k1, x3 = lo0;
+      k0 += 0x9e3779b9, k1 += 0xbb67ae85;
+    }
+    out[0] = x0, out[1] = x1, out[2] = x2, out[3] = x3;
+  }
+
+  void next_sample() {
+    ++sample, dim = 0;
+  }
+
+  // fill buf with dimension 32 * block ~ 32 * block + 31
+  void refill(u32 block) {
+    u32x8 out[4];
+    philox(u32x8{0, 1, 2, 3, 4, 5, 6, 7} + block * 8, u32x8{} + sample, 0, 0, seed, pixel, out);
+    for (u32 w = 0; w < 4; ++w) {
+      buf[w] = (f32x8) ((out[w] >> 9) | 0x3f800000) - 1.0f;
+    }
+  }
+
+  // the next 8 dimensions, starting from a multiple of 8
+  f32x8 gen8() {
+    dim = (dim + 7) & ~7u;
+    if (dim % 32 == 0) { refill(dim / 32); }
+    f32x8 ret = buf[dim % 32 / 8];
+    dim += 8;
+    return ret;
+  }
+
+  f32 gen() {
+    u32 d = dim++ % 32;
+    if (d == 0) { refill(dim / 32); }
+    return buf[d / 8][d % 8];
+  }
+};
@@ -0,0 +1,76 @@
+// hero wavelength spectral sampling
+// https://cgg.mff.cuni.cz/~wilkie/Website/EGSR_14_files/WNDWH14HWSS.pdf
+// a path carries SPECTRAL_N wavelengths in the lanes of a f32x4, lane 0 is the hero, the others are rotated by
+// SPECTRAL_RANGE / SPECTRAL_N, so the wavelengths of a path are stratified
+// only the hero decides directions, the other lanes are terminated when the direction depends on the wavelength
+// colour matching functions: the multi-lobe fit of cie 1931 by Wyman et al., http://jcgt.org/published/0002/02/01/
+
+constexpr u32 SPECTRAL_N = 4, SPECTRAL_MIN = 380, SPECTRAL_RANGE = 400; // in nm
+
+inline f32 cie_lobe(f32 l, f32 mu, f32 s1, f32 s2) {
+  f32 t = (l - mu) / (l < mu ? s1 : s2);
+  return expf(-0.5f * t * t);
+}
+
+struct SpectralTable {
+  // to_rgb[i]: linear srgb of 1nm at SPECTRAL_MIN + i + 0.5, scaled so that a constant spectrum 1 becomes {1, 1, 1}
+  // basis[i]: the positive part of to_rgb[i] normalized to sum 1, reflectance(l) = rgb.dot(basis[l]),
+  // so that a white rgb becomes a constant spectrum
+  Vec3 to_rgb[SPECTRAL_RANGE], basis[SPECTRAL_RANGE];
+
+  SpectralTable() {
+    Vec3 sum{};
+    for (u32 i = 0; i < SPECTRAL_RANGE; ++i) {
+      f32 l = SPECTRAL_MIN + i + 0.5f;
+      f32 x = 1.056f * cie_lobe(l, 599.8f, 37.9f, 31.0f) + 0.362f * cie_lobe(l, 442.0f, 16.0f, 26.7f) -
+              0.065f * cie_lobe(l, 501.1f, 20.4f, 26.2f);
+      f32 y = 0.821f * cie_lobe(l, 568.8f, 46.9f, 40.5f) + 0.286f * cie_lobe(l, 530.9f, 16.3f, 31.1f);
+      f32 z = 1.217f * cie_lobe(l, 437.0f, 11.8f, 36.0f) + 0.681f * cie_lobe(l, 459.0f, 26.0f, 13.8f);
+      to_rgb[i] = Vec3{3.2406f * x - 1.5372f * y - 0.4986f * z, -0.9689f * x + 1.8758f * y + 0.0415f * z,
+                       0.0557f * x - 0.2040f * y + 1.0570f * z};
+      sum += to_rgb[i];
+    }
+    for (u32 i = 0; i < SPECTRAL_RANGE; ++i) {
+      Vec3 &c = to_rgb[i];
+      c = Vec3{c.x / sum.x, c.y / sum.y, c.z / sum.z} * SPECTRAL_RANGE;
+      Vec3 b{fmaxf(c.x, 0.0f), fmaxf(c.y, 0.0f), fmaxf(c.z, 0.0f)};
+      f32 s = b.x + b.y + b.z;
+      basis[i] = s > 0.0f ? b / s : Vec3{1.0f, 1.0f, 1.0f} / 3.0f;
+    }
+  }
+};
+
+const SpectralTable spectral_table;
+
+inline u32 spectral_bin(f32 l) {
+  return std::min(u32(l - SPECTRAL_MIN), SPECTRAL_RANGE - 1);
+}
+
+// u is uniform in [0, 1)
+inline f32x4 sample_wavelengths(f32 u) {
+  f32x4 ret;
+  for (u32 i = 0; i < SPECTRAL_N; ++i) {
+    f32 v = u + f32(i) / SPECTRAL_N;
+    ret[i] = SPECTRAL_MIN + (v < 1.0f ? v : v - 1.0f) * SPECTRAL_RANGE;
+  }
+  return ret;
+}
+
+// reflectance or emission of a rgb colour at each wavelength
+inline f32x4 spectrum(const Vec3 &rgb, const f32x4 &l) {
+  f32x4 ret;
+  for (u32 i = 0; i < SPECTRAL_N; ++i) { ret[i] = rgb.dot(spectral_table.basis[spectral_bin(l[i])]); }
+  return ret;
+}
+
+// radiance of each wavelength to rgb, the pdf of the wavelengths (1 / SPECTRAL_RANGE) is in to_rgb
+inline Vec3 spectral_to_rgb(const f32x4 &rad, const f32x4 &l) {
+  Vec3 ret{};
+  for (u32 i = 0; i < SPECTRAL_N; ++i) { ret += spectral_table.to_rgb[spectral_bin(l[i])] * rad[i]; }
+  return ret / SPECTRAL_N;
+}
+
+// cauchy's equation, l in nm, b in um^2
+inline f32x4 cauchy_ior(f32 a, f32 b, const f32x4 &l) {
+  return a + b * 1e6f / (l * l);
+}
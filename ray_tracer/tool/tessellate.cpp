@@ -0,0 +1,131 @@
+#include "tracer_util.hpp"
+#include <vector>
+
+// adaptive proxy mesh of a RotateBezier, read by BezierCurve::rotate_bezier_obj
+// usage: g++ -O2 tessellate.cpp && ./a.out curve.txt scale shift_x shift_y shift_z cam_x cam_y cam_z h [err] > mesh.obj
+// curve.txt, scale & shift are the same as load::bezier_curve(..).rotate_bezier(.., shift, scale)
+// cam & h are the camera position & image height of the world, err is the tolerated error in pixels
+// the curve parameter v is split where the chord deviates from the curve (by more than err pixels at the distance
+// from the camera) or the tangent turns too much, then each row gets its own number of segments in u by the same rules,
+// and neighbouring rows with different numbers are zipped together, so there are no cracks
+// vt is the parameter (u, v) of the vertex, for the starting point of newton iteration
+
+constexpr u32 INIT_V = 8;             // v is split into at least INIT_V intervals, so that no feature is skipped
+constexpr u32 MAX_DEPTH = 12;
+constexpr u32 MIN_U = 3, MAX_U = 1024;
+constexpr f64 MAX_ANGLE = 0.25;       // max turning of the normal in an edge, for shading normals & newton seeding
+constexpr f64 PIXEL_ANGLE = 0.5135;    // the height of the screen at distance 1, see gen_cpp_camera
+
+std::vector<f64> ps_x, ps_y;
+f64 shift_x, shift_y, shift_z, cam_x, cam_y, cam_z, pixel_err;
+
+// the scaled & shifted profile (x, y) at v, and its derivative
+void eval(f64 v, f64 &x, f64 &y, f64 &dx, f64 &dy) {
+  std::vector<f64> bx = ps_x, by = ps_y;
+  u32 n = bx.size();
+  for (u32 k = 1; k + 1 < n; ++k) {
+    for (u32 i = 0; i + k < n; ++i) { bx[i] += (bx[i + 1] - bx[i]) * v, by[i] += (by[i + 1] - by[i]) * v; }
+  }
+  dx = (bx[1] - bx[0]) * (n - 1), dy = (by[1] - by[0]) * (n - 1);
+  x = bx[0] + (bx[1] - bx[0]) * v, y = by[0] + (by[1] - by[0]) * v;
+}
+
+// the error tolerated at the nearest point of the circle of radius x at height y
+f64 tolerance(f64 x, f64 y) {
+  f64 h = sqrt((cam_x - shift_x) * (cam_x - shift_x) + (cam_z - shift_z) * (cam_z - shift_z)) - fabs(x);
+  f64 dist = fmax(sqrt(h * h + (cam_y - y) * (cam_y - y)), 1e-3);
+  return pixel_err * PIXEL_ANGLE * dist;
+}
+
+void split_v(f64 v0, f64 v1, u32 depth, std::vector<f64> &vs) {
+  f64 x0, y0, dx0, dy0, x1, y1, dx1, dy1;
+  eval(v0, x0, y0, dx0, dy0);
+  eval(v1, x1, y1, dx1, dy1);
+  bool split = false;
+  if (depth < MAX_DEPTH) {
+    // the angle between the tangents
+    f64 c = (dx0 * dx1 + dy0 * dy1) / sqrt((dx0 * dx0 + dy0 * dy0) * (dx1 * dx1 + dy1 * dy1) + 1e-30);
+    split = c < cos(MAX_ANGLE);
+    // the distance from the curve to the chord at 1/4, 1/2, 3/4
+    f64 cx = x1 - x0, cy = y1 - y0, len = sqrt(cx * cx + cy * cy) + 1e-30;
+    f64 tol = fmin(tolerance(x0, y0), tolerance(x1, y1));
+    for (u32 i = 1; i < 4 && !split; ++i) {
+      f64 x, y, dx, dy;
+      eval(v0 + (v1 - v0) * i / 4, x, y, dx, dy);
+      split = fabs((x - x0) * cy - (y - y0) * cx) / len > tol;
+    }
+  }
+  if (split) {
+    split_v(v0, (v0 + v1) / 2, depth + 1, vs);
+    split_v((v0 + v1) / 2, v1, depth + 1, vs);
+  } else {
+    vs.push_back(v1);
+  }
+}
+
+// the number of segments of the circle of radius x, by the sagitta r (1 - cos(pi / n)) & the turning of the normal
+u32 split_u(f64 x, f64 y, f64 dx, f64 dy) {
+  f64 r = fabs(x), tol = tolerance(x, y);
+  f64 n = r > tol ? PI / acos(1 - tol / r) : 0;
+  // the normal (-dy, dx) turns around the axis by its horizontal part
+  n = fmax(n, 2 * PI * fabs(dy) / sqrt(dx * dx + dy * dy + 1e-30) / MAX_ANGLE);
+  return std::min(std::max(u32(ceil(n)), MIN_U), MAX_U);
+}
+
+int main(int argc, char **argv) {
+  if (argc != 10 && argc != 11) {
+    fprintf(stderr, "usage: ./a.out curve.txt scale shift_x shift_y shift_z cam_x cam_y cam_z h [err]\n");
+    exit(-1);
+  }
+  FILE *f = fopen(argv[1], "r");
+  if (!f) {
+    fprintf(stderr, "cannot open %s\n", argv[1]);
+    exit(-1);
+  }
+  f64 scale = atof(argv[2]), x, y;
+  while (fscanf(f, "%lf %lf", &x, &y) == 2) { ps_x.push_back(x * scale), ps_y.push_back(y * scale); }
+  fclose(f);
+  shift_x = atof(argv[3]), shift_y = atof(argv[4]), shift_z = atof(argv[5]);
+  cam_x = atof(argv[6]), cam_y = atof(argv[7]), cam_z = atof(argv[8]);
+  pixel_err = (argc == 11 ? atof(argv[10]) : 0.5) / atof(argv[9]);
+  for (f64 &p : ps_y) { p += shift_y; }
+
+  std::vector<f64> vs{0.0};
+  for (u32 i = 0; i < INIT_V; ++i) { split_v(f64(i) / INIT_V, f64(i + 1) / INIT_V, 0, vs); }
+  // rows of vertices, row i has ns[i] + 1 vertices (the first & the last are at the seam, with u = 0 & 1)
+  std::vector<u32> ns, first;
+  u32 n_vertex = 0, n_face = 0;
+  for (f64 v : vs) {
+    f64 dx, dy;
+    eval(v, x, y, dx, dy);
+    u32 n = split_u(x, y, dx, dy);
+    ns.push_back(n), first.push_back(n_vertex + 1); // obj is 1 indexed
+    n_vertex += n + 1;
+    // the normal is (d/dv) x (d/du), like Curve::to_mesh
+    f64 nx = -dy, ny = dx, inv = (x < 0 ? -1 : 1) / sqrt(dx * dx + dy * dy + 1e-30);
+    // the polygon of the row circumscribes the circle, so that rays near the silhouette still hit the proxy
+    f64 r = x / cos(PI / n);
+    for (u32 i = 0; i <= n; ++i) {
+      f64 th = 2 * PI * i / n, c = cos(th), s = sin(th);
+      printf("v %f %f %f\n", r * c + shift_x, y, -r * s + shift_z);
+      printf("vt %f %f\n", f64(i) / n, v);
+      printf("vn %f %f %f\n", nx * c * inv, ny * inv, -nx * s * inv);
+    }
+  }
+  for (u32 r = 0; r + 1 < vs.size(); ++r) {
+    // zip row r (a) & row r + 1 (b), always advancing the one whose next vertex has a smaller u
+    u32 na = ns[r], nb = ns[r + 1], i = 0, j = 0;
+    while (i < na || j < nb) {
+      u32 a = first[r] + i, b = first[r + 1] + j;
+      if (j == nb || (i < na && u64(i + 1) * nb < u64(j + 1) * na)) {
+        printf("f %d/%d/%d %d/%d/%d %d/%d/%d\n", a, a, a, a + 1, a + 1, a + 1, b, b, b);
+        ++i;
+      } else {
+        printf("f %d/%d/%d %d/%d/%d %d/%d/%d\n", a, a, a, b + 1, b + 1, b + 1, b, b, b);
+        ++j;
+      }
+      ++n_face;
+    }
+  }
+  fprintf(stderr, "%d rows, %d vertices, %d triangles\n", u32(vs.size()), n_vertex, n_face);
+}
@@ -2,6 +2,7 @@
 #include <cstdlib>
 #include <cstdio>
 #include <cstring>
+#include <algorithm>
 
 #ifdef __CUDACC__
 #define DEVICE __device__
@@ -20,6 +21,7 @@ using u8 = unsigned char;
 using u32 = unsigned;
 using u64 = unsigned long long;
 using f32 = float;
+using f64 = double;
 
 constexpr f32 EPS = 1.0f / 128.0f;
 constexpr f32 PI = 3.14159265358979323846264338327950288f;
@@ -151,6 +153,27 @@ struct Ray {
   Vec3 o, d;
 };
 
+// ray cones for the level of detail of textures, see Texture Level of Detail Strategies for Real-Time Ray Tracing
+// w is the width at the origin of the ray, surfaces are taken as flat (reflection & refraction keep the spread),
+// a diffuse bounce widens the spread to at least CONE_DIFFUSE_SPREAD
+constexpr f32 CONE_DIFFUSE_SPREAD = 0.1f;
+
+struct RayCone {
+  f32 w, spread;
+
+  DEVICE f32 width(f32 t) const { return w + spread * t; }
+};
+
+// power heuristic of the strategy with pdf a against the one with pdf b
+DEVICE inline f32 mis_weight(f32 a, f32 b) {
+  return a * a / (a * a + b * b);
+}
+
+// relative luminance of linear rgb, the same as luminance in src/codegen.rs
+DEVICE inline f32 luminance(const Vec3 &c) {
+  return 0.2126f * c.x + 0.7152f * c.y + 0.0722f * c.z;
+}
+
 struct XorShiftRNG {
   u32 seed;
 
@@ -164,6 +187,19 @@ struct XorShiftRNG {
   }
 };
 
+// traversal statistics of each pixel, compiled in by -DTRACE_STATS (not on gpu), TRACE_STAT costs nothing otherwise
+// the counters of the current pixel are in trace_stats of its thread, gen_cpp_pixel_loop resets & collects them
+#if defined(TRACE_STATS) && !defined(__CUDACC__)
+struct TraceStats {
+  u64 interior, leaf, tri, overflow, restart, newton_iter, newton_fail, path;
+};
+
+thread_local TraceStats trace_stats;
+#define TRACE_STAT(field, n) (trace_stats.field += (n))
+#else
+#define TRACE_STAT(field, n) ((void) 0)
+#endif
+
 struct HitRes {
   f32 t;
   Vec3 norm;
@@ -193,6 +229,18 @@ struct TriMat {
   f32 m20, m21, m22, m23;
 };
 
+// t is in [EPS, t_max], (u, v) are the weights of the 2nd & 3rd vertices
+DEVICE inline bool trimat_hit(const TriMat &m, const Ray &ray, f32 t_max, f32 &t, f32 &u, f32 &v) {
+  f32 dz = m.m20 * ray.d.x + m.m21 * ray.d.y + m.m22 * ray.d.z;
+  f32 oz = m.m20 * ray.o.x + m.m21 * ray.o.y + m.m22 * ray.o.z + m.m23;
+  t = -oz / dz;
+  if (t < EPS || t > t_max) { return false; }
+  Vec3 hp{ray.o.x + t * ray.d.x, ray.o.y + t * ray.d.y, ray.o.z + t * ray.d.z};
+  u = m.m00 * hp.x + m.m01 * hp.y + m.m02 * hp.z + m.m03;
+  v = m.m10 * hp.x + m.m11 * hp.y + m.m12 * hp.z + m.m13;
+  return !(u < 0.0f || v < 0.0f || u + v > 1.0f);
+}
+
 struct KDNode {
   Vec3 min, max;
   union {
@@ -207,14 +255,20 @@ struct KDNode {
   };
 };
 
+// the short stack size, can be set by -DKD_STACK=n
+#ifndef KD_STACK
+#define KD_STACK 16
+#endif
+
 // "short stack" algorithm
 // http://citeseerx.ist.psu.edu/viewdoc/download?doi=10.1.1.83.2823&rep=rep1&type=pdf
 // if col.x < 0.0, rt should contain color info(after ptr n)
+// return true if a triangle closer than res.t is hit
 DEVICE inline bool kd_node_hit(const KDNode *__restrict__ rt, const Ray &ray, HitRes &res, u32 text, const Vec3 &col) {
   struct {
     u32 off;
     f32 t_min, t_max;
-  } stk[16];
+  } stk[KD_STACK];
   u32 top = 0;
   const char *__restrict__ rt_b = (const char *) rt;
   Vec3 inv_d{1.0f / ray.d.x, 1.0f / ray.d.y, 1.0f / ray.d.z};
@@ -225,6 +279,7 @@ DEVICE inline bool kd_node_hit(const KDNode *__restrict__ rt, const Ray &ray, Hi
     t_max = root_min;
     while (t_max < root_max) {
       if (top == 0) {
+        TRACE_STAT(restart, t_max > root_min);
         t_min = t_max;
         t_max = root_max;
         x = rt;
@@ -239,19 +294,14 @@ DEVICE inline bool kd_node_hit(const KDNode *__restrict__ rt, const Ray &ray, Hi
       while (BB_HIT_RAY(x->min, x->max, ray.o, inv_d)) {
         if (x->len >> 31) { // leaf
           u32 len = x->len & 0x7fffffff;
+          TRACE_STAT(leaf, 1);
+          TRACE_STAT(tri, len);
           const TriMat *__restrict__ ms = x->ms;
           const Vec3 *__restrict__ n = (const Vec3 *) (ms + len);
-          const Vec2 *__restrict__ uv = (const Vec2 *) (n + len);
+          const Vec2 *__restrict__ uv = (const Vec2 *) (n + len * 3);
           for (u32 i = 0; i < len; ++i) {
-            TriMat m = ms[i];
-            f32 dz = m.m20 * ray.d.x + m.m21 * ray.d.y + m.m22 * ray.d.z;
-            f32 oz = m.m20 * ray.o.x + m.m21 * ray.o.y + m.m22 * ray.o.z + m.m23;
-            f32 t = -oz / dz;
-            if (t < EPS || t > res.t) { continue; }
-            Vec3 hp{ray.o.x + t * ray.d.x, ray.o.y + t * ray.d.y, ray.o.z + t * ray.d.z};
-            f32 u = m.m00 * hp.x + m.m01 * hp.y + m.m02 * hp.z + m.m03;
-            f32 v = m.m10 * hp.x + m.m11 * hp.y + m.m12 * hp.z + m.m13;
-            if (u < 0.0f || v < 0.0f || u + v > 1.0f) { continue; }
+            f32 t, u, v;
+            if (!trimat_hit(ms[i], ray, res.t, t, u, v)) { continue; }
             res.t = t;
             res.norm = n[i * 3] * (1.0f - u - v) + n[i * 3 + 1] * u + n[i * 3 + 2] * v;
             res.text = text;
@@ -262,8 +312,11 @@ DEVICE inline bool kd_node_hit(const KDNode *__restrict__ rt, const Ray &ray, Hi
             }
             hit = true;
           }
+          // triangles may cross the leaf, a hit after t_max may still be beaten by the next leaves
+          if (hit && res.t <= t_max) { return true; }
           break;
         } else { // internal
+          TRACE_STAT(interior, 1);
           u32 sp_d = x->sp_d;
           f32 sp = x->sp;
           f32 t_sp = (sp - ray.o[sp_d]) / ray.d[sp_d];
@@ -278,6 +331,12 @@ DEVICE inline bool kd_node_hit(const KDNode *__restrict__ rt, const Ray &ray, Hi
           } else if (t_sp >= t_max) {
             x = (const KDNode *) (rt_b + fst);
           } else {
+            if (top == KD_STACK) {
+              // drop the farthest entry, a restart finds it again
+              TRACE_STAT(overflow, 1);
+              for (u32 i = 1; i < KD_STACK; ++i) { stk[i - 1] = stk[i]; }
+              --top;
+            }
             stk[top++] = {snd, t_sp, t_max};
             x = (const KDNode *) (rt_b + fst);
             t_max = t_sp;
@@ -290,19 +349,365 @@ DEVICE inline bool kd_node_hit(const KDNode *__restrict__ rt, const Ray &ray, Hi
       }
     }
   }
-  return false;
+  return hit;
 }
 
 // assume polynomial coef is stored in reversed order
 #define EVAL_BEZIER(ps, t, x, y) \
   do {                           \
-    x = 0, y = 0;                \
+    x = decltype(x){};           \
+    y = decltype(y){};           \
     for (const auto &p : ps) {   \
       x = x * t + p[0];          \
       y = y * t + p[1];          \
     }                            \
   } while (0);
 
+#ifndef __CUDACC__
+typedef f32 f32x4 __attribute__((vector_size(16)));
+
+// power basis of a bezier curve at compile time, from the control points in the scene code
+// the conversion sums large binomials with alternating signs, so it is done in double-double,
+// the products are exact by dekker's split (fma is not constexpr)
+struct DD {
+  f64 hi, lo;
+};
+
+constexpr DD dd_two_sum(f64 a, f64 b) {
+  f64 s = a + b, bb = s - a;
+  return DD{s, (a - (s - bb)) + (b - bb)};
+}
+
+constexpr DD dd_two_prod(f64 a, f64 b) {
+  f64 p = a * b, ca = 134217729.0 * a, cb = 134217729.0 * b;
+  f64 ah = ca - (ca - a), al = a - ah, bh = cb - (cb - b), bl = b - bh;
+  return DD{p, ((ah * bh - p) + ah * bl + al * bh) + al * bl};
+}
+
+constexpr DD dd_add(DD a, DD b) {
+  DD s = dd_two_sum(a.hi, b.hi);
+  f64 lo = s.lo + a.lo + b.lo, hi = s.hi + lo;
+  return DD{hi, lo - (hi - s.hi)};
+}
+
+template <u32 N> // #control point
+struct BezierPoly {
+  f32 ps[N][2], der[N - 1][2]; // power basis coefficients of the curve & its derivative, for EVAL_BEZIER
+};
+
+template <u32 N>
+constexpr BezierPoly<N> bezier_poly(const f64 (&cp)[N][2]) {
+  // coefficient of v^j: sum of cp[i] C(n, i) C(n - i, j - i) (-1)^(j - i), the integers are exact in f64 for n < 30
+  u64 c[N][N]{};
+  for (u32 i = 0; i < N; ++i) {
+    c[i][0] = 1;
+    for (u32 j = 1; j <= i; ++j) { c[i][j] = c[i - 1][j - 1] + c[i - 1][j]; }
+  }
+  DD coef[N][2]{};
+  for (u32 i = 0; i < N; ++i) {
+    for (u32 j = i; j < N; ++j) {
+      f64 k = f64(c[N - 1][i] * c[N - 1 - i][j - i]) * ((j - i) % 2 ? -1.0 : 1.0);
+      for (u32 a = 0; a < 2; ++a) { coef[j][a] = dd_add(coef[j][a], dd_two_prod(cp[i][a], k)); }
+    }
+  }
+  BezierPoly<N> ret{};
+  for (u32 j = 0; j < N; ++j) {
+    for (u32 a = 0; a < 2; ++a) {
+      ret.ps[N - 1 - j][a] = f32(coef[j][a].hi + coef[j][a].lo);
+      if (j > 0) { ret.der[N - 1 - j][a] = f32((coef[j][a].hi + coef[j][a].lo) * j); }
+    }
+  }
+  return ret;
+}
+
+// newton iteration for the intersection of a ray & a surface of revolution
+// the surface is (bx(v) cos u, by(v), -bx(v) sin u), (bx, by) = EVAL_BEZIER(curve.ps, v), o is relative to the axis
+// solve surface(u, v) = o + t d by cramer's rule (no pivot, so no trouble at sin u = 0 or cos u = 0)
+// the same step runs on a f32, or on 4 starting points in the lanes of a f32x4
+constexpr u32 NEWTON_MAX_ITER = 8;
+constexpr f32 NEWTON_EPS2 = 1e-6f; // converged when the squared distance between the ray & the surface is less
+
+inline void newton_sincos(f32 x, f32 &s, f32 &c) { sincosf(x, &s, &c); }
+
+inline void newton_sincos(const f32x4 &x, f32x4 &s, f32x4 &c) {
+  for (u32 i = 0; i < 4; ++i) {
+    f32 si, ci;
+    sincosf(x[i], &si, &ci);
+    s[i] = si, c[i] = ci;
+  }
+}
+
+// return the squared residual before the step, n is the normal (not normalized) before the step
+template <typename T, u32 N>
+inline T newton_step(const BezierPoly<N> &curve, const Vec3 &o, const Vec3 &d, T &u, T &v, T &t, T (&n)[3]) {
+  T bx, by, dbx, dby, s, c;
+  EVAL_BEZIER(curve.ps, v, bx, by);
+  EVAL_BEZIER(curve.der, v, dbx, dby);
+  newton_sincos(u, s, c);
+  // a = d/du (its y is 0), b = d/dv, r = residual, the jacobian is (a, b, -d)
+  T ax = -bx * s, az = -bx * c;
+  T bx_ = dbx * c, by_ = dby, bz = -dbx * s;
+  T rx = bx * c - o.x - t * d.x, ry = by - o.y - t * d.y, rz = -bx * s - o.z - t * d.z;
+  // n = b x a, det(a, b, -d) = d.n, e = d x r
+  n[0] = by_ * az, n[1] = bz * ax - bx_ * az, n[2] = -by_ * ax;
+  T inv_det = 1.0f / (d.x * n[0] + d.y * n[1] + d.z * n[2]);
+  T ex = d.y * rz - d.z * ry, ey = d.z * rx - d.x * rz, ez = d.x * ry - d.y * rx;
+  u += (bx_ * ex + by_ * ey + bz * ez) * inv_det;
+  v -= (ax * ex + az * ez) * inv_det;
+  t += (rx * n[0] + ry * n[1] + rz * n[2]) * inv_det;
+  return rx * rx + ry * ry + rz * rz;
+}
+
+inline bool newton_accept(f32 &u, f32 v, f32 t, f32 t_max) {
+  u -= 2.0f * PI * floorf(u * (0.5f / PI));
+  return v >= 0.0f && v <= 1.0f && t > EPS && t < t_max;
+}
+
+// u, v, t: the starting point from the proxy mesh, and the result if it returns true
+// the starting point is tried first, if it diverges, its 4 neighbours (u +- du, v +- dv) are tried in simd lanes
+// only hits in v in [0, 1] & t in (EPS, t_max) are accepted
+template <u32 N>
+bool rotate_bezier_hit(const BezierPoly<N> &curve, const Vec3 &o, const Vec3 &d, f32 du, f32 dv, f32 t_max,
+                       f32 &u, f32 &v, f32 &t, Vec3 &norm) {
+  {
+    f32 u1 = u, v1 = v, t1 = t, n[3], prev = INFINITY;
+    for (u32 i = 0; i < NEWTON_MAX_ITER; ++i) {
+      f32 err = newton_step(curve, o, d, u1, v1, t1, n);
+      TRACE_STAT(newton_iter, 1);
+      if (err < NEWTON_EPS2) {
+        if (!newton_accept(u1, v1, t1, t_max)) { break; }
+        u = u1, v = v1, t = t1, norm = Vec3{n[0], n[1], n[2]};
+        return true;
+      }
+      // diverging or leaving the curve
+      if (!(err < 4.0f * prev) || v1 < -0.5f || v1 > 1.5f) { break; }
+      prev = err;
+    }
+  }
+  f32x4 u4{u + du, u - du, u, u}, v4{v, v, v + dv, v - dv}, t4 = f32x4{} + t, n4[3], prev = f32x4{} + INFINITY;
+  u32 active = 0xf;
+  bool hit = false;
+  for (u32 i = 0; i < NEWTON_MAX_ITER && active; ++i) {
+    f32x4 err = newton_step(curve, o, d, u4, v4, t4, n4);
+    TRACE_STAT(newton_iter, 1);
+    for (u32 j = 0; j < 4; ++j) {
+      if (!(active >> j & 1)) { continue; }
+      f32 uj = u4[j];
+      if (err[j] < NEWTON_EPS2) {
+        active &= ~(1u << j);
+        if (newton_accept(uj, v4[j], t4[j], t_max)) {
+          u = uj, v = v4[j], t = t_max = t4[j], norm = Vec3{n4[0][j], n4[1][j], n4[2][j]};
+          hit = true;
+        }
+      } else if (!(err[j] < 4.0f * prev[j]) || v4[j] < -0.5f || v4[j] > 1.5f) {
+        active &= ~(1u << j);
+      }
+    }
+    prev = err;
+  }
+  TRACE_STAT(newton_fail, !hit);
+  return hit;
+}
+
+// direct intersection of a ray & the same surface of revolution, without proxy mesh
+// a point of the ray at height by(v) is on the surface iff its distance to the axis is |bx(v)|, eliminating t gives
+// F(v) = A (by - oy)^2 + B (by - oy) + C - dy^2 bx^2 = 0, A = dx^2 + dz^2, B = 2 (ox dx + oz dz) dy, C = (ox^2 + oz^2) dy^2
+// F is built in bernstein form over v in [0, 1], intervals are subdivided until their control polygon changes sign
+// once (then there is exactly one root), and the root is refined by regula falsi (illinois)
+constexpr u32 REV_MAX_DEPTH = 20;
+
+template <u32 N> // #coefficient, 2 * degree of the curve + 1
+struct RevolutionPoly {
+  f64 by2[N], by[N], bx2[N]; // bernstein coefficients of by^2, by (degree elevated) & bx^2
+  f32 y_min, y_max, r_max;   // the bounding cylinder
+};
+
+template <u32 N>
+inline f64 bernstein_eval(const f64 *b, f64 x) {
+  // horner in x / (1 - x), from the other end for x > 0.5 so that the ratio stays <= 1
+  bool flip = x > 0.5;
+  f64 y = flip ? 1.0 - x : x, r = y / (1.0 - y), c = 1.0, p = 1.0, sum = 0.0;
+  for (u32 i = 0; i < N; ++i) {
+    sum += c * p * b[flip ? N - 1 - i : i];
+    c = c * (N - 1 - i) / (i + 1), p *= r;
+  }
+  f64 scale = 1.0;
+  for (u32 i = 1; i < N; ++i) { scale *= 1.0 - y; }
+  return sum * scale;
+}
+
+// the root in [0, 1] of a polynomial whose first & last coefficients have different signs
+template <u32 N>
+inline f64 bernstein_root(const f64 *b) {
+  f64 x0 = 0.0, x1 = 1.0, f0 = b[0], f1 = b[N - 1], x = 0.5;
+  int side = 0;
+  for (u32 i = 0; i < 64 && x1 - x0 > 1e-10; ++i) {
+    x = (x0 * f1 - x1 * f0) / (f1 - f0);
+    f64 fx = bernstein_eval<N>(b, x);
+    if ((fx < 0.0) == (f1 < 0.0)) {
+      x1 = x, f1 = fx;
+      if (side == -1) { f0 *= 0.5; }
+      side = -1;
+    } else if ((fx < 0.0) == (f0 < 0.0)) {
+      x0 = x, f0 = fx;
+      if (side == 1) { f1 *= 0.5; }
+      side = 1;
+    } else {
+      break;
+    }
+  }
+  return x;
+}
+
+// o is relative to the axis, u, v, t & norm (not normalized) are set if it returns true
+template <u32 N, u32 M>
+bool revolution_hit(const RevolutionPoly<N> &rev, const BezierPoly<M> &curve, const Vec3 &o, Vec3 d, f32 t_max,
+                    f32 &u, f32 &v, f32 &t, Vec3 &norm) {
+  // d.y == 0 would make the roots of F double roots, which don't change sign
+  if (fabsf(d.y) < 1e-7f) { d.y = copysignf(1e-7f, d.y); }
+  // the bounding cylinder
+  f32 a = d.x * d.x + d.z * d.z, b = o.x * d.x + o.z * d.z, c = o.x * o.x + o.z * o.z;
+  f32 t0 = (rev.y_min - o.y) / d.y, t1 = (rev.y_max - o.y) / d.y;
+  if (t0 > t1) { std::swap(t0, t1); }
+  t0 = fmaxf(t0, EPS), t1 = fminf(t1, t_max);
+  f32 disc = b * b - a * (c - rev.r_max * rev.r_max);
+  if (disc < 0.0f) { return false; }
+  t0 = fmaxf(t0, (-b - sqrtf(disc)) / a), t1 = fminf(t1, (-b + sqrtf(disc)) / a);
+  if (t0 >= t1) { return false; }
+  struct Seg {
+    f64 b[N];
+    f64 lo, hi;
+    u32 depth;
+  } stk[REV_MAX_DEPTH + 1];
+  f64 A = a, B = 2.0 * b * d.y, C = f64(c) * d.y * d.y, oy = o.y, k1 = B - 2.0 * A * oy, k0 = (A * oy - B) * oy + C;
+  for (u32 k = 0; k < N; ++k) { stk[0].b[k] = A * rev.by2[k] + k1 * rev.by[k] + k0 - f64(d.y) * d.y * rev.bx2[k]; }
+  stk[0].lo = 0.0, stk[0].hi = 1.0, stk[0].depth = 0;
+  bool hit = false;
+  for (u32 top = 1; top;) {
+    Seg &s = stk[--top];
+    u32 change = 0;
+    for (u32 k = 0; k + 1 < N; ++k) { change += (s.b[k] < 0.0) != (s.b[k + 1] < 0.0); }
+    if (change == 0) { continue; }
+    if (change == 1 || s.depth == REV_MAX_DEPTH) {
+      // at the max depth, several roots are too close to be told apart
+      f64 x = (s.b[0] < 0.0) != (s.b[N - 1] < 0.0) ? bernstein_root<N>(s.b) : 0.5;
+      f32 v1 = s.lo + x * (s.hi - s.lo), bx, by, t1;
+      EVAL_BEZIER(curve.ps, v1, bx, by);
+      if (a > d.y * d.y) {
+        // the ray is more horizontal, take t from the distance to the axis, the root whose height is closer to by
+        f32 sq = sqrtf(fmaxf(b * b - a * (c - bx * bx), 0.0f)), ta = (-b - sq) / a, tb = (-b + sq) / a;
+        t1 = fabsf(o.y + ta * d.y - by) <= fabsf(o.y + tb * d.y - by) ? ta : tb;
+      } else {
+        t1 = (by - o.y) / d.y;
+      }
+      if (t1 > EPS && t1 < t_max) { t_max = t = t1, v = v1, hit = true; }
+      continue;
+    }
+    // split at the middle by de casteljau, the right half goes to stk[top + 1], then the left half replaces s
+    Seg &r = stk[top + 1];
+    f64 tmp[N];
+    std::copy(s.b, s.b + N, tmp);
+    for (u32 k = 0; k < N; ++k) {
+      r.b[N - 1 - k] = tmp[N - 1 - k];
+      s.b[k] = tmp[0];
+      for (u32 i = 0; i + k + 1 < N; ++i) { tmp[i] = (tmp[i] + tmp[i + 1]) * 0.5; }
+    }
+    f64 mid = (s.lo + s.hi) * 0.5;
+    r.lo = mid, r.hi = s.hi, r.depth = ++s.depth;
+    s.hi = mid;
+    std::swap(s, r);
+    top += 2;
+  }
+  if (!hit) { return false; }
+  Vec3 p = o + d * t;
+  f32 bx, by, dbx, dby;
+  EVAL_BEZIER(curve.ps, v, bx, by);
+  EVAL_BEZIER(curve.der, v, dbx, dby);
+  f32 cos = p.x / bx, sin = -p.z / bx;
+  u = atan2f(sin, cos);
+  u = u < 0.0f ? u + 2.0f * PI : u;
+  // b x a as in newton_step
+  norm = Vec3{-dby * cos, dbx, dby * sin} * bx;
+  return true;
+}
+
+// 8 bit rgb textures with mip chains, level l + 1 is level l halved (rounded up) by a box filter, down to 1 x 1
+// a level is in tiles of TEX_TILE x TEX_TILE texels (3 cache lines), with the texels of a tile in morton order,
+// so that the lookups of neighbouring rays are in a few cache lines; a level is padded to whole tiles
+// texels are decoded by the same gamma as load::texture
+constexpr u32 TEX_TILE = 8, TEX_MAX_LEVEL = 16;
+
+struct GammaLUT {
+  f32 v[256];
+
+  GammaLUT() {
+    for (u32 i = 0; i < 256; ++i) { v[i] = powf(i / 255.0f, 2.2f); }
+  }
+};
+
+const GammaLUT gamma_lut;
+
+template <u32 W, u32 H>
+struct TexLevels {
+  u32 n, w[TEX_MAX_LEVEL], h[TEX_MAX_LEVEL], offset[TEX_MAX_LEVEL]; // offset in bytes
+
+  constexpr TexLevels() : n(0), w{}, h{}, offset{} {
+    for (u32 x = W, y = H, off = 0;; x = (x + 1) / 2, y = (y + 1) / 2) {
+      w[n] = x, h[n] = y, offset[n++] = off;
+      if (x == 1 && y == 1) { break; }
+      off += (x + TEX_TILE - 1) / TEX_TILE * ((y + TEX_TILE - 1) / TEX_TILE) * TEX_TILE * TEX_TILE * 3;
+    }
+  }
+};
+
+template <u32 W, u32 H>
+constexpr TexLevels<W, H> TEX_LEVELS{};
+
+// interleave the low 3 bits of x & y
+inline u32 tex_morton(u32 x, u32 y) {
+  x = (x | x << 2) & 0x33, x = (x | x << 1) & 0x55;
+  y = (y | y << 2) & 0x33, y = (y | y << 1) & 0x55;
+  return x | y << 1;
+}
+
+inline Vec3 tex_texel(const u8 *level, u32 w, u32 x, u32 y) {
+  u32 tile = y / TEX_TILE * ((w + TEX_TILE - 1) / TEX_TILE) + x / TEX_TILE;
+  const u8 *p = level + 3 * (tile * TEX_TILE * TEX_TILE + tex_morton(x % TEX_TILE, y % TEX_TILE));
+  return Vec3{gamma_lut.v[p[0]], gamma_lut.v[p[1]], gamma_lut.v[p[2]]};
+}
+
+// texels out of the level wrap around if WRAP, otherwise they are clamped
+template <bool WRAP>
+inline Vec3 tex_bilinear(const u8 *level, u32 w, u32 h, f32 u, f32 v) {
+  f32 x = u * w - 0.5f, y = v * h - 0.5f, x0 = floorf(x), y0 = floorf(y), fx = x - x0, fy = y - y0;
+  auto at = [=](f32 i, f32 j) {
+    u32 xi = WRAP ? u32(i - w * floorf(i / w)) : u32(fminf(fmaxf(i, 0.0f), w - 1.0f));
+    u32 yi = WRAP ? u32(j - h * floorf(j / h)) : u32(fminf(fmaxf(j, 0.0f), h - 1.0f));
+    return tex_texel(level, w, std::min(xi, w - 1), std::min(yi, h - 1));
+  };
+  return (at(x0, y0) * (1.0f - fx) + at(x0 + 1.0f, y0) * fx) * (1.0f - fy) +
+         (at(x0, y0 + 1.0f) * (1.0f - fx) + at(x0 + 1.0f, y0 + 1.0f) * fx) * fy;
+}
+
+// the level of a lookup, from the width of the ray cone at the hit, the cosine between the ray & the normal (the
+// footprint is stretched by 1 / cos), and the texels per unit length at level 0
+inline f32 tex_lod(f32 width, f32 cos, f32 density) {
+  return log2f(width * density / fmaxf(fabsf(cos), 1e-2f));
+}
+
+// trilinear lookup
+template <u32 W, u32 H, bool WRAP>
+inline Vec3 tex_fetch(const u8 *img, f32 u, f32 v, f32 lod) {
+  constexpr const TexLevels<W, H> &L = TEX_LEVELS<W, H>;
+  lod = fminf(fmaxf(lod, 0.0f), L.n - 1.0f);
+  u32 l = u32(lod);
+  f32 f = lod - l;
+  Vec3 c = tex_bilinear<WRAP>(img + L.offset[l], L.w[l], L.h[l], u, v);
+  if (f > 0.0f) { c = c * (1.0f - f) + tex_bilinear<WRAP>(img + L.offset[l + 1], L.w[l + 1], L.h[l + 1], u, v) * f; }
+  return c;
+}
+#endif
+
 /*
 Copyright (C) 2017 Milo Yip. All rights reserved.
 
@@ -388,4 +793,170 @@ inline void output_png(const Vec3 *o, u32 w, u32 h, const char *path) {
   free(png);
 }
 
+#ifndef __CUDACC__
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// live telemetry of the pixel loop of CPU backends (gen_cpp_pixel_loop)
+// each thread counts samples, rays (scene queries), cycles in the queries & busy cycles in its own cache line, with
+// no locked instructions as it is the only writer; a monitor thread sums the slots every TELEMETRY_PERIOD seconds for
+// the progress, rays/s & eta, and the totals with the utilization of each thread go to a json file at the end
+// shading is the busy time outside of the queries
+constexpr u32 TELEMETRY_MAX_THREAD = 256;
+constexpr f64 TELEMETRY_PERIOD = 0.5;
+
+inline u64 telemetry_clock() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+struct alignas(64) TelemetrySlot {
+  std::atomic<u64> samples, rays, hit_cycles, busy_cycles;
+};
+
+inline void telemetry_add(std::atomic<u64> &x, u64 n) {
+  x.store(x.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+struct Telemetry {
+  TelemetrySlot slots[TELEMETRY_MAX_THREAD];
+  std::atomic<u32> n_thread{0};
+  std::atomic<bool> running{false};
+  u64 total, start_clock;
+  std::chrono::steady_clock::time_point start_time;
+  std::thread monitor;
+
+  u64 sum(std::atomic<u64> TelemetrySlot::*field) const {
+    u64 ret = 0;
+    for (u32 i = 0; i < std::min(n_thread.load(), TELEMETRY_MAX_THREAD); ++i) { ret += (slots[i].*field).load(std::memory_order_relaxed); }
+    return ret;
+  }
+
+  f64 elapsed() const {
+    return std::chrono::duration<f64>(std::chrono::steady_clock::now() - start_time).count();
+  }
+
+  void start(u64 total_samples) {
+    total = total_samples, start_clock = telemetry_clock(), start_time = std::chrono::steady_clock::now();
+    running = true;
+    monitor = std::thread([this] {
+      f64 next = TELEMETRY_PERIOD, prev_time = 0.0;
+      u64 prev_rays = 0;
+      while (running) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        f64 time = elapsed();
+        if (time < next) { continue; }
+        next = time + TELEMETRY_PERIOD;
+        u64 samples = sum(&TelemetrySlot::samples), rays = sum(&TelemetrySlot::rays);
+        f64 done = total ? f64(samples) / total : 1.0, eta = done > 0.0 ? time * (1.0 - done) / done : 0.0;
+        fprintf(stderr, "\rrendering %5.2f%%  %8.3f Mrays/s  eta %5.0fs ", 100.0 * done,
+                (rays - prev_rays) / (time - prev_time) * 1e-6, eta);
+        prev_rays = rays, prev_time = time;
+      }
+    });
+  }
+
+  // the json goes next to the image, image.png -> image_metrics.json
+  void finish(const char *path) {
+    running = false;
+    monitor.join();
+    f64 wall = elapsed(), cycle = wall / f64(telemetry_clock() - start_clock);
+    u64 rays = sum(&TelemetrySlot::rays);
+    fprintf(stderr, "\rrendered in %.2fs, %.3f Mrays/s%30s\n", wall, rays / wall * 1e-6, "");
+    std::string json = path;
+    if (json.size() > 4 && json.compare(json.size() - 4, 4, ".png") == 0) { json.resize(json.size() - 4); }
+    json += "_metrics.json";
+    FILE *fp = fopen(json.c_str(), "w");
+    if (!fp) { return; }
+    fprintf(fp, "{\n  \"wall_s\": %.4f, \"samples\": %llu, \"rays\": %llu, \"mrays_per_s\": %.4f,\n  \"threads\": [\n",
+            wall, sum(&TelemetrySlot::samples), rays, rays / wall * 1e-6);
+    u32 n = std::min(n_thread.load(), TELEMETRY_MAX_THREAD);
+    for (u32 i = 0; i < n; ++i) {
+      const TelemetrySlot &s = slots[i];
+      f64 hit = s.hit_cycles * cycle, busy = s.busy_cycles * cycle;
+      fprintf(fp, "    {\"samples\": %llu, \"rays\": %llu, \"hit_s\": %.4f, \"shade_s\": %.4f, \"utilization\": %.4f}%s\n",
+              u64(s.samples), u64(s.rays), hit, fmax(busy - hit, 0.0), busy / wall, i + 1 < n ? "," : "");
+    }
+    fprintf(fp, "  ]\n}\n");
+    fclose(fp);
+  }
+};
+
+Telemetry telemetry;
+thread_local TelemetrySlot *telemetry_slot = nullptr;
+
+// the slot of the calling thread, taken at its first call
+inline TelemetrySlot &telemetry_thread_slot() {
+  if (!telemetry_slot) { telemetry_slot = &telemetry.slots[telemetry.n_thread.fetch_add(1) % TELEMETRY_MAX_THREAD]; }
+  return *telemetry_slot;
+}
+
+// counts a ray & the cycles of the scope, only for threads of the pixel loop
+// only 1 in TELEMETRY_HIT_SAMPLE scopes is timed & scaled up, reading the clock for every ray costs ~7% of pt
+constexpr u64 TELEMETRY_HIT_SAMPLE = 16;
+
+struct TelemetryHit {
+  u64 start = 0;
+
+  TelemetryHit() {
+    if (telemetry_slot && telemetry_slot->rays.load(std::memory_order_relaxed) % TELEMETRY_HIT_SAMPLE == 0) {
+      start = telemetry_clock();
+    }
+  }
+
+  ~TelemetryHit() {
+    if (!telemetry_slot) { return; }
+    if (start) { telemetry_add(telemetry_slot->hit_cycles, (telemetry_clock() - start) * TELEMETRY_HIT_SAMPLE); }
+    telemetry_add(telemetry_slot->rays, 1);
+  }
+};
+#else
+struct TelemetryHit {};
+#endif
+
+#if defined(TRACE_STATS) && !defined(__CUDACC__)
+#include <vector>
+
+// a heatmap of each counter next to the image (image.png -> image_tri.png...), of the average per sample of each
+// pixel, black -> blue -> red -> yellow -> white up to the 99th percentile of the image, and a summary to stderr
+inline void output_trace_stats(const TraceStats *stats, u32 w, u32 h, u32 ns, const char *path) {
+  const char *names[] = {"interior", "leaf", "tri", "overflow", "restart", "newton_iter", "newton_fail", "path"};
+  constexpr u32 N = sizeof(TraceStats) / sizeof(u64);
+  static_assert(sizeof(names) / sizeof(names[0]) == N, "a name for each counter");
+  std::string base = path;
+  if (base.size() > 4 && base.compare(base.size() - 4, 4, ".png") == 0) { base.resize(base.size() - 4); }
+  std::vector<f32> v(w * h), sorted;
+  std::vector<Vec3> img(w * h);
+  const Vec3 stops[] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}};
+  fprintf(stderr, "\n%-12s %14s %14s %14s\n", "per sample", "mean", "p99 pixel", "max pixel");
+  for (u32 c = 0; c < N; ++c) {
+    f64 total = 0.0;
+    for (u32 i = 0; i < w * h; ++i) {
+      u64 x = ((const u64 *) &stats[i])[c];
+      v[i] = f32(x) / ns, total += x;
+    }
+    sorted = v;
+    std::nth_element(sorted.begin(), sorted.begin() + w * h * 99 / 100, sorted.end());
+    f32 p99 = sorted[w * h * 99 / 100], max = *std::max_element(v.begin(), v.end()), scale = p99 > 0.0f ? p99 : max;
+    for (u32 i = 0; i < w * h; ++i) {
+      f32 x = scale > 0.0f ? fminf(v[i] / scale, 1.0f) * 4.0f : 0.0f;
+      u32 k = std::min(u32(x), 3u);
+      Vec3 col = stops[k] + (stops[k + 1] - stops[k]) * (x - k);
+      // output_png applies the gamma
+      img[i] = Vec3{powf(col.x, 2.2f), powf(col.y, 2.2f), powf(col.z, 2.2f)};
+    }
+    output_png(img.data(), w, h, (base + "_" + names[c] + ".png").c_str());
+    fprintf(stderr, "%-12s %14.3f %14.3f %14.3f\n", names[c], total / (f64(w) * h * ns), p99, max);
+  }
+}
+#endif
+
 #define CUDA_CHECK_ERROR(fn) do { auto code = fn; if (code != cudaSuccess) exit((fprintf(stderr,"gpu error %s @%s @%d\n", cudaGetErrorString(code), __FUNCTION__, __LINE__), -1)); } while(false)
@@ -0,0 +1,164 @@
+// participating media for VolumeCodegen, the same as material::Medium
+// a heterogeneous medium also has a coarse grid of majorants, the max density of each MAJORANT_BLOCK^3 voxels, from
+// gen_medium_obj; tracking only walks the majorant cells along the ray, empty ones cost nothing, so a mostly empty
+// volume is about as cheap as a homogeneous one, and a tight local majorant means few null collisions
+
+constexpr u32 MAJORANT_BLOCK = 8;
+
+struct Medium {
+  f32 sigma_s, sigma_a;
+  // nullptr for homogeneous media, the rest is unused then
+  const f32 *density;  // nx * ny * nz voxels, x first
+  const f32 *majorant; // mx * my * mz cells, mx = ceil(nx / MAJORANT_BLOCK)...
+  Vec3 min, voxel;     // voxel: the size of a voxel
+  u32 nx, ny, nz, mx, my, mz;
+
+  f32 sigma_t() const {
+    return sigma_s + sigma_a;
+  }
+
+  f32 density_at(const Vec3 &p) const {
+    if (!density) { return 1.0f; }
+    f32 x = (p.x - min.x) / voxel.x, y = (p.y - min.y) / voxel.y, z = (p.z - min.z) / voxel.z;
+    if (x < 0.0f || y < 0.0f || z < 0.0f || x >= nx || y >= ny || z >= nz) { return 0.0f; }
+    return density[(u32(z) * ny + u32(y)) * nx + u32(x)];
+  }
+
+  // calls f(t0, t1, majorant density) for the pieces of [t0, t1] on the ray with a constant majorant, in order,
+  // until f returns true, and returns whether it did; pieces outside the grid (where the majorant is 0) are skipped
+  template <typename F>
+  bool march(const Ray &ray, f32 t0, f32 t1, F f) const {
+    if (!density) { return f(t0, t1, 1.0f); }
+    Vec3 cell = voxel * f32(MAJORANT_BLOCK), max = min + Vec3{voxel.x * nx, voxel.y * ny, voxel.z * nz};
+    u32 m[3] = {mx, my, mz};
+    for (u32 a = 0; a < 3; ++a) {
+      f32 inv = 1.0f / ray.d[a];
+      f32 near = (min[a] - ray.o[a]) * inv, far = (max[a] - ray.o[a]) * inv;
+      if (inv < 0.0f) { std::swap(near, far); }
+      t0 = fmaxf(t0, near), t1 = fminf(t1, far);
+    }
+    if (!(t0 < t1)) { return false; }
+    // 3d dda over the majorant cells
+    int idx[3], step[3];
+    f32 next[3], delta[3];
+    Vec3 p = ray.o + ray.d * t0;
+    for (u32 a = 0; a < 3; ++a) {
+      idx[a] = std::min(std::max(int((p[a] - min[a]) / cell[a]), 0), int(m[a]) - 1);
+      step[a] = ray.d[a] < 0.0f ? -1 : 1;
+      delta[a] = ray.d[a] != 0.0f ? cell[a] / fabsf(ray.d[a]) : INFINITY;
+      next[a] = ray.d[a] != 0.0f ? (min[a] + (idx[a] + (step[a] > 0)) * cell[a] - ray.o[a]) / ray.d[a] : INFINITY;
+    }
+    for (f32 t = t0; t < t1;) {
+      u32 a = next[0] < next[1] ? (next[0] < next[2] ? 0 : 2) : (next[1] < next[2] ? 1 : 2);
+      f32 end = fminf(next[a], t1);
+      if (end > t) {
+        f32 mu = majorant[(idx[2] * my + idx[1]) * mx + idx[0]];
+        if (mu > 0.0f && f(t, end, mu)) { return true; }
+        t = end;
+      }
+      idx[a] += step[a], next[a] += delta[a];
+      if (idx[a] < 0 || idx[a] >= int(m[a])) { break; }
+    }
+    return false;
+  }
+
+  // free flight sampling by delta tracking, t is the distance of the real collision if it is before t1
+  template <typename RNG>
+  bool sample_distance(const Ray &ray, f32 t1, RNG &rng, f32 &t) const {
+    return march(ray, 0.0f, t1, [&](f32 a, f32 b, f32 mu) {
+      f32 inv = 1.0f / (mu * sigma_t());
+      for (f32 s = a;;) {
+        s -= logf(1.0f - rng.gen()) * inv;
+        if (s >= b) { return false; }
+        if (!density || rng.gen() * mu < density_at(ray.o + ray.d * s)) {
+          t = s;
+          return true;
+        }
+      }
+    });
+  }
+
+  // transmittance in [0, t1], exact for homogeneous media, ratio tracking with russian roulette otherwise
+  template <typename RNG>
+  f32 transmittance(const Ray &ray, f32 t1, RNG &rng) const {
+    if (!density) { return expf(-sigma_t() * t1); }
+    f32 tr = 1.0f;
+    march(ray, 0.0f, t1, [&](f32 a, f32 b, f32 mu) {
+      f32 inv = 1.0f / (mu * sigma_t());
+      for (f32 s = a;;) {
+        s -= logf(1.0f - rng.gen()) * inv;
+        if (s >= b) { return false; }
+        tr *= 1.0f - density_at(ray.o + ray.d * s) / mu;
+        if (tr < 0.1f) {
+          if (rng.gen() < 0.5f) {
+            tr = 0.0f;
+            return true;
+          }
+          tr *= 2.0f;
+        }
+      }
+    });
+    return tr;
+  }
+
+  // sampling t in [0, t1] by free flight in the majorant medium, pdf(t) = sigma_maj(t) exp(-tau_maj(t)) / (1 -
+  // exp(-tau_maj(t1))), with no tracking, so the pdf of any t is known for mis; false if the majorant is 0 there
+  bool sample_majorant(const Ray &ray, f32 t1, f32 u, f32 &t, f32 &pdf) const {
+    f32 total = 0.0f;
+    march(ray, 0.0f, t1, [&](f32 a, f32 b, f32 mu) {
+      total += (b - a) * mu * sigma_t();
+      return false;
+    });
+    if (total <= 0.0f) { return false; }
+    f32 norm = 1.0f - expf(-total), target = -logf(1.0f - u * norm), tau = 0.0f;
+    return march(ray, 0.0f, t1, [&](f32 a, f32 b, f32 mu) {
+      f32 k = mu * sigma_t();
+      if (tau + (b - a) * k < target) {
+        tau += (b - a) * k;
+        return false;
+      }
+      t = a + (target - tau) / k;
+      pdf = k * expf(-target) / norm;
+      return true;
+    });
+  }
+
+  f32 majorant_pdf(const Ray &ray, f32 t1, f32 t) const {
+    f32 total = 0.0f, tau = 0.0f, k = 0.0f;
+    march(ray, 0.0f, t1, [&](f32 a, f32 b, f32 mu) {
+      total += (b - a) * mu * sigma_t();
+      if (a < t) {
+        tau += (fminf(b, t) - a) * mu * sigma_t();
+        k = b >= t ? mu * sigma_t() : 0.0f;
+      }
+      return false;
+    });
+    return total > 0.0f ? k * expf(-tau) / (1.0f - expf(-total)) : 0.0f;
+  }
+};
+
+// equiangular sampling of t in [0, t1] on the ray, toward the point y (kulla & fajardo), pdf ~ 1 / |x(t) - y|^2
+struct Equiangular {
+  f32 delta, d, th0, th1;
+
+  Equiangular(const Ray &ray, const Vec3 &y, f32 t1) {
+    delta = (y - ray.o).dot(ray.d);
+    d = fmaxf((ray.o + ray.d * delta - y).len(), 1e-4f);
+    th0 = atan2f(-delta, d), th1 = atan2f(t1 - delta, d);
+  }
+
+  f32 sample(f32 u) const {
+    return delta + d * tanf(th0 + (th1 - th0) * u);
+  }
+
+  f32 pdf(f32 t) const {
+    f32 x = t - delta;
+    return d / ((th1 - th0) * (d * d + x * x));
+  }
+};
+
+// isotropic phase function
+inline Vec3 sample_sphere(f32 u1, f32 u2) {
+  f32 cos = 1.0f - 2.0f * u1, sin = sqrtf(fmaxf(0.0f, 1.0f - cos * cos)), phi = 2.0f * PI * u2;
+  return {sin * cosf(phi), cos, sin * sinf(phi)};
+}